@@ -0,0 +1,391 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Synapse::Benchmark {
+    /**
+     * @brief Extra named value reported next to the timing of a benchmark, e.g. a footprint.
+     */
+    struct BenchmarkMetric {
+        std::string name;
+        double value;
+    };
+
+    /**
+     * @brief Outcome of one benchmark case, the best of its repetitions.
+     */
+    struct BenchmarkResult {
+        std::string name;                           ///< Slash separated case name, e.g. "FreeList/Random/SingleThread".
+        std::uint64_t operations{ 0U };
+        double nanoseconds_per_operation{ 0.0 };
+        std::optional<std::uint64_t> cache_misses;  ///< Empty when hardware counters are unavailable.
+        std::vector<BenchmarkMetric> metrics;
+    };
+
+    enum class OutputFormat : std::uint8_t {
+        Text,
+        Csv,
+        Json
+    };
+
+    /**
+     * @brief Command line options shared by every benchmark executable.
+     */
+    struct BenchmarkOptions {
+        OutputFormat format{ OutputFormat::Text };
+        std::string output_path{};  ///< Empty writes to stdout.
+        std::string filter{};       ///< Only cases whose name contains the filter are run.
+        std::uint32_t repetitions{ 5U };
+        std::vector<std::string_view> positional{};
+        std::vector<std::pair<std::string_view, std::string_view>> extra{};  ///< Unrecognised `--key value` pairs.
+
+        [[nodiscard]] auto Matches(const std::string_view name) const noexcept -> bool {
+            return filter.empty() || (name.find(filter) != std::string_view::npos);
+        }
+
+        [[nodiscard]] auto Find(const std::string_view key) const noexcept -> std::optional<std::string_view> {
+            const auto it = std::ranges::find(extra, key, &std::pair<std::string_view, std::string_view>::first);
+            return (it != extra.end()) ? std::optional{ it->second } : std::nullopt;
+        }
+    };
+
+    /**
+     * @brief Parses `--format text|csv|json`, `--output <path>`, `--filter <text>` and `--repetitions <n>`.
+     *
+     * Other `--key value` pairs are kept in `BenchmarkOptions::extra` for the executable to interpret.
+     * @return The options, or `std::nullopt` on malformed input.
+     */
+    [[nodiscard]] inline auto ParseBenchmarkOptions(const int argc, char **argv) -> std::optional<BenchmarkOptions> {
+        BenchmarkOptions options{};
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument{ argv[i] };
+            if (!argument.starts_with("--")) {
+                options.positional.push_back(argument);
+                continue;
+            }
+            if ((i + 1) >= argc) {
+                return std::nullopt;
+            }
+            const std::string_view value{ argv[++i] };
+            if (argument == "--format") {
+                if (value == "text") {
+                    options.format = OutputFormat::Text;
+                } else if (value == "csv") {
+                    options.format = OutputFormat::Csv;
+                } else if (value == "json") {
+                    options.format = OutputFormat::Json;
+                } else {
+                    return std::nullopt;
+                }
+            } else if (argument == "--output") {
+                options.output_path = value;
+            } else if (argument == "--filter") {
+                options.filter = value;
+            } else if (argument == "--repetitions") {
+                if ((std::from_chars(value.data(), value.data() + value.size(), options.repetitions).ec != std::errc{}) ||
+                        (options.repetitions == 0U)) {
+                    return std::nullopt;
+                }
+            } else {
+                options.extra.emplace_back(argument, value);
+            }
+        }
+        return options;
+    }
+
+    /**
+     * @brief Counts last level cache misses of the calling thread with `perf_event_open`.
+     *
+     * Only available on Linux, and only when the kernel allows unprivileged counters
+     * (`perf_event_paranoid`) or the process is privileged. `IsAvailable` reports which.
+     */
+    class CacheMissCounter {
+    public:
+        CacheMissCounter() noexcept {
+#ifdef __linux__
+            perf_event_attr attributes{};
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.size = sizeof(attributes);
+            attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+            attributes.disabled = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            attributes.inherit = 1;
+            m_descriptor = static_cast<int>(::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+        }
+        ~CacheMissCounter() noexcept {
+#ifdef __linux__
+            if (m_descriptor != -1) {
+                (void)::close(m_descriptor);
+            }
+#endif
+        }
+
+        CacheMissCounter(const CacheMissCounter&) = delete;
+        CacheMissCounter(CacheMissCounter&&) = delete;
+        auto operator=(const CacheMissCounter &) -> CacheMissCounter & = delete;
+        auto operator=(CacheMissCounter &&) -> CacheMissCounter & = delete;
+        auto operator==(const CacheMissCounter &other) const -> bool = delete;
+
+        [[nodiscard]] auto IsAvailable() const noexcept -> bool { return m_descriptor != -1; }
+
+        auto Start() noexcept -> void {
+#ifdef __linux__
+            if (m_descriptor != -1) {
+                (void)::ioctl(m_descriptor, PERF_EVENT_IOC_RESET, 0);
+                (void)::ioctl(m_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        /**
+         * @brief Stops counting.
+         * @return Misses since `Start`, or `std::nullopt` when the counter is unavailable.
+         */
+        auto Stop() noexcept -> std::optional<std::uint64_t> {
+#ifdef __linux__
+            if (m_descriptor != -1) {
+                (void)::ioctl(m_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+                std::uint64_t count{ 0U };
+                if (::read(m_descriptor, &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count))) {
+                    return count;
+                }
+            }
+#endif
+            return std::nullopt;
+        }
+
+    private:
+        int m_descriptor{ -1 };
+    };
+
+    /**
+     * @brief Measures one repetition of a benchmark: wall time and cache misses.
+     */
+    class Measurement {
+    public:
+        explicit Measurement(CacheMissCounter& counter) noexcept : m_counter(counter) {}
+
+        auto Start() noexcept -> void {
+            m_counter.Start();
+            m_begin = std::chrono::steady_clock::now();
+        }
+
+        auto Stop() noexcept -> void {
+            m_end = std::chrono::steady_clock::now();
+            m_cache_misses = m_counter.Stop();
+        }
+
+        [[nodiscard]] auto GetNanoseconds() const noexcept -> double {
+            return std::chrono::duration<double, std::nano>(m_end - m_begin).count();
+        }
+        [[nodiscard]] auto GetCacheMisses() const noexcept -> std::optional<std::uint64_t> { return m_cache_misses; }
+
+    private:
+        CacheMissCounter& m_counter;
+        std::chrono::steady_clock::time_point m_begin{};
+        std::chrono::steady_clock::time_point m_end{};
+        std::optional<std::uint64_t> m_cache_misses{};
+    };
+
+    /**
+     * @brief Collects benchmark results and writes them as a table, CSV or JSON.
+     *
+     * CSV and JSON are meant for tracking results over time; every row carries the same
+     * columns, metrics a case does not report are left empty (CSV) or omitted (JSON).
+     */
+    class BenchmarkReport {
+    public:
+        explicit BenchmarkReport(std::string suite) noexcept : m_suite(std::move(suite)) {}
+
+        auto Add(BenchmarkResult result) -> void { m_results.push_back(std::move(result)); }
+
+        [[nodiscard]] auto GetResults() const noexcept -> const std::vector<BenchmarkResult> & { return m_results; }
+
+        /**
+         * @brief Writes the report to `options.output_path`, or stdout when it is empty.
+         * @return `false` if the output file could not be opened.
+         */
+        auto Write(const BenchmarkOptions &options) const -> bool {
+            std::FILE *file{ stdout };
+            if (!options.output_path.empty()) {
+                file = std::fopen(options.output_path.c_str(), "w");
+                if (file == nullptr) {
+                    return false;
+                }
+            }
+            std::string text{};
+            switch (options.format) {
+                case OutputFormat::Text:
+                    text = FormatText();
+                    break;
+                case OutputFormat::Csv:
+                    text = FormatCsv();
+                    break;
+                case OutputFormat::Json:
+                    text = FormatJson();
+                    break;
+            }
+            (void)std::fwrite(text.data(), 1U, text.size(), file);
+            if (file != stdout) {
+                (void)std::fclose(file);
+            }
+            return true;
+        }
+
+    private:
+        [[nodiscard]] auto MetricNames() const -> std::vector<std::string> {
+            std::vector<std::string> names{};
+            for (const BenchmarkResult &result : m_results) {
+                for (const BenchmarkMetric &metric : result.metrics) {
+                    if (std::ranges::find(names, metric.name) == names.end()) {
+                        names.push_back(metric.name);
+                    }
+                }
+            }
+            return names;
+        }
+
+        [[nodiscard]] static auto FindMetric(const BenchmarkResult &result, const std::string_view name) noexcept
+                -> const BenchmarkMetric * {
+            const auto it = std::ranges::find(result.metrics, name, &BenchmarkMetric::name);
+            return (it != result.metrics.end()) ? &*it : nullptr;
+        }
+
+        // Counts and byte sizes print as integers, ratios with four decimals
+        [[nodiscard]] static auto FormatValue(const double value) -> std::string {
+            return (value == std::floor(value)) ? std::format("{:.0f}", value) : std::format("{:.4f}", value);
+        }
+
+        [[nodiscard]] auto FormatText() const -> std::string {
+            const std::vector<std::string> metric_names{ MetricNames() };
+            std::size_t name_width{ 4U };
+            for (const BenchmarkResult &result : m_results) {
+                name_width = std::max(name_width, result.name.size());
+            }
+
+            std::string text{ std::format("{:<{}} {:>12} {:>12} {:>14}", "case", name_width, "operations", "ns/op", "cache misses") };
+            for (const std::string &metric_name : metric_names) {
+                text += std::format(" {:>16}", metric_name);
+            }
+            text += '\n';
+            for (const BenchmarkResult &result : m_results) {
+                text += std::format("{:<{}} {:>12} {:>12.2f} {:>14}", result.name, name_width, result.operations,
+                        result.nanoseconds_per_operation,
+                        result.cache_misses ? std::to_string(*result.cache_misses) : std::string{ "n/a" });
+                for (const std::string &metric_name : metric_names) {
+                    const BenchmarkMetric *metric{ FindMetric(result, metric_name) };
+                    text += std::format(" {:>16}", metric ? FormatValue(metric->value) : std::string{});
+                }
+                text += '\n';
+            }
+            return text;
+        }
+
+        [[nodiscard]] auto FormatCsv() const -> std::string {
+            const std::vector<std::string> metric_names{ MetricNames() };
+            std::string text{ "suite,case,operations,ns_per_op,cache_misses" };
+            for (const std::string &metric_name : metric_names) {
+                text += ',';
+                text += metric_name;
+            }
+            text += '\n';
+            for (const BenchmarkResult &result : m_results) {
+                text += std::format("{},{},{},{:.4f},{}", m_suite, result.name, result.operations,
+                        result.nanoseconds_per_operation,
+                        result.cache_misses ? std::to_string(*result.cache_misses) : std::string{});
+                for (const std::string &metric_name : metric_names) {
+                    const BenchmarkMetric *metric{ FindMetric(result, metric_name) };
+                    text += metric ? std::format(",{}", metric->value) : std::string{ "," };
+                }
+                text += '\n';
+            }
+            return text;
+        }
+
+        // Names are free text, a quote or a backslash in one would end the string early
+        [[nodiscard]] static auto EscapeJson(const std::string_view value) -> std::string {
+            std::string escaped{};
+            escaped.reserve(value.size());
+            for (const char character : value) {
+                switch (character) {
+                    case '"':
+                        escaped += "\\\"";
+                        break;
+                    case '\\':
+                        escaped += "\\\\";
+                        break;
+                    case '\n':
+                        escaped += "\\n";
+                        break;
+                    case '\r':
+                        escaped += "\\r";
+                        break;
+                    case '\t':
+                        escaped += "\\t";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(character) < 0x20U) {
+                            escaped += std::format("\\u{:04x}", static_cast<unsigned int>(static_cast<unsigned char>(character)));
+                        } else {
+                            escaped += character;
+                        }
+                        break;
+                }
+            }
+            return escaped;
+        }
+
+        [[nodiscard]] auto FormatJson() const -> std::string {
+            std::string text{ std::format("{{\n  \"suite\": \"{}\",\n  \"results\": [", EscapeJson(m_suite)) };
+            for (std::size_t i = 0U; i < m_results.size(); ++i) {
+                const BenchmarkResult &result{ m_results[i] };
+                text += std::format("{}\n    {{ \"case\": \"{}\", \"operations\": {}, \"ns_per_op\": {:.4f}",
+                        (i == 0U) ? "" : ",", EscapeJson(result.name), result.operations, result.nanoseconds_per_operation);
+                if (result.cache_misses) {
+                    text += std::format(", \"cache_misses\": {}", *result.cache_misses);
+                }
+                for (const BenchmarkMetric &metric : result.metrics) {
+                    text += std::format(", \"{}\": {}", EscapeJson(metric.name), metric.value);
+                }
+                text += " }";
+            }
+            text += "\n  ]\n}\n";
+            return text;
+        }
+
+        std::string m_suite;
+        std::vector<BenchmarkResult> m_results{};
+    };
+
+    /**
+     * @brief Keeps the compiler from optimising away a value computed by a benchmark.
+     */
+    template <typename TValue>
+    inline auto DoNotOptimise(const TValue &value) noexcept -> void {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const TValue *s_sink{ nullptr };
+        s_sink = &value;
+#endif
+    }
+}
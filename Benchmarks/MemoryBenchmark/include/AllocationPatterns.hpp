@@ -0,0 +1,189 @@
+#pragma once
+#include <Arena/AllocationTrace.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace Synapse::Benchmark {
+    /**
+     * @brief Order in which an allocator can take frees back.
+     *
+     * Patterns declare what they need, allocators what they support, and a pattern only
+     * runs against allocators that can honour it.
+     */
+    enum class FreeOrder : std::uint8_t {
+        None,  ///< No individual frees, the allocator is reset as a whole.
+        Lifo,  ///< Only the most recent live allocation can be freed.
+        Any    ///< Frees in any order.
+    };
+
+    /**
+     * @brief Shape of a synthetic allocation pattern.
+     */
+    struct PatternParameters {
+        std::size_t operations{ 200'000U };  ///< Number of allocations the pattern performs.
+        std::size_t min_size{ 8U };
+        std::size_t max_size{ 1024U };
+        std::size_t max_alignment{ 64U };
+        std::size_t max_live{ 1024U };       ///< Upper bound of simultaneously live allocations.
+        std::uint64_t seed{ 0x5EED5EEDU };
+    };
+
+    /**
+     * @brief Builds `AllocationReplay` sequences, so synthetic patterns and recorded traces share one runner.
+     */
+    class PatternBuilder {
+    public:
+        explicit PatternBuilder(const PatternParameters &parameters) noexcept :
+            m_parameters(parameters), m_random(parameters.seed) {
+            m_replay.operations.reserve(parameters.operations * 2U);
+        }
+
+        /**
+         * @brief Appends an allocation of a random size and alignment.
+         * @return The slot that identifies the allocation in later frees.
+         */
+        auto Allocate() -> std::uint32_t {
+            std::uint32_t slot{ m_replay.slot_count };
+            if (m_free_slots.empty()) {
+                ++m_replay.slot_count;
+                m_slot_sizes.push_back(0U);
+                m_slot_alignments.push_back(0U);
+            } else {
+                slot = m_free_slots.back();
+                m_free_slots.pop_back();
+            }
+            const std::uint64_t size{ NextSize() };
+            const std::uint32_t alignment{ NextAlignment() };
+            m_slot_sizes[slot] = size;
+            m_slot_alignments[slot] = alignment;
+            m_live_bytes += size;
+            m_replay.peak_live_bytes = std::max(m_replay.peak_live_bytes, m_live_bytes);
+            m_replay.operations.push_back(Memory::Arena::ReplayOperation{
+                .size = size, .slot = slot, .alignment = alignment, .type = Memory::Arena::AllocationEventType::Allocate });
+            return slot;
+        }
+
+        auto Free(const std::uint32_t slot) -> void {
+            m_live_bytes -= m_slot_sizes[slot];
+            m_free_slots.push_back(slot);
+            m_replay.operations.push_back(Memory::Arena::ReplayOperation{
+                .size = m_slot_sizes[slot], .slot = slot, .alignment = m_slot_alignments[slot],
+                .type = Memory::Arena::AllocationEventType::Deallocate });
+        }
+
+        [[nodiscard]] auto NextIndex(const std::size_t count) -> std::size_t {
+            return std::uniform_int_distribution<std::size_t>{ 0U, count - 1U }(m_random);
+        }
+
+        [[nodiscard]] auto GetParameters() const noexcept -> const PatternParameters & { return m_parameters; }
+
+        [[nodiscard]] auto Build() -> Memory::Arena::AllocationReplay { return std::move(m_replay); }
+
+    private:
+        // Log-uniform, small allocations dominate like in real workloads
+        [[nodiscard]] auto NextSize() -> std::uint64_t {
+            const double low{ std::log2(static_cast<double>(m_parameters.min_size)) };
+            const double high{ std::log2(static_cast<double>(m_parameters.max_size)) };
+            const double exponent{ std::uniform_real_distribution<double>{ low, high }(m_random) };
+            return std::clamp<std::uint64_t>(static_cast<std::uint64_t>(std::exp2(exponent)), m_parameters.min_size,
+                    m_parameters.max_size);
+        }
+
+        // 8 bytes most of the time, every larger power of two half as likely as the previous one
+        [[nodiscard]] auto NextAlignment() -> std::uint32_t {
+            std::uint32_t alignment{ 8U };
+            while ((alignment < m_parameters.max_alignment) && ((m_random() & 1U) == 0U)) {
+                alignment <<= 1U;
+            }
+            return alignment;
+        }
+
+        PatternParameters m_parameters;
+        std::mt19937_64 m_random;
+        Memory::Arena::AllocationReplay m_replay{};
+        std::vector<std::uint64_t> m_slot_sizes{};
+        std::vector<std::uint32_t> m_slot_alignments{};
+        std::vector<std::uint32_t> m_free_slots{};
+        std::uint64_t m_live_bytes{ 0U };
+    };
+
+    /**
+     * @brief Allocations only, e.g. a frame's worth of transient data that is reset at once.
+     */
+    [[nodiscard]] inline auto MakeBulkPattern(const PatternParameters &parameters) -> Memory::Arena::AllocationReplay {
+        PatternBuilder builder{ parameters };
+        for (std::size_t i = 0U; i < parameters.operations; ++i) {
+            (void)builder.Allocate();
+        }
+        return builder.Build();
+    }
+
+    /**
+     * @brief Random pushes and pops of a stack of live allocations, freed in reverse order.
+     */
+    [[nodiscard]] inline auto MakeLifoPattern(const PatternParameters &parameters) -> Memory::Arena::AllocationReplay {
+        PatternBuilder builder{ parameters };
+        std::vector<std::uint32_t> live{};
+        for (std::size_t allocated = 0U; allocated < parameters.operations;) {
+            if (live.empty() || ((live.size() < parameters.max_live) && (builder.NextIndex(2U) == 0U))) {
+                live.push_back(builder.Allocate());
+                ++allocated;
+            } else {
+                builder.Free(live.back());
+                live.pop_back();
+            }
+        }
+        for (auto it = live.rbegin(); it != live.rend(); ++it) {
+            builder.Free(*it);
+        }
+        return builder.Build();
+    }
+
+    /**
+     * @brief A sliding window of live allocations, the oldest is freed first, e.g. message buffers.
+     */
+    [[nodiscard]] inline auto MakeFifoPattern(const PatternParameters &parameters) -> Memory::Arena::AllocationReplay {
+        PatternBuilder builder{ parameters };
+        std::deque<std::uint32_t> live{};
+        for (std::size_t i = 0U; i < parameters.operations; ++i) {
+            if (live.size() == parameters.max_live) {
+                builder.Free(live.front());
+                live.pop_front();
+            }
+            live.push_back(builder.Allocate());
+        }
+        for (const std::uint32_t slot : live) {
+            builder.Free(slot);
+        }
+        return builder.Build();
+    }
+
+    /**
+     * @brief Random sizes with frees of random live allocations, the worst case for fragmentation.
+     */
+    [[nodiscard]] inline auto MakeRandomPattern(const PatternParameters &parameters) -> Memory::Arena::AllocationReplay {
+        PatternBuilder builder{ parameters };
+        std::vector<std::uint32_t> live{};
+        for (std::size_t allocated = 0U; allocated < parameters.operations;) {
+            if (live.empty() || ((live.size() < parameters.max_live) && (builder.NextIndex(2U) == 0U))) {
+                live.push_back(builder.Allocate());
+                ++allocated;
+            } else {
+                const std::size_t index{ builder.NextIndex(live.size()) };
+                builder.Free(live[index]);
+                live[index] = live.back();
+                live.pop_back();
+            }
+        }
+        for (const std::uint32_t slot : live) {
+            builder.Free(slot);
+        }
+        return builder.Build();
+    }
+}
@@ -0,0 +1,385 @@
+#pragma once
+#include <AllocationPatterns.hpp>
+#include <BenchmarkHarness.hpp>
+#include <Allocator/AllocationChecking.hpp>
+#include <Allocator/FreeListAllocator.hpp>
+#include <Allocator/LinearAllocator.hpp>
+#include <Allocator/PoolAllocator.hpp>
+#include <Allocator/StackAllocator.hpp>
+#include <Area/HeapArea.hpp>
+#include <Arena/AllocationTrace.hpp>
+#include <Arena/MemoryArena.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Synapse::Benchmark {
+    template <class... TTypes>
+    struct TypeList {};
+
+    /**
+     * @brief Calls `function.template operator()<T>()` for every type of the list.
+     */
+    template <class... TTypes, class TFunction>
+    auto ForEachType(TypeList<TTypes...>, TFunction &&function) -> void {
+        (function.template operator()<TTypes>(), ...);
+    }
+
+    /**
+     * @brief Suffix distinguishing allocators built with the release fast path policy.
+     */
+    template <class TChecked>
+    inline constexpr std::string_view CHECKING_SUFFIX{ std::is_same_v<TChecked, Memory::Allocator::UncheckedAllocation> ? "Unchecked" : "" };
+
+    // Allocators under test. TOffset is supplied by the arena from the bounds checking policy.
+    template <class TChecked>
+    struct LinearConfig {
+        static inline const std::string NAME{ std::string{ "Linear" } + std::string{ CHECKING_SUFFIX<TChecked> } };
+        static constexpr FreeOrder FREE_ORDER{ FreeOrder::None };
+        static constexpr std::size_t MAX_SIZE{ std::numeric_limits<std::size_t>::max() };
+        static constexpr std::size_t MAX_ALIGNMENT{ std::numeric_limits<std::size_t>::max() };
+        template <std::size_t TOffset>
+        using Allocator = Memory::Allocator::LinearAllocator<TOffset, TChecked>;
+    };
+
+    template <class TChecked>
+    struct StackConfig {
+        static inline const std::string NAME{ std::string{ "Stack" } + std::string{ CHECKING_SUFFIX<TChecked> } };
+        static constexpr FreeOrder FREE_ORDER{ FreeOrder::Lifo };
+        static constexpr std::size_t MAX_SIZE{ std::numeric_limits<std::size_t>::max() };
+        static constexpr std::size_t MAX_ALIGNMENT{ std::numeric_limits<std::size_t>::max() };
+        template <std::size_t TOffset>
+        using Allocator = Memory::Allocator::StackAllocator<TOffset, TChecked>;
+    };
+
+    struct PoolConfig {
+        static inline const std::string NAME{ "Pool256" };
+        static constexpr FreeOrder FREE_ORDER{ FreeOrder::Any };
+        static constexpr std::size_t ELEMENT_SIZE{ 256U };
+        // The back guard is carved out of the element
+        static constexpr std::size_t MAX_SIZE{ ELEMENT_SIZE - Memory::Arena::SimpleBoundsChecking::SIZE_BACK };
+        static constexpr std::size_t MAX_ALIGNMENT{ 16U };
+        template <std::size_t TOffset>
+        using Allocator = Memory::Allocator::PoolAllocator<ELEMENT_SIZE, TOffset, MAX_ALIGNMENT>;
+    };
+
+    template <bool TBestFit, class TChecked>
+    struct FreeListConfig {
+        static inline const std::string NAME{ std::string{ TBestFit ? "FreeListBestFit" : "FreeListFirstFit" } +
+                std::string{ CHECKING_SUFFIX<TChecked> } };
+        static constexpr FreeOrder FREE_ORDER{ FreeOrder::Any };
+        static constexpr std::size_t MAX_SIZE{ std::numeric_limits<std::size_t>::max() };
+        static constexpr std::size_t MAX_ALIGNMENT{ std::numeric_limits<std::size_t>::max() };
+        template <std::size_t TOffset>
+        using Allocator = Memory::Allocator::FreeListAllocator<TOffset, TBestFit, TChecked>;
+    };
+
+    /**
+     * @brief `std::mutex` exposed through the `Enter`/`Leave` interface of `MultiThreadPolicy`.
+     */
+    class MutexPrimitive {
+    public:
+        auto Enter() noexcept -> void { m_mutex.lock(); }
+        auto Leave() noexcept -> void { m_mutex.unlock(); }
+
+    private:
+        std::mutex m_mutex{};
+    };
+
+    // Thread policies under test
+    struct SingleThreadConfig {
+        static constexpr std::string_view NAME{ "SingleThread" };
+        static constexpr bool MULTI_THREADED{ false };
+        using Policy = Memory::Arena::SingleThreadPolicy;
+    };
+
+    struct MutexThreadConfig {
+        static constexpr std::string_view NAME{ "Mutex" };
+        static constexpr bool MULTI_THREADED{ true };
+        using Policy = Memory::Arena::MultiThreadPolicy<MutexPrimitive>;
+    };
+
+    template <class TPolicy>
+    struct PolicyName;
+    template <>
+    struct PolicyName<Memory::Arena::NoBoundsChecking> { static constexpr std::string_view NAME{ "NoBounds" }; };
+    template <>
+    struct PolicyName<Memory::Arena::SimpleBoundsChecking> { static constexpr std::string_view NAME{ "GuardBytes" }; };
+    template <>
+    struct PolicyName<Memory::Arena::ScrubbedBoundsChecking> { static constexpr std::string_view NAME{ "ScrubbedGuards" }; };
+    template <>
+    struct PolicyName<Memory::Arena::NoMemoryTracking> { static constexpr std::string_view NAME{ "NoTracking" }; };
+    template <>
+    struct PolicyName<Memory::Arena::PostitionMemoryTracking> { static constexpr std::string_view NAME{ "PositionTracking" }; };
+    template <>
+    struct PolicyName<Memory::Arena::NoMemoryTagging> { static constexpr std::string_view NAME{ "NoTagging" }; };
+    template <>
+    struct PolicyName<Memory::Arena::SimpleMemoryTagging> { static constexpr std::string_view NAME{ "FillTagging" }; };
+
+    using AllocatorConfigs = TypeList<
+            LinearConfig<Memory::Allocator::CheckedAllocation>, LinearConfig<Memory::Allocator::UncheckedAllocation>,
+            StackConfig<Memory::Allocator::CheckedAllocation>, StackConfig<Memory::Allocator::UncheckedAllocation>,
+            PoolConfig,
+            FreeListConfig<false, Memory::Allocator::CheckedAllocation>, FreeListConfig<false, Memory::Allocator::UncheckedAllocation>,
+            FreeListConfig<true, Memory::Allocator::CheckedAllocation>, FreeListConfig<true, Memory::Allocator::UncheckedAllocation>>;
+    using ThreadConfigs = TypeList<SingleThreadConfig, MutexThreadConfig>;
+    using BoundsCheckingPolicies = TypeList<Memory::Arena::NoBoundsChecking, Memory::Arena::SimpleBoundsChecking,
+            Memory::Arena::ScrubbedBoundsChecking>;
+    using MemoryTrackingPolicies = TypeList<Memory::Arena::NoMemoryTracking, Memory::Arena::PostitionMemoryTracking>;
+    using MemoryTaggingPolicies = TypeList<Memory::Arena::NoMemoryTagging, Memory::Arena::SimpleMemoryTagging>;
+
+    /**
+     * @brief One `MemoryArena` instantiation together with the area and primitive it needs.
+     */
+    template <class TAllocatorConfig, class TThreadConfig, class TBoundsChecking, class TMemoryTracking, class TMemoryTagging>
+    class ArenaFixture {
+    public:
+        using Arena = Memory::Arena::MemoryArena<typename TAllocatorConfig::template Allocator<TBoundsChecking::SIZE_FRONT>,
+                typename TThreadConfig::Policy, TBoundsChecking, TMemoryTracking, TMemoryTagging>;
+
+        explicit ArenaFixture(const std::size_t area_size) noexcept : m_area(area_size) {
+            // Fault the pages in up front, first touch would otherwise dominate the first repetition
+            std::fill(m_area.GetStart(), m_area.GetEnd(), std::byte{ 0 });
+        }
+
+        /**
+         * @brief Builds a fresh arena over the area, dropping everything the previous one held.
+         */
+        auto MakeArena() -> Arena & {
+            m_arena.reset();
+            if constexpr (TThreadConfig::MULTI_THREADED) {
+                m_arena.emplace(m_area, m_primitive);
+            } else {
+                m_arena.emplace(m_area);
+            }
+            return *m_arena;
+        }
+
+        [[nodiscard]] auto GetAreaStart() const noexcept -> const std::byte * { return m_area.GetStart(); }
+
+        [[nodiscard]] static auto GetName() -> std::string {
+            return TAllocatorConfig::NAME + "/" + std::string{ TThreadConfig::NAME } + "/" +
+                    std::string{ PolicyName<TBoundsChecking>::NAME } + "/" + std::string{ PolicyName<TMemoryTracking>::NAME } +
+                    "/" + std::string{ PolicyName<TMemoryTagging>::NAME };
+        }
+
+    private:
+        Memory::Area::HeapArea m_area;
+        MutexPrimitive m_primitive{};
+        std::optional<Arena> m_arena{};
+    };
+
+    /**
+     * @brief Raw numbers of one repetition, turned into a `BenchmarkResult` by `Summarise`.
+     */
+    struct RunStatistics {
+        std::uint64_t operations{ 0U };
+        double nanoseconds{ 0.0 };
+        std::optional<std::uint64_t> cache_misses{};
+        std::uint64_t failed_allocations{ 0U };
+        std::uint64_t peak_live_bytes{ 0U };
+        std::uint64_t peak_footprint{ 0U };  ///< Highest byte touched, relative to the area start.
+    };
+
+    [[nodiscard]] inline auto Summarise(std::string name, const std::vector<RunStatistics> &runs) -> BenchmarkResult {
+        // The fastest repetition is the least disturbed by the rest of the machine
+        const RunStatistics &best{ *std::ranges::min_element(runs, {}, &RunStatistics::nanoseconds) };
+        const double fragmentation{ (best.peak_footprint > 0U)
+                ? 1.0 - (static_cast<double>(best.peak_live_bytes) / static_cast<double>(best.peak_footprint))
+                : 0.0 };
+        return BenchmarkResult{
+            .name = std::move(name),
+            .operations = best.operations,
+            .nanoseconds_per_operation = (best.operations > 0U) ? best.nanoseconds / static_cast<double>(best.operations) : 0.0,
+            .cache_misses = best.cache_misses,
+            .metrics = {
+                { "peak_footprint", static_cast<double>(best.peak_footprint) },
+                { "peak_live_bytes", static_cast<double>(best.peak_live_bytes) },
+                { "fragmentation", fragmentation },
+                { "failed_allocations", static_cast<double>(best.failed_allocations) }
+            }
+        };
+    }
+
+    /**
+     * @brief A block handed out by the arena, with what the sized `Deallocate` needs to take it back.
+     */
+    struct LiveBlock {
+        std::byte *ptr;
+        std::uint64_t size;
+        std::uint32_t alignment;
+    };
+
+    /**
+     * @brief Replays an allocation sequence into an arena on the calling thread.
+     *
+     * Allocations left live by the sequence, e.g. by a trace that was cut short, are freed
+     * after the measurement when the allocator supports it.
+     */
+    template <FreeOrder TFreeOrder, class TArena>
+    [[nodiscard]] auto RunReplay(TArena &arena, const std::byte *area_start, const Memory::Arena::AllocationReplay &replay,
+            std::vector<LiveBlock> &slots, CacheMissCounter &counter) -> RunStatistics {
+        using Memory::Arena::AllocationEventType;
+        using Memory::Arena::ReplayOperation;
+
+        slots.assign(replay.slot_count, LiveBlock{ nullptr, 0U, 0U });
+        RunStatistics statistics{ .operations = replay.operations.size() };
+        std::uint64_t live_bytes{ 0U };
+
+        Measurement measurement{ counter };
+        measurement.Start();
+        for (const ReplayOperation &operation : replay.operations) {
+            if (operation.type == AllocationEventType::Allocate) {
+                std::byte *ptr{ arena.Allocate(static_cast<std::size_t>(operation.size), operation.alignment) };
+                if (ptr == nullptr) {
+                    ++statistics.failed_allocations;
+                    continue;
+                }
+                slots[operation.slot] = LiveBlock{ ptr, operation.size, operation.alignment };
+                live_bytes += operation.size;
+                statistics.peak_live_bytes = std::max(statistics.peak_live_bytes, live_bytes);
+                statistics.peak_footprint = std::max(statistics.peak_footprint,
+                        static_cast<std::uint64_t>((ptr + operation.size) - area_start));
+            } else if constexpr (TFreeOrder != FreeOrder::None) {
+                if (slots[operation.slot].ptr != nullptr) {
+                    arena.Deallocate(slots[operation.slot].ptr, static_cast<std::size_t>(operation.size), operation.alignment);
+                    slots[operation.slot].ptr = nullptr;
+                    live_bytes -= operation.size;
+                }
+            }
+        }
+        measurement.Stop();
+
+        if constexpr (TFreeOrder == FreeOrder::Any) {
+            for (const LiveBlock &block : slots) {
+                if (block.ptr != nullptr) {
+                    arena.Deallocate(block.ptr, static_cast<std::size_t>(block.size), block.alignment);
+                }
+            }
+        }
+        statistics.nanoseconds = measurement.GetNanoseconds();
+        statistics.cache_misses = measurement.GetCacheMisses();
+        return statistics;
+    }
+
+    /**
+     * @brief Bounded single-producer single-consumer ring handing blocks from the producer to the consumer.
+     */
+    template <std::size_t TCapacity>
+    class HandoffRing {
+    public:
+        auto TryPush(const LiveBlock block) noexcept -> bool {
+            const std::size_t head{ m_head.load(std::memory_order_relaxed) };
+            if ((head - m_tail.load(std::memory_order_acquire)) == TCapacity) {
+                return false;
+            }
+            m_blocks[head % TCapacity] = block;
+            m_head.store(head + 1U, std::memory_order_release);
+            return true;
+        }
+
+        auto TryPop(LiveBlock &block) noexcept -> bool {
+            const std::size_t tail{ m_tail.load(std::memory_order_relaxed) };
+            if (tail == m_head.load(std::memory_order_acquire)) {
+                return false;
+            }
+            block = m_blocks[tail % TCapacity];
+            m_tail.store(tail + 1U, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> m_head{ 0U };
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> m_tail{ 0U };
+        std::array<LiveBlock, TCapacity> m_blocks{};
+    };
+
+    /**
+     * @brief Producer/consumer pattern: one thread allocates, another frees what it receives.
+     *
+     * Only the allocations of the replay are used, the frees happen on the consumer in the
+     * order the blocks arrive. This exercises the thread policy under contention and the
+     * allocator with frees of memory allocated on another thread.
+     */
+    template <class TArena>
+    [[nodiscard]] auto RunCrossThread(TArena &arena, const std::byte *area_start, const Memory::Arena::AllocationReplay &replay,
+            CacheMissCounter &counter) -> RunStatistics {
+        using Memory::Arena::AllocationEventType;
+        using Memory::Arena::ReplayOperation;
+        using Ring = HandoffRing<1024U>;
+
+        Ring ring{};
+        std::atomic<bool> producer_done{ false };
+        std::atomic<std::uint64_t> freed_bytes{ 0U };
+        std::atomic<std::uint64_t> frees{ 0U };
+        RunStatistics statistics{};
+
+        Measurement measurement{ counter };
+        measurement.Start();
+        std::jthread consumer{ [&] {
+            LiveBlock block{};
+            std::uint64_t local_freed{ 0U };
+            std::uint64_t local_frees{ 0U };
+            while (true) {
+                if (ring.TryPop(block)) {
+                    arena.Deallocate(block.ptr, static_cast<std::size_t>(block.size), block.alignment);
+                    local_freed += block.size;
+                    ++local_frees;
+                    freed_bytes.store(local_freed, std::memory_order_relaxed);
+                } else if (producer_done.load(std::memory_order_acquire)) {
+                    if (!ring.TryPop(block)) {
+                        break;
+                    }
+                    arena.Deallocate(block.ptr, static_cast<std::size_t>(block.size), block.alignment);
+                    local_freed += block.size;
+                    ++local_frees;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            frees.store(local_frees, std::memory_order_relaxed);
+        } };
+
+        std::uint64_t allocated_bytes{ 0U };
+        std::uint64_t allocations{ 0U };
+        for (const ReplayOperation &operation : replay.operations) {
+            if (operation.type != AllocationEventType::Allocate) {
+                continue;
+            }
+            std::byte *ptr{ arena.Allocate(static_cast<std::size_t>(operation.size), operation.alignment) };
+            if (ptr == nullptr) {
+                ++statistics.failed_allocations;
+                continue;
+            }
+            ++allocations;
+            allocated_bytes += operation.size;
+            statistics.peak_live_bytes = std::max(statistics.peak_live_bytes,
+                    allocated_bytes - freed_bytes.load(std::memory_order_relaxed));
+            statistics.peak_footprint = std::max(statistics.peak_footprint,
+                    static_cast<std::uint64_t>((ptr + operation.size) - area_start));
+            while (!ring.TryPush(LiveBlock{ ptr, operation.size, operation.alignment })) {
+                std::this_thread::yield();
+            }
+        }
+        producer_done.store(true, std::memory_order_release);
+        consumer.join();
+        measurement.Stop();
+
+        statistics.operations = allocations + frees.load(std::memory_order_relaxed);
+        statistics.nanoseconds = measurement.GetNanoseconds();
+        statistics.cache_misses = measurement.GetCacheMisses();
+        return statistics;
+    }
+}
@@ -0,0 +1,175 @@
+#include <AllocationPatterns.hpp>
+#include <ArenaBenchmark.hpp>
+#include <BenchmarkHarness.hpp>
+#include <Arena/AllocationTrace.hpp>
+#include <Log.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Synapse;
+using namespace Synapse::Benchmark;
+
+namespace {
+    /**
+     * @brief An allocation sequence and what it demands from the allocator replaying it.
+     */
+    struct NamedReplay {
+        std::string name;
+        FreeOrder free_order;
+        bool cross_thread;
+        Memory::Arena::AllocationReplay replay;
+    };
+
+    struct MemoryBenchmarkContext {
+        const BenchmarkOptions &options;
+        BenchmarkReport &report;
+        CacheMissCounter &counter;
+        PatternParameters parameters;
+        std::size_t area_size;
+        std::vector<NamedReplay> traces;
+    };
+
+    auto PrintUsage() -> void {
+        std::println("Usage: MemoryBenchmark [trace.alat ...] [--format text|csv|json] [--output <path>] [--filter <text>]");
+        std::println("                       [--repetitions <n>] [--operations <n>] [--area-size <bytes>]");
+        std::println("  Runs synthetic patterns and the given allocation traces through every allocator and");
+        std::println("  MemoryArena policy combination. Case names are Allocator/Thread/Bounds/Tracking/Tagging/Pattern.");
+    }
+
+    template <typename TValue>
+    auto ParseNumber(const std::optional<std::string_view> text, TValue &value) -> bool {
+        return !text || (std::from_chars(text->data(), text->data() + text->size(), value).ec == std::errc{});
+    }
+
+    /**
+     * @brief Synthetic patterns, with sizes and alignments clamped to what the allocator can serve.
+     */
+    template <class TAllocatorConfig>
+    auto MakePatterns(PatternParameters parameters) -> std::vector<NamedReplay> {
+        parameters.max_size = std::min(parameters.max_size, TAllocatorConfig::MAX_SIZE);
+        parameters.max_alignment = std::min(parameters.max_alignment, TAllocatorConfig::MAX_ALIGNMENT);
+        parameters.min_size = std::min(parameters.min_size, parameters.max_size);
+
+        std::vector<NamedReplay> patterns{};
+        patterns.push_back(NamedReplay{ "Bulk", FreeOrder::None, false, MakeBulkPattern(parameters) });
+        patterns.push_back(NamedReplay{ "Lifo", FreeOrder::Lifo, false, MakeLifoPattern(parameters) });
+        patterns.push_back(NamedReplay{ "Fifo", FreeOrder::Any, false, MakeFifoPattern(parameters) });
+        patterns.push_back(NamedReplay{ "Random", FreeOrder::Any, false, MakeRandomPattern(parameters) });
+        patterns.push_back(NamedReplay{ "CrossThread", FreeOrder::Any, true, MakeBulkPattern(parameters) });
+        return patterns;
+    }
+
+    template <class TAllocatorConfig, class TThreadConfig, class TBoundsChecking, class TMemoryTracking, class TMemoryTagging>
+    auto RunConfiguration(MemoryBenchmarkContext &context, const std::vector<NamedReplay> &patterns) -> void {
+        using Fixture = ArenaFixture<TAllocatorConfig, TThreadConfig, TBoundsChecking, TMemoryTracking, TMemoryTagging>;
+
+        std::optional<Fixture> fixture{};
+        std::vector<LiveBlock> slots{};
+        const auto run_replay = [&](const NamedReplay &replay) {
+            if (TAllocatorConfig::FREE_ORDER < replay.free_order) {
+                return;
+            }
+            if (replay.cross_thread && !TThreadConfig::MULTI_THREADED) {
+                return;
+            }
+            const std::string name{ Fixture::GetName() + "/" + replay.name };
+            if (!context.options.Matches(name)) {
+                return;
+            }
+            if (!fixture) {
+                fixture.emplace(context.area_size);
+            }
+
+            std::vector<RunStatistics> runs{};
+            for (std::uint32_t i = 0U; i < context.options.repetitions; ++i) {
+                auto &arena{ fixture->MakeArena() };
+                if constexpr (TThreadConfig::MULTI_THREADED && (TAllocatorConfig::FREE_ORDER == FreeOrder::Any)) {
+                    if (replay.cross_thread) {
+                        runs.push_back(RunCrossThread(arena, fixture->GetAreaStart(), replay.replay, context.counter));
+                        continue;
+                    }
+                }
+                runs.push_back(RunReplay<TAllocatorConfig::FREE_ORDER>(arena, fixture->GetAreaStart(), replay.replay, slots,
+                        context.counter));
+            }
+            context.report.Add(Summarise(name, runs));
+        };
+
+        for (const NamedReplay &pattern : patterns) {
+            run_replay(pattern);
+        }
+        for (const NamedReplay &trace : context.traces) {
+            run_replay(trace);
+        }
+    }
+
+    template <class TAllocatorConfig>
+    auto RunAllocator(MemoryBenchmarkContext &context) -> void {
+        const std::vector<NamedReplay> patterns{ MakePatterns<TAllocatorConfig>(context.parameters) };
+        ForEachType(ThreadConfigs{}, [&]<class TThreadConfig>() {
+            ForEachType(BoundsCheckingPolicies{}, [&]<class TBoundsChecking>() {
+                ForEachType(MemoryTrackingPolicies{}, [&]<class TMemoryTracking>() {
+                    ForEachType(MemoryTaggingPolicies{}, [&]<class TMemoryTagging>() {
+                        RunConfiguration<TAllocatorConfig, TThreadConfig, TBoundsChecking, TMemoryTracking, TMemoryTagging>(
+                                context, patterns);
+                    });
+                });
+            });
+        });
+    }
+}
+
+auto main(int argc, char **argv) -> int {
+    const std::optional<BenchmarkOptions> options{ ParseBenchmarkOptions(argc, argv) };
+    if (!options) {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    Log::Log::Initialise(false);
+
+    BenchmarkReport report{ "Memory" };
+    CacheMissCounter counter{};
+    MemoryBenchmarkContext context{
+        .options = *options,
+        .report = report,
+        .counter = counter,
+        .parameters = PatternParameters{},
+        .area_size = 128U * 1024U * 1024U,
+        .traces = {}
+    };
+    if (!ParseNumber(options->Find("--operations"), context.parameters.operations) ||
+            !ParseNumber(options->Find("--area-size"), context.area_size)) {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    for (const std::string_view trace_path : options->positional) {
+        const std::optional<Memory::Arena::AllocationTrace> trace{ Memory::Arena::AllocationTrace::Load(trace_path) };
+        if (!trace) {
+            return EXIT_FAILURE;
+        }
+        const std::string file_name{ std::filesystem::path{ trace_path }.stem().string() };
+        context.traces.push_back(NamedReplay{ "Trace:" + file_name, FreeOrder::Any, false, trace->BuildReplay() });
+    }
+
+    if (!counter.IsAvailable()) {
+        std::println(stderr, "Hardware cache miss counter unavailable, check perf_event_paranoid");
+    }
+
+    ForEachType(AllocatorConfigs{}, [&]<class TAllocatorConfig>() { RunAllocator<TAllocatorConfig>(context); });
+
+    if (!report.Write(*options)) {
+        std::println(stderr, "Failed to open {}", options->output_path);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
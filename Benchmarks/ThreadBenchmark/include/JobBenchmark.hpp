@@ -0,0 +1,127 @@
+#pragma once
+#include <BenchmarkHarness.hpp>
+#include <Job/GlobalQueue.hpp>
+#include <Job/Job.hpp>
+#include <Job/JobQueue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Synapse::Benchmark {
+    /**
+     * @brief How jobs are posted: on the thread that runs them, or from a second thread.
+     */
+    enum class JobPostMode : std::uint8_t { SAME_THREAD, CROSS_THREAD };
+
+    /**
+     * @brief The job the Thread module's one replaces: a `std::function` in a `shared_ptr`, queued behind a mutex and drained in bulk.
+     */
+    class SharedJobQueue {
+    public:
+        struct Job {
+            explicit Job(std::function<void()> &&callback) : callback(std::move(callback)) {}
+            std::function<void()> callback;
+        };
+
+        template <typename TCallable>
+        auto Post(TCallable &&callable) -> void {
+            std::shared_ptr<Job> job{ std::make_shared<Job>(std::function<void()>(std::forward<TCallable>(callable))) };
+            std::scoped_lock lock{ m_mutex };
+            m_jobs.push_back(std::move(job));
+        }
+
+        auto RunAll() -> std::uint64_t {
+            std::vector<std::shared_ptr<Job>> jobs{};
+            {
+                std::scoped_lock lock{ m_mutex };
+                jobs.assign(m_jobs.begin(), m_jobs.end());
+                m_jobs.clear();
+            }
+            for (const std::shared_ptr<Job> &job : jobs) {
+                job->callback();
+            }
+            return jobs.size();
+        }
+
+    private:
+        std::mutex m_mutex{};
+        std::deque<std::shared_ptr<Job>> m_jobs{};
+    };
+
+    /**
+     * @brief The jobs of the Thread module: pooled `Job`s pushed into a `JobQueue`, which the GlobalQueue runs.
+     *
+     * Posting only pushes, as from a thread that is already running a queue, so the queue is handed to
+     * the GlobalQueue and `RunAll` drains it from there like a worker would.
+     */
+    class ThreadJobQueue {
+    public:
+        template <typename TCallable>
+        auto Post(TCallable &&callable) -> void {
+            (void)m_queue->Push(CoreThread::Job::Job::Create([this, callable = std::forward<TCallable>(callable)] {
+                callable();
+                ++m_executed;
+            }), true);
+        }
+
+        auto RunAll() -> std::uint64_t {
+            const std::uint64_t before{ m_executed };
+            while (Global::GGlobalQueue->TryExecute()) {
+            }
+            return m_executed - before;
+        }
+
+    private:
+        std::shared_ptr<CoreThread::Job::JobQueue> m_queue{ std::make_shared<CoreThread::Job::JobQueue>() };
+        std::uint64_t m_executed{ 0U };  ///< Running thread only.
+    };
+
+    /**
+     * @brief Posts and runs `job_count` jobs capturing a pointer and a value, the common shape of a job.
+     * @return Wall time in nanoseconds.
+     */
+    template <typename TQueue>
+    auto RunJobPost(const std::uint64_t job_count, const JobPostMode mode) -> double {
+        constexpr std::uint64_t BATCH_SIZE{ 256U };
+        TQueue queue{};
+        std::uint64_t sum{ 0U };
+        const auto post = [&queue, &sum](const std::uint64_t value) {
+            queue.Post([target = &sum, value] { *target += value; });
+        };
+
+        const auto begin{ std::chrono::steady_clock::now() };
+        if (mode == JobPostMode::SAME_THREAD) {
+            for (std::uint64_t posted = 0U; posted < job_count;) {
+                for (std::uint64_t i = 0U; (i < BATCH_SIZE) && (posted < job_count); ++i, ++posted) {
+                    post(posted);
+                }
+                (void)queue.RunAll();
+            }
+        } else {
+            std::atomic<std::uint64_t> posted{ 0U };
+            std::jthread producer{ [&] {
+                for (std::uint64_t i = 0U; i < job_count; ++i) {
+                    post(i);
+                    posted.store(i + 1U, std::memory_order_release);
+                }
+            } };
+            for (std::uint64_t executed = 0U; executed < job_count;) {
+                executed += queue.RunAll();
+                if (executed == posted.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        const double nanoseconds{ std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count() };
+        DoNotOptimise(sum);
+        return nanoseconds;
+    }
+}
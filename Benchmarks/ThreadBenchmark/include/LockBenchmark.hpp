@@ -0,0 +1,123 @@
+#pragma once
+#include <BenchmarkHarness.hpp>
+#include <Concurrent/AdaptiveSharedMutex.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace Synapse::Benchmark {
+    /**
+     * @brief The lock the adaptive one replaces: compare-exchange spinning, then yielding forever, no writer preference.
+     */
+    class SpinYieldLock {
+    public:
+        auto Lock() noexcept -> void {
+            while (true) {
+                for (std::uint32_t spin = 0U; spin < MAX_SPIN_COUNT; ++spin) {
+                    std::uint32_t expected{ 0U };
+                    if (m_state.compare_exchange_strong(expected, WRITE_FLAG)) {
+                        return;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        auto Unlock() noexcept -> void { m_state.store(0U); }
+
+        auto LockShared() noexcept -> void {
+            while (true) {
+                for (std::uint32_t spin = 0U; spin < MAX_SPIN_COUNT; ++spin) {
+                    std::uint32_t expected{ m_state.load() & READ_COUNT_MASK };
+                    if (m_state.compare_exchange_strong(expected, expected + 1U)) {
+                        return;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        auto UnlockShared() noexcept -> void { (void)m_state.fetch_sub(1U); }
+
+    private:
+        static constexpr std::uint32_t MAX_SPIN_COUNT{ 5000U };
+        static constexpr std::uint32_t WRITE_FLAG{ 0x0001'0000U };
+        static constexpr std::uint32_t READ_COUNT_MASK{ 0x0000'FFFFU };
+
+        std::atomic<std::uint32_t> m_state{ 0U };
+    };
+
+    class SharedMutexLock {
+    public:
+        auto Lock() -> void { m_mutex.lock(); }
+        auto Unlock() -> void { m_mutex.unlock(); }
+        auto LockShared() -> void { m_mutex.lock_shared(); }
+        auto UnlockShared() -> void { m_mutex.unlock_shared(); }
+
+    private:
+        std::shared_mutex m_mutex{};
+    };
+
+    /**
+     * @brief Shape of the contention: how often a thread writes, and how long it holds the lock.
+     */
+    struct LockContentionParameters {
+        std::uint64_t iterations{ 1U << 16U };  ///< Acquisitions per thread.
+        std::uint32_t write_percent{ 10U };
+        std::uint32_t hold_work{ 32U };         ///< Iterations of a dependent multiply-add chain while holding the lock.
+        std::uint32_t outside_work{ 128U };     ///< The same between acquisitions.
+    };
+
+    /**
+     * @brief Runs `thread_count` threads acquiring one lock, each reading or writing a small shared record.
+     * @return Wall time until the last thread finished, in nanoseconds.
+     */
+    template <typename TLock>
+    auto RunLockContention(const std::uint32_t thread_count, const LockContentionParameters &parameters) -> double {
+        TLock lock{};
+        std::array<std::uint64_t, 8> record{};
+        std::atomic<bool> start{ false };
+        const auto work = [](std::uint64_t value, const std::uint32_t rounds) {
+            for (std::uint32_t i = 0U; i < rounds; ++i) {
+                value = (value * 6364136223846793005ULL) + 1442695040888963407ULL;
+            }
+            return value;
+        };
+
+        std::vector<std::jthread> threads{};
+        for (std::uint32_t index = 0U; index < thread_count; ++index) {
+            threads.emplace_back([&, index] {
+                while (!start.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                std::uint64_t local{ index + 1U };
+                for (std::uint64_t i = 0U; i < parameters.iterations; ++i) {
+                    local = work(local, parameters.outside_work);
+                    // Spread the writes evenly, about write_percent of every 100 acquisitions
+                    if (((i * parameters.write_percent) % 100U) < parameters.write_percent) {
+                        lock.Lock();
+                        record[i % record.size()] = work(record[i % record.size()] + local, parameters.hold_work);
+                        lock.Unlock();
+                    } else {
+                        lock.LockShared();
+                        local += work(record[i % record.size()], parameters.hold_work);
+                        lock.UnlockShared();
+                    }
+                }
+                DoNotOptimise(local);
+            });
+        }
+
+        const auto begin{ std::chrono::steady_clock::now() };
+        start.store(true, std::memory_order_release);
+        threads.clear();
+        const double nanoseconds{ std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count() };
+        DoNotOptimise(record);
+        return nanoseconds;
+    }
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include <BenchmarkHarness.hpp>
+#include <Concurrent/WorkStealingScheduler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace Synapse::Benchmark {
+    /**
+     * @brief The scheduler the work-stealing one replaces: one queue behind one mutex, shared by every worker.
+     */
+    template <typename TItem>
+    class MutexQueueScheduler {
+    public:
+        static constexpr std::uint32_t NO_WORKER{ 0xFFFFFFFFU };
+
+        explicit MutexQueueScheduler([[maybe_unused]] const std::uint32_t worker_count) noexcept {}
+
+        [[nodiscard]] auto RegisterWorker() noexcept -> std::uint32_t { return m_registered.fetch_add(1U, std::memory_order_relaxed); }
+
+        auto Push(const TItem item, [[maybe_unused]] const std::uint32_t worker) -> void {
+            {
+                std::scoped_lock lock{ m_mutex };
+                m_items.push_back(item);
+            }
+            m_condition.notify_one();
+        }
+
+        [[nodiscard]] auto Pop([[maybe_unused]] const std::uint32_t worker) -> std::optional<TItem> {
+            std::scoped_lock lock{ m_mutex };
+            if (m_items.empty()) {
+                return std::nullopt;
+            }
+            const TItem item{ m_items.front() };
+            m_items.pop_front();
+            return item;
+        }
+
+        auto Park(const std::chrono::steady_clock::time_point deadline) -> void {
+            std::unique_lock lock{ m_mutex };
+            (void)m_condition.wait_until(lock, deadline, [&] { return !m_items.empty(); });
+        }
+
+    private:
+        std::mutex m_mutex{};
+        std::condition_variable m_condition{};
+        std::deque<TItem> m_items{};
+        std::atomic<std::uint32_t> m_registered{ 0U };
+    };
+
+    /**
+     * @brief Fork-join tree of tasks: every task above the leaves pushes two children, every task does a little work.
+     */
+    struct TaskTreeParameters {
+        std::uint32_t depth{ 16U };
+        std::uint32_t work_per_task{ 256U };  ///< Iterations of a dependent multiply-add chain.
+
+        [[nodiscard]] constexpr auto GetTaskCount() const noexcept -> std::uint64_t { return (std::uint64_t{ 2U } << depth) - 1U; }
+    };
+
+    /**
+     * @brief Runs one task tree on `thread_count` workers.
+     * @return Wall time from pushing the root to the last task finishing, in nanoseconds.
+     */
+    template <template <typename> class TScheduler>
+    auto RunTaskTree(const std::uint32_t thread_count, const TaskTreeParameters &parameters) -> double {
+        // An item is the depth of the task below the leaves
+        TScheduler<std::uint32_t> scheduler{ thread_count };
+        const std::uint64_t total{ parameters.GetTaskCount() };
+        std::atomic<std::uint64_t> completed{ 0U };
+        std::atomic<bool> start{ false };
+
+        const auto worker_loop = [&] {
+            const std::uint32_t worker{ scheduler.RegisterWorker() };
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            while (completed.load(std::memory_order_relaxed) < total) {
+                const std::optional<std::uint32_t> depth{ scheduler.Pop(worker) };
+                if (!depth) {
+                    scheduler.Park(std::chrono::steady_clock::now() + std::chrono::microseconds(100));
+                    continue;
+                }
+                if (*depth > 0U) {
+                    scheduler.Push(*depth - 1U, worker);
+                    scheduler.Push(*depth - 1U, worker);
+                }
+                std::uint64_t value{ *depth };
+                for (std::uint32_t i = 0U; i < parameters.work_per_task; ++i) {
+                    value = (value * 6364136223846793005ULL) + 1442695040888963407ULL;
+                }
+                DoNotOptimise(value);
+                (void)completed.fetch_add(1U, std::memory_order_relaxed);
+            }
+        };
+
+        std::vector<std::jthread> workers{};
+        workers.reserve(thread_count);
+        for (std::uint32_t i = 0U; i < thread_count; ++i) {
+            (void)workers.emplace_back(worker_loop);
+        }
+        const auto begin{ std::chrono::steady_clock::now() };
+        start.store(true, std::memory_order_release);
+        scheduler.Push(parameters.depth, TScheduler<std::uint32_t>::NO_WORKER);
+        workers.clear();
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+    }
+}
@@ -0,0 +1,153 @@
+#include <BenchmarkHarness.hpp>
+#include <JobBenchmark.hpp>
+#include <LockBenchmark.hpp>
+#include <SchedulerBenchmark.hpp>
+#include <Concurrent/AdaptiveSharedMutex.hpp>
+#include <Concurrent/WorkStealingScheduler.hpp>
+
+#include <charconv>
+#include <cstdlib>
+#include <format>
+#include <optional>
+#include <print>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace Synapse;
+using namespace Synapse::Benchmark;
+
+namespace {
+    auto PrintUsage() -> void {
+        std::println("Usage: ThreadBenchmark [--format text|csv|json] [--output <path>] [--filter <text>] [--repetitions <n>]");
+        std::println("                       [--max-threads <n>] [--depth <n>] [--work <n>] [--jobs <n>]");
+        std::println("                       [--lock-iterations <n>] [--write-percent <n>]");
+        std::println("  Runs a fork-join task tree on 1, 2, 4, ... up to --max-threads workers with the work-stealing");
+        std::println("  scheduler and with a single mutex protected queue. Case names are Scheduler/Threads.");
+        std::println("  Posts and runs --jobs jobs through a JobQueue and as shared std::function jobs, on the running");
+        std::println("  thread and from a second thread. Case names are Job/Representation/Mode.");
+        std::println("  Contends one reader-writer lock from 1, 2, 4, ... threads with --write-percent writes, as the");
+        std::println("  adaptive lock, std::shared_mutex and the former spin-then-yield lock. Case names are Lock/Kind/Threads.");
+    }
+
+    template <typename TValue>
+    auto ParseNumber(const std::optional<std::string_view> text, TValue &value) -> bool {
+        return !text || (std::from_chars(text->data(), text->data() + text->size(), value).ec == std::errc{});
+    }
+
+    template <template <typename> class TScheduler>
+    auto RunScheduler(const std::string_view scheduler_name, const BenchmarkOptions &options, const std::uint32_t max_threads,
+            const TaskTreeParameters &parameters, BenchmarkReport &report) -> void {
+        for (std::uint32_t threads = 1U; threads <= max_threads; threads *= 2U) {
+            const std::string name{ std::format("{}/{}", scheduler_name, threads) };
+            if (!options.Matches(name)) {
+                continue;
+            }
+            double best{ 0.0 };
+            for (std::uint32_t i = 0U; i < options.repetitions; ++i) {
+                const double nanoseconds{ RunTaskTree<TScheduler>(threads, parameters) };
+                best = (i == 0U) ? nanoseconds : std::min(best, nanoseconds);
+            }
+            const std::uint64_t tasks{ parameters.GetTaskCount() };
+            report.Add(BenchmarkResult{
+                .name = name,
+                .operations = tasks,
+                .nanoseconds_per_operation = best / static_cast<double>(tasks),
+                .cache_misses = std::nullopt,
+                .metrics = {
+                    { "threads", static_cast<double>(threads) },
+                    { "tasks_per_second", static_cast<double>(tasks) * 1.0e9 / best }
+                }
+            });
+        }
+    }
+
+    template <typename TQueue>
+    auto RunJobs(const std::string_view representation, const BenchmarkOptions &options, const std::uint64_t job_count,
+            BenchmarkReport &report) -> void {
+        for (const auto &[mode, mode_name] : { std::pair{ JobPostMode::SAME_THREAD, "SameThread" }, std::pair{ JobPostMode::CROSS_THREAD, "CrossThread" } }) {
+            const std::string name{ std::format("Job/{}/{}", representation, mode_name) };
+            if (!options.Matches(name)) {
+                continue;
+            }
+            double best{ 0.0 };
+            for (std::uint32_t i = 0U; i < options.repetitions; ++i) {
+                const double nanoseconds{ RunJobPost<TQueue>(job_count, mode) };
+                best = (i == 0U) ? nanoseconds : std::min(best, nanoseconds);
+            }
+            report.Add(BenchmarkResult{
+                .name = name,
+                .operations = job_count,
+                .nanoseconds_per_operation = best / static_cast<double>(job_count),
+                .cache_misses = std::nullopt,
+                .metrics = {
+                    { "jobs_per_second", static_cast<double>(job_count) * 1.0e9 / best }
+                }
+            });
+        }
+    }
+
+    template <typename TLock>
+    auto RunLocks(const std::string_view lock_name, const BenchmarkOptions &options, const std::uint32_t max_threads,
+            const LockContentionParameters &parameters, BenchmarkReport &report) -> void {
+        for (std::uint32_t threads = 1U; threads <= max_threads; threads *= 2U) {
+            const std::string name{ std::format("Lock/{}/{}", lock_name, threads) };
+            if (!options.Matches(name)) {
+                continue;
+            }
+            double best{ 0.0 };
+            for (std::uint32_t i = 0U; i < options.repetitions; ++i) {
+                const double nanoseconds{ RunLockContention<TLock>(threads, parameters) };
+                best = (i == 0U) ? nanoseconds : std::min(best, nanoseconds);
+            }
+            const std::uint64_t acquisitions{ parameters.iterations * threads };
+            report.Add(BenchmarkResult{
+                .name = name,
+                .operations = acquisitions,
+                .nanoseconds_per_operation = best / static_cast<double>(acquisitions),
+                .cache_misses = std::nullopt,
+                .metrics = {
+                    { "threads", static_cast<double>(threads) },
+                    { "write_percent", static_cast<double>(parameters.write_percent) },
+                    { "acquisitions_per_second", static_cast<double>(acquisitions) * 1.0e9 / best }
+                }
+            });
+        }
+    }
+}
+
+auto main(int argc, char **argv) -> int {
+    const std::optional<BenchmarkOptions> options{ ParseBenchmarkOptions(argc, argv) };
+    if (!options) {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    std::uint32_t max_threads{ 64U };
+    TaskTreeParameters parameters{};
+    std::uint64_t job_count{ 1U << 20U };
+    LockContentionParameters lock_parameters{};
+    if (!ParseNumber(options->Find("--max-threads"), max_threads) || !ParseNumber(options->Find("--depth"), parameters.depth) ||
+            !ParseNumber(options->Find("--work"), parameters.work_per_task) || !ParseNumber(options->Find("--jobs"), job_count) ||
+            !ParseNumber(options->Find("--lock-iterations"), lock_parameters.iterations) ||
+            !ParseNumber(options->Find("--write-percent"), lock_parameters.write_percent) ||
+            (parameters.depth > 30U) || (job_count == 0U) || (lock_parameters.write_percent > 100U)) {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    BenchmarkReport report{ "Thread" };
+    RunScheduler<STL::Concurrent::WorkStealingScheduler>("WorkStealing", *options, max_threads, parameters, report);
+    RunScheduler<MutexQueueScheduler>("MutexQueue", *options, max_threads, parameters, report);
+    RunJobs<ThreadJobQueue>("JobQueue", *options, job_count, report);
+    RunJobs<SharedJobQueue>("Shared", *options, job_count, report);
+    RunLocks<STL::Concurrent::AdaptiveSharedMutex>("Adaptive", *options, max_threads, lock_parameters, report);
+    RunLocks<SharedMutexLock>("SharedMutex", *options, max_threads, lock_parameters, report);
+    RunLocks<SpinYieldLock>("SpinYield", *options, max_threads, lock_parameters, report);
+
+    if (!report.Write(*options)) {
+        std::println(stderr, "Failed to open {}", options->output_path);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
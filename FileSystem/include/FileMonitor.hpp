@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <deque>
 #include <filesystem>
+#include <memory_resource>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -29,6 +30,10 @@ namespace Synapse::FileSystem {
         };
 
         FileMonitor() = default;
+        /**
+         * @brief The queue of changed files allocates from `resource`, e.g. an `ArenaMemoryResource`.
+         */
+        explicit FileMonitor(std::pmr::memory_resource *resource) : m_change_file_group(resource) {}
         ~FileMonitor() = default;
 
         auto Add(std::unique_ptr<FileMonitorInfo> init) -> bool;
@@ -45,7 +50,7 @@ namespace Synapse::FileSystem {
     private:
         std::vector<std::thread> m_threads{};
         std::vector<std::unique_ptr<FileMonitorInfo>> m_monitor_info{};
-        std::deque<std::filesystem::path> m_change_file_group{};
+        std::pmr::deque<std::filesystem::path> m_change_file_group{};
         std::mutex m_monitor_mutex{};
         std::atomic_flag m_is_running{};
     };
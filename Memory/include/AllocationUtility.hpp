@@ -2,7 +2,10 @@
 #include <algorithm>
 #include <bit>
 #include <cstddef>
+#include <new>
 #include <source_location>
+#include <type_traits>
+#include <libassert/assert.hpp>
 
 namespace Synapse::Memory::Allocator {
     /**
@@ -74,6 +77,10 @@ namespace Synapse::Memory::Allocator {
 
     /**
      * @brief Calls the destructor and frees memory using the arena.
+     *
+     * The memory is returned with its size and alignment, so the allocator does not need a
+     * stored size. A non-final polymorphic object may be a base subobject of a larger
+     * allocation, those are freed through the unsized path.
      */
     template<typename T, class TArena>
     auto Delete(T *object, TArena &arena) noexcept -> void {
@@ -82,7 +89,11 @@ namespace Synapse::Memory::Allocator {
         object->~T();
 
         // ...and free the associated memory
-        arena.Deallocate(object);
+        if constexpr (std::is_polymorphic_v<T> && !std::is_final_v<T>) {
+            arena.Deallocate(std::bit_cast<std::byte *>(object));
+        } else {
+            arena.Deallocate(std::bit_cast<std::byte *>(object), sizeof(T), alignof(T));
+        }
     }
 
     /**
@@ -91,46 +102,28 @@ namespace Synapse::Memory::Allocator {
     template<typename TType, class TArena>
     auto DeleteArray(TType *ptr, TArena &arena) noexcept -> void {
         DEBUG_ASSERT(ptr != nullptr, "Invalid pointer");
-
-        // user pointer points to the first instance...
-        std::byte *pointer = std::bit_cast<std::byte *>(ptr);
-
-        if constexpr (std::is_trivially_default_constructible_v<TType>) {
-            if constexpr (alignof(TType) > alignof(std::size_t)) {
-                arena.Deallocate(pointer - sizeof(TType));
-            } else {
-                arena.Deallocate(pointer - sizeof(std::size_t));
-            }
-        } else {
-            std::size_t N;
-
-            if constexpr (alignof(TType) > alignof(std::size_t)) {
-                // ...so go to the last sizeof(std::size_t) bytes and grab a number of instances
-                (void)std::copy_n(pointer - sizeof(TType), sizeof(std::size_t), std::bit_cast<std::byte *>(&N));
-
-                // call instances' destructor in reverse order
-                for (std::size_t i = N; i > 0; --i) {
-                    ptr[i - 1].~TType();
-                }
-
-                arena.Deallocate(pointer - sizeof(TType));
-            } else {
-                // ...so go back sizeof(std::size_t) bytes and grab a number of instances
-                (void)std::copy_n(pointer - sizeof(std::size_t), sizeof(std::size_t), std::bit_cast<std::byte *>(&N));
-
-                // call instances' destructor in reverse order
-                for (std::size_t i = N; i > 0; --i) {
-                    ptr[i - 1].~TType();
-                }
-
-                arena.Deallocate(pointer - sizeof(std::size_t));
+        // NewArray keeps the count in an extra element when the type is larger than the count
+        constexpr std::size_t HEADER_SIZE{ (sizeof(TType) > sizeof(std::size_t)) ? sizeof(TType) : sizeof(std::size_t) };
+
+        // user pointer points to the first instance, the number of instances is right in front of it
+        std::byte *pointer = std::bit_cast<std::byte *>(ptr) - HEADER_SIZE;
+        std::size_t N;
+        (void)std::copy_n(pointer, sizeof(std::size_t), std::bit_cast<std::byte *>(&N));
+
+        if constexpr (!std::is_trivially_destructible_v<TType>) {
+            // call instances' destructor in reverse order
+            for (std::size_t i = N; i > 0; --i) {
+                ptr[i - 1].~TType();
             }
         }
+
+        arena.Deallocate(pointer, HEADER_SIZE + (sizeof(TType) * N), alignof(TType));
     }
 }
 
 #define SYNAPSE_NEW(type, arena) new (arena.Allocate(sizeof(type), alignof(type))) type
 #define SYNAPSE_NEW_ARRAY(type, arena)                                                                                    \
-    Synapse::Alloc::NewArray<TypeAndCount<type>::Type>(arena, TypeAndCount<type>::Count)
-#define SYNAPSE_DELETE(object, arena) Synapse::Alloc::Delete(object, arena)
-#define SYNAPSE_DELETE_ARRAY(object, arena) Synapse::Alloc::DeleteArray(object, arena)
+    Synapse::Memory::Allocator::NewArray<Synapse::Memory::Allocator::TypeAndCount<type>::Type>(                        \
+            arena, Synapse::Memory::Allocator::TypeAndCount<type>::Count)
+#define SYNAPSE_DELETE(object, arena) Synapse::Memory::Allocator::Delete(object, arena)
+#define SYNAPSE_DELETE_ARRAY(object, arena) Synapse::Memory::Allocator::DeleteArray(object, arena)
@@ -0,0 +1,68 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Synapse::Memory::Allocator {
+    /**
+     * @brief Compile-time policy selecting how much safety logic and bookkeeping an allocator carries.
+     *
+     * - `CHECK_OVERFLOW`: when `false`, running out of memory is only caught by debug asserts and
+     *   the release fast path has no out of memory branch. Only use it when the area is sized
+     *   for the worst case.
+     * - `OffsetType`: width of the offsets and sizes stored in block headers. A 32-bit type halves
+     *   the headers, but limits the managed area to under 4 GiB.
+     * - `STORE_SIZE`: when `false`, allocators skip storing the requested size in their headers
+     *   and `GetAllocationSize` is unavailable. Blocks are then freed through the sized
+     *   `MemoryArena::Deallocate(ptr, size, alignment)`, which hands the size back to the
+     *   allocator and to the bounds checking, tagging and tracking policies.
+     *
+     * @tparam TCheckOverflow Keep the out of memory and size overflow checks in release builds.
+     * @tparam TOffsetType    Unsigned integer type used for offsets and sizes in headers.
+     * @tparam TStoreSize     Store the requested size in front of every block.
+     */
+    template <bool TCheckOverflow, std::unsigned_integral TOffsetType, bool TStoreSize>
+    struct AllocationChecking {
+        static constexpr bool CHECK_OVERFLOW{ TCheckOverflow };
+        static constexpr bool STORE_SIZE{ TStoreSize };
+        using OffsetType = TOffsetType;
+
+        /**
+         * @brief Largest area, in bytes, an allocator with this policy can manage.
+         */
+        static constexpr std::size_t MAX_AREA_SIZE{ std::numeric_limits<TOffsetType>::max() };
+    };
+
+    /**
+     * @brief Default: every check in place and full width headers.
+     */
+    using CheckedAllocation = AllocationChecking<true, std::size_t, true>;
+    /**
+     * @brief Release fast path: no overflow branches, 32-bit headers and no stored sizes.
+     */
+    using UncheckedAllocation = AllocationChecking<false, std::uint32_t, false>;
+
+    template <typename TPolicy>
+    concept AllocationCheckingPolicy = requires {
+        { TPolicy::CHECK_OVERFLOW } -> std::convertible_to<bool>;
+        { TPolicy::STORE_SIZE } -> std::convertible_to<bool>;
+        { TPolicy::MAX_AREA_SIZE } -> std::convertible_to<std::size_t>;
+        requires std::unsigned_integral<typename TPolicy::OffsetType>;
+    };
+
+    /**
+     * @brief Checks that `overhead + size` bytes starting at `ptr` end before `end`.
+     *
+     * Compares sizes rather than pointers, so a huge request cannot wrap around the address
+     * space and pass the check.
+     */
+    [[nodiscard]] inline auto FitsBefore(const std::byte *ptr, const std::byte *end, const std::size_t overhead,
+            const std::size_t size) noexcept -> bool {
+        if (ptr > end) {
+            return false;
+        }
+        const auto available{ static_cast<std::size_t>(end - ptr) };
+        return (available >= overhead) && (size <= (available - overhead));
+    }
+}
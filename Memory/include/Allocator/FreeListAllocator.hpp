@@ -1,8 +1,14 @@
 #pragma once
 #include <AlignmentUtility.hpp>
+#include <Allocator/AllocationChecking.hpp>
+#include <Allocator/FreeSpaceStatistics.hpp>
 #include <Log.hpp>
+#include <algorithm>
 #include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 #include <libassert/assert.hpp>
 
 
@@ -10,25 +16,49 @@ namespace Synapse::Memory::Allocator {
     /**
      * @brief Free-list allocator for variable sized allocations.
      *
-     * Maintains a singly linked list of free blocks and serves requests by
+     * Maintains an address ordered singly linked list of free blocks and serves requests by
      * either picking the best-fitting or first-fitting block depending on
      * `TBestFit`. All allocations store a small header to support size queries
-     * and deallocation.
+     * and deallocation, without `TChecked::STORE_SIZE` the size is left out and blocks are
+     * freed through the sized `Deallocate`. Freed blocks are merged with their free neighbours.
+     *
+     * Block boundaries are kept on `sizeof(NodeHeader)` granularity, so the space left over
+     * after carving an allocation out of a node is always either zero or large enough to hold
+     * a new free node.
+     *
+     * Links and headers store offsets from the start of the area, so a 32-bit
+     * `TChecked::OffsetType` halves both the free node and the allocation header.
      *
      * @tparam TOffset   Number of extra bytes reserved before the returned user pointer.
      * @tparam TBestFit  When `true`, searches for the smallest fitting free block;
      *                   otherwise uses the first fitting block.
+     * @tparam TChecked  Overflow checks and header layout, see `AllocationChecking`.
      */
-    template<std::size_t TOffset, bool TBestFit = true>
+    template<std::size_t TOffset, bool TBestFit = true, AllocationCheckingPolicy TChecked = CheckedAllocation>
     class FreeListAllocator {
+        using OffsetType = typename TChecked::OffsetType;
+
         struct NodeHeader {
+            OffsetType node_size;
+            OffsetType next_node_offset;
+        };
+        struct SizedHeader {
+            OffsetType allocation_size;
+            OffsetType allocation_reset_offset;
+        };
+        struct UnsizedHeader {
+            OffsetType allocation_reset_offset;
+        };
+        // Without a stored size, blocks can only be freed through the sized `Deallocate`
+        using AllocationHeader = std::conditional_t<TChecked::STORE_SIZE, SizedHeader, UnsizedHeader>;
+        // Decoded form of `NodeHeader`
+        struct Node {
             std::size_t node_size;
             std::byte *next_node_ptr;
         };
-        struct AllocationHeader {
-            std::size_t allocation_size;
-            std::byte *allocation_reset_ptr;
-        };
+
+        static constexpr std::size_t GRANULARITY{ sizeof(NodeHeader) };
+        static constexpr OffsetType NO_NODE{ std::numeric_limits<OffsetType>::max() };
 
     public:
         FreeListAllocator() = delete;
@@ -37,11 +67,10 @@ namespace Synapse::Memory::Allocator {
          * @param start Pointer to the first byte of the managed range.
          * @param end   Pointer one past the last byte of the managed range.
          */
-        FreeListAllocator(std::byte *start, std::byte *end) noexcept : m_start(start), m_end(end), m_current(m_start) {
-            const NodeHeader header{ .node_size = std::bit_cast<uintptr_t>(end) - std::bit_cast<uintptr_t>(start),
-                .next_node_ptr = nullptr };
-            // Store header
-            (void)std::copy_n(std::bit_cast<const std::byte *>(&header), sizeof(NodeHeader), m_current);
+        FreeListAllocator(std::byte *start, std::byte *end) noexcept :
+            m_start(Utility::AlignAddress(start, GRANULARITY)), m_end(end), m_current(nullptr) {
+            DEBUG_ASSERT(static_cast<std::size_t>(end - start) < TChecked::MAX_AREA_SIZE, "Area is too large for the header offset type.");
+            Reset();
         }
         /**
          * @brief Initializes the allocator with a start pointer and buffer size.
@@ -49,11 +78,7 @@ namespace Synapse::Memory::Allocator {
          * @param start Pointer to the first byte of the buffer.
          */
         FreeListAllocator(const std::size_t size, std::byte *start) noexcept :
-            m_start(start), m_end(start + size), m_current(m_start) {
-            const NodeHeader header{ .node_size = size, .next_node_ptr = nullptr };
-            // Store header
-            (void)std::copy_n(std::bit_cast<const std::byte *>(&header), sizeof(NodeHeader), m_current);
-        };
+            FreeListAllocator(start, start + size) {}
         ~FreeListAllocator() = default;
 
         FreeListAllocator(const FreeListAllocator &) = delete;
@@ -69,125 +94,82 @@ namespace Synapse::Memory::Allocator {
          * @return Pointer to the aligned memory block or nullptr on failure.
          */
         [[nodiscard]] auto Allocate(const std::size_t allocation_size, const std::size_t alignment) noexcept -> std::byte * {
-            DEBUG_ASSERT(std::has_single_bit(alignment) == 0, "Invalid alignment. Must be power of two.");
-            DEBUG_ASSERT(allocation_size >= 0, "Allocation has to be at least 1 byte");
-
-            // Find the best fitting slot approach
-            if constexpr (TBestFit) {
-                std::size_t smallest_difference = std::numeric_limits<std::size_t>::max();
-                const std::byte *node_before_best_node = nullptr;
-                std::byte *best_node = nullptr;
-
-                {
-                    const std::byte *previous_node = nullptr;
-                    std::byte *current_node = m_current;
-
-                    while (current_node != nullptr) {
-                        NodeHeader header{};
-                        (void)std::copy_n(current_node, sizeof(NodeHeader), static_cast<std::byte *>(&header));
-                        // Offset the pointer first, align it, and then offset it back
-                        std::byte *shifted_ptr =
-                                Utility::AlignAddress(current_node + sizeof(AllocationHeader) + TOffset, alignment) -
-                                (sizeof(AllocationHeader) + TOffset);
-                        std::size_t required_size = allocation_size + (std::bit_cast<uintptr_t>(shifted_ptr) -
-                                                                   std::bit_cast<uintptr_t>(current_node));
-                        if (const std::size_t remaining_size = header.node_size - required_size; (header.node_size >= required_size) && (remaining_size < smallest_difference)) {
-                            node_before_best_node = previous_node;
-                            best_node = current_node;
-                            smallest_difference = remaining_size;
-                            if (remaining_size == 0U) {
-                                break;
-                            }
-                        }
-                        previous_node = current_node;
-                        current_node = header.next_node_ptr;
-                    }
-                }
-                if (best_node != nullptr) {
-                    NodeHeader header{};
-                    (void)std::copy_n(best_node, sizeof(NodeHeader), static_cast<std::byte *>(&header));
-                    // Offset the pointer first, align it, and then offset it back
-                    std::byte *shifted_ptr = Utility::AlignAddress(best_node + sizeof(AllocationHeader) + TOffset, alignment) -
-                                             (sizeof(AllocationHeader) + TOffset);
-                    return ObtainNode(smallest_difference, allocation_size, shifted_ptr, node_before_best_node, best_node,
-                            header.next_node_ptr);
-                } else {
+            DEBUG_ASSERT(std::has_single_bit(alignment), "Invalid alignment. Must be power of two.");
+            DEBUG_ASSERT(allocation_size > 0U, "Allocation has to be at least 1 byte");
+
+            // Larger requests would wrap the block end computation around the address space
+            if constexpr (TChecked::CHECK_OVERFLOW) {
+                if ((allocation_size > GetSize()) || (alignment > GetSize())) {
                     CORE_DEBUG("FreeListAllocator out of memory!");
                     return nullptr;
                 }
+            } else {
+                DEBUG_ASSERT((allocation_size <= GetSize()) && (alignment <= GetSize()), "FreeListAllocator out of memory!");
             }
-            // Find the first fitting slot approach
-            else {
-                const std::byte *previous_node = nullptr;
-                std::byte *current_node = m_current;
-                while (current_node != nullptr) {
-                    NodeHeader header{};
-                    (void)std::copy_n(current_node, sizeof(NodeHeader), static_cast<std::byte *>(&header));
-                    // Offset the pointer first, align it, and then offset it back
-                    std::byte *shifted_ptr =
-                            Utility::AlignAddress(current_node + sizeof(AllocationHeader) + TOffset, alignment) -
-                            (sizeof(AllocationHeader) + TOffset);
-                    std::size_t required_size = allocation_size + (std::bit_cast<uintptr_t>(shifted_ptr) -
-                                           std::bit_cast<uintptr_t>(current_node));
-                    if (header.node_size >= required_size) {
-                        return ObtainNode(
-                                header.node_size - required_size, allocation_size, shifted_ptr, previous_node, current_node, header.next_node_ptr);
-                    }
 
-                    previous_node = current_node;
-                    current_node = header.next_node_ptr;
+            std::byte *previous_node = nullptr;
+            std::byte *current_node = m_current;
+
+            std::byte *node_before_best_node = nullptr;
+            std::byte *best_node = nullptr;
+            std::size_t best_required_size = 0U;
+            std::size_t smallest_difference = std::numeric_limits<std::size_t>::max();
+
+            while (current_node != nullptr) {
+                const Node header{ ReadNode(current_node) };
+                const std::size_t required_size{ RequiredSize(current_node, allocation_size, alignment) };
+
+                if ((header.node_size >= required_size) && ((header.node_size - required_size) < smallest_difference)) {
+                    node_before_best_node = previous_node;
+                    best_node = current_node;
+                    best_required_size = required_size;
+                    smallest_difference = header.node_size - required_size;
+                    // Find the first fitting slot approach, or the best fitting slot with a perfect fit
+                    if (!TBestFit || (smallest_difference == 0U)) {
+                        break;
+                    }
                 }
+                previous_node = current_node;
+                current_node = header.next_node_ptr;
+            }
+
+            if (best_node == nullptr) {
                 CORE_DEBUG("FreeListAllocator out of memory!");
                 return nullptr;
             }
+
+            return ObtainNode(best_node, node_before_best_node, best_required_size, allocation_size, alignment);
         }
 
         /**
          * @brief Returns a previously allocated block to the free list.
          * @param ptr Pointer returned by Allocate (optionally offset by `TOffset`).
          */
-        auto Deallocate(std::byte *ptr) noexcept -> void {
+        auto Deallocate(std::byte *ptr) noexcept -> void
+            requires TChecked::STORE_SIZE {
             DEBUG_ASSERT(ptr != nullptr, "Cannot deallocate a null pointer");
             DEBUG_ASSERT((ptr >= m_start) && (ptr < m_end), "Pointer was not allocated by the alloctor");
             AllocationHeader allocation_header{};
-            (void)std::copy_n(ptr - sizeof(AllocationHeader), sizeof(AllocationHeader), static_cast<std::byte *>(&allocation_header));
-
-            std::byte *previous_node = nullptr;
-            std::byte *current_node = m_current;
-            while (current_node != nullptr) {
-                NodeHeader node_header{};
-                (void)std::copy_n(current_node, sizeof(NodeHeader), static_cast<std::byte *>(&node_header));
-                if (allocation_header.allocation_reset_ptr < current_node) {
-                    break;
-                }
-                previous_node = current_node;
-                current_node = node_header.next_node_ptr;
-            }
+            (void)std::copy_n(ptr - sizeof(AllocationHeader), sizeof(AllocationHeader), std::bit_cast<std::byte *>(&allocation_header));
+            Release(ptr, allocation_header.allocation_reset_offset, allocation_header.allocation_size);
+        }
 
-            NodeHeader new_node{};
-            new_node.node_size = allocation_header.allocation_size;
-            if ((static_cast<const std::byte *>(ptr) + TOffset + allocation_header.allocation_size) == current_node) {
-                NodeHeader node{};
-                (void)std::copy_n(current_node, sizeof(NodeHeader), static_cast<std::byte *>(&node));
-                new_node.next_node_ptr = node.next_node_ptr;
-                new_node.node_size += node.node_size;
-            } else {
-                new_node.next_node_ptr = current_node;
-            }
-            if (previous_node != nullptr) {
-                NodeHeader node{};
-                (void)std::copy_n(current_node, sizeof(NodeHeader), static_cast<std::byte *>(&node));
-                if ((previous_node + node.node_size) == allocation_header.allocation_reset_ptr) {
-                    new_node += node.node_size;
-                    (void)std::copy_n(static_cast<std::byte *>(&new_node), sizeof(NodeHeader), previous_node);
-                } else {
-                    node.next_node_ptr = allocation_header.allocation_reset_ptr;
-                    (void)std::copy_n(static_cast<std::byte *>(&new_node), sizeof(NodeHeader), allocation_header.allocation_reset_ptr);
-                }
-            } else {
-                m_current = allocation_header.allocation_reset_ptr;
-                (void)std::copy_n(static_cast<std::byte *>(&new_node), sizeof(NodeHeader), m_current);
+        /**
+         * @brief Returns a previously allocated block to the free list, without reading its size from the header.
+         * @param ptr       Pointer returned by Allocate (optionally offset by `TOffset`).
+         * @param size      Size passed to Allocate.
+         * @param alignment Alignment passed to Allocate.
+         */
+        auto Deallocate(std::byte *ptr, const std::size_t size, [[maybe_unused]] const std::size_t alignment) noexcept -> void {
+            DEBUG_ASSERT(ptr != nullptr, "Cannot deallocate a null pointer");
+            DEBUG_ASSERT((ptr >= m_start) && (ptr < m_end), "Pointer was not allocated by the alloctor");
+            AllocationHeader allocation_header{};
+            (void)std::copy_n(ptr - sizeof(AllocationHeader), sizeof(AllocationHeader), std::bit_cast<std::byte *>(&allocation_header));
+            if constexpr (TChecked::STORE_SIZE) {
+                DEBUG_ASSERT(allocation_header.allocation_size == size, "Deallocation size does not match the allocation",
+                        allocation_header.allocation_size, size);
             }
+            Release(ptr, allocation_header.allocation_reset_offset, size);
         }
 
         /**
@@ -195,11 +177,12 @@ namespace Synapse::Memory::Allocator {
          * @param ptr Pointer inside the allocated block.
          * @return Size in bytes of the allocation.
          */
-        [[nodiscard]] auto GetAllocationSize(std::byte *ptr) const noexcept -> const std::size_t {
+        [[nodiscard]] auto GetAllocationSize(const std::byte *ptr) const noexcept -> std::size_t
+            requires TChecked::STORE_SIZE {
             DEBUG_ASSERT(ptr != nullptr, "Cannot get allocation size of a null pointer");
             DEBUG_ASSERT((ptr >= m_start) && (ptr < m_end), "Pointer was not allocated by the alloctor");
             AllocationHeader header{};
-            (void)copy_n(ptr - (sizeof(AllocationHeader) + TOffset), sizeof(AllocationHeader), static_cast<std::byte *>(&header));
+            (void)std::copy_n(ptr - (sizeof(AllocationHeader) + TOffset), sizeof(AllocationHeader), std::bit_cast<std::byte *>(&header));
             return header.allocation_size;
         }
 
@@ -207,26 +190,124 @@ namespace Synapse::Memory::Allocator {
          * @brief Resets the allocator to its initial state, invalidating all outstanding allocations.
          */
         auto Reset() noexcept -> void {
-            const NodeHeader header{ .node_size =
-                                                   std::bit_cast<uintptr_t>(m_end) - std::bit_cast<uintptr_t>(m_start),
-                .next_node_ptr = nullptr };
+            const std::size_t size{ static_cast<std::size_t>(m_end - m_start) & ~(GRANULARITY - 1U) };
             m_current = m_start;
-            (void)std::copy_n(std::bit_cast<const std::byte *>(&header), sizeof(AllocationHeader), m_current);
+            m_used = 0U;
+            WriteNode(m_current, Node{ .node_size = size, .next_node_ptr = nullptr });
+        }
+
+        /**
+         * @brief Gives access to the raw buffer start pointer.
+         */
+        [[nodiscard]] auto GetStart() const noexcept -> const std::byte * { return m_start; }
+        /**
+         * @brief Returns total managed capacity in bytes.
+         */
+        [[nodiscard]] auto GetSize() const noexcept -> std::size_t {
+            return std::bit_cast<uintptr_t>(m_end) - std::bit_cast<uintptr_t>(m_start);
+        }
+        /**
+         * @brief Reports bytes taken out of the free list, headers and alignment padding included.
+         */
+        [[nodiscard]] auto GetUsed() const noexcept -> std::size_t { return m_used; }
+        /**
+         * @brief Walks the free list, the cost grows with the number of free blocks.
+         */
+        [[nodiscard]] auto GetFreeSpace() const noexcept -> FreeSpaceStatistics {
+            FreeSpaceStatistics statistics{};
+            for (const std::byte *node = m_current; node != nullptr;) {
+                const Node header{ ReadNode(node) };
+                statistics.free_bytes += header.node_size;
+                ++statistics.free_block_count;
+                statistics.largest_free_block = std::max(statistics.largest_free_block, header.node_size);
+                node = header.next_node_ptr;
+            }
+            return statistics;
         }
 
     private:
+        // Inserts the block in front of `ptr` into the free list and merges it with its free neighbours
+        auto Release(std::byte *ptr, const std::size_t reset_offset, const std::size_t size) noexcept -> void {
+            std::byte *block_start{ m_start + reset_offset };
+            std::byte *block_end{ Utility::AlignAddress(ptr + TOffset + size, GRANULARITY) };
+
+            // Find the free nodes surrounding the block, the list is kept in address order
+            std::byte *previous_node = nullptr;
+            std::byte *next_node = m_current;
+            while ((next_node != nullptr) && (next_node < block_start)) {
+                previous_node = next_node;
+                next_node = ReadNode(next_node).next_node_ptr;
+            }
+
+            Node new_node{ .node_size = static_cast<std::size_t>(block_end - block_start), .next_node_ptr = next_node };
+            m_used -= new_node.node_size;
+            // Merge with the following free node
+            if (block_end == next_node) {
+                const Node next_header{ ReadNode(next_node) };
+                new_node.node_size += next_header.node_size;
+                new_node.next_node_ptr = next_header.next_node_ptr;
+            }
+
+            if (previous_node != nullptr) {
+                Node previous_header{ ReadNode(previous_node) };
+                // Merge with the preceding free node
+                if ((previous_node + previous_header.node_size) == block_start) {
+                    previous_header.node_size += new_node.node_size;
+                    previous_header.next_node_ptr = new_node.next_node_ptr;
+                    WriteNode(previous_node, previous_header);
+                    return;
+                }
+                previous_header.next_node_ptr = block_start;
+                WriteNode(previous_node, previous_header);
+            } else {
+                m_current = block_start;
+            }
+            WriteNode(block_start, new_node);
+        }
+
+        [[nodiscard]] auto ReadNode(const std::byte *node) const noexcept -> Node {
+            NodeHeader header{};
+            (void)std::copy_n(node, sizeof(NodeHeader), std::bit_cast<std::byte *>(&header));
+            return Node{
+                .node_size = header.node_size,
+                .next_node_ptr = (header.next_node_offset == NO_NODE) ? nullptr : m_start + header.next_node_offset
+            };
+        }
+
+        auto WriteNode(std::byte *node, const Node &decoded) const noexcept -> void {
+            const NodeHeader header{
+                .node_size = static_cast<OffsetType>(decoded.node_size),
+                .next_node_offset = (decoded.next_node_ptr == nullptr) ? NO_NODE : static_cast<OffsetType>(decoded.next_node_ptr - m_start)
+            };
+            (void)std::copy_n(std::bit_cast<const std::byte *>(&header), sizeof(NodeHeader), node);
+        }
+
+        /**
+         * @brief Offsets the pointer first, aligns it, and then offsets it back to find where the header goes.
+         */
+        [[nodiscard]] static auto HeaderAddress(std::byte *node, const std::size_t alignment) noexcept -> std::byte * {
+            return Utility::AlignAddress(node + sizeof(AllocationHeader) + TOffset, alignment) - (sizeof(AllocationHeader) + TOffset);
+        }
+
+        /**
+         * @brief Number of bytes an allocation consumes from the start of `node`, rounded to the block granularity.
+         */
+        [[nodiscard]] static auto RequiredSize(std::byte *node, const std::size_t size, const std::size_t alignment) noexcept -> std::size_t {
+            const std::byte *block_end{ Utility::AlignAddress(
+                    HeaderAddress(node, alignment) + sizeof(AllocationHeader) + TOffset + size, GRANULARITY) };
+            return static_cast<std::size_t>(block_end - node);
+        }
+
         /**
          * @brief Updates the freelist links after removing or splitting a node.
          * @param next_node     Pointer to the node that should follow `previous_node`.
          * @param previous_node Pointer to the node that precedes the updated position; may be nullptr when updating the head.
          */
-        auto AdjustLinkedList(std::byte *next_node, std::byte *previous_node) -> void {
+        auto AdjustLinkedList(std::byte *next_node, std::byte *previous_node) noexcept -> void {
             if (previous_node != nullptr) {
-                NodeHeader header_previous{};
-                (void)std::copy_n(
-                        previous_node, sizeof(NodeHeader), static_cast<std::byte *>(&header_previous));
+                Node header_previous{ ReadNode(previous_node) };
                 header_previous.next_node_ptr = next_node;
-                (void)std::copy_n(static_cast<std::byte *>(&header_previous), sizeof(NodeHeader), previous_node);
+                WriteNode(previous_node, header_previous);
             } else {
                 // we are at the start of the list, so we have to set the m_current pointer to the next node
                 m_current = next_node;
@@ -234,42 +315,42 @@ namespace Synapse::Memory::Allocator {
         }
 
         /**
-         * @brief Writes allocation metadata and optionally splits a node to satisfy a request.
-         * @param remaining_size Bytes left in the free block after the allocation.
-         * @param size            Requested allocation size.
-         * @param shifted_ptr     Pointer aligned for the allocation payload.
-         * @param previous_node   Node that precedes the allocated block in the freelist; may be nullptr.
-         * @param current_node    Node being consumed.
-         * @param next_node       Node that originally followed `current_node`.
+         * @brief Writes allocation metadata and splits the node if there is space left.
+         * @param node          Node being consumed.
+         * @param previous_node Node that precedes `node` in the freelist; may be nullptr.
+         * @param required_size Bytes of the node consumed by the allocation.
+         * @param size          Requested allocation size.
+         * @param alignment     Requested alignment.
          * @return Pointer to the user-accessible memory region.
          */
-        auto ObtainNode(const std::size_t remaining_size, const std::size_t size, std::byte *shifted_ptr,
-                const std::byte *previous_node, const std::byte *current_node,
-                const std::byte *next_node) -> std::byte * {
-            // Break the node into two parts if the remaining size is big enough
-            AllocationHeader header{};
-            header.allocation_reset_ptr = current_node;
-            if (remaining_size >= sizeof(NodeHeader)) {
-                header.allocation_size = size;
-                (void)std::copy_n(std::bit_cast<std::byte *>(&header), sizeof(AllocationHeader), shifted_ptr);
-
-                NodeHeader new_node{};
-                new_node.next_node_ptr = next_node;
-                new_node.node_size = remaining_size;
-                std::byte *new_node_ptr{ shifted_ptr + sizeof(AllocationHeader) + TOffset + size };
-                (void)std::copy_n(static_cast<std::byte *>(&new_node), sizeof(NodeHeader), new_node_ptr);
+        auto ObtainNode(std::byte *node, std::byte *previous_node, const std::size_t required_size,
+                const std::size_t size, const std::size_t alignment) noexcept -> std::byte * {
+            const Node header{ ReadNode(node) };
+            const std::size_t remaining_size{ header.node_size - required_size };
+            m_used += required_size;
+
+            // Break the node into two parts if there is anything left, the granularity guarantees a node fits
+            if (remaining_size > 0U) {
+                std::byte *new_node_ptr{ node + required_size };
+                WriteNode(new_node_ptr, Node{ .node_size = remaining_size, .next_node_ptr = header.next_node_ptr });
                 AdjustLinkedList(new_node_ptr, previous_node);
             } else {
-                header.allocation_size += size + remaining_size;
-                (void)std::copy_n(std::bit_cast<std::byte *>(&header), sizeof(AllocationHeader), shifted_ptr);
+                AdjustLinkedList(header.next_node_ptr, previous_node);
+            }
 
-                AdjustLinkedList(next_node, previous_node);
+            std::byte *header_ptr{ HeaderAddress(node, alignment) };
+            AllocationHeader allocation_header{};
+            allocation_header.allocation_reset_offset = static_cast<OffsetType>(node - m_start);
+            if constexpr (TChecked::STORE_SIZE) {
+                allocation_header.allocation_size = static_cast<OffsetType>(size);
             }
-            return shifted_ptr + sizeof(AllocationHeader);
+            (void)std::copy_n(std::bit_cast<const std::byte *>(&allocation_header), sizeof(AllocationHeader), header_ptr);
+            return header_ptr + sizeof(AllocationHeader);
         }
 
         std::byte *m_start;
         std::byte *m_end;
         std::byte *m_current;
+        std::size_t m_used{ 0U };
     };
 }
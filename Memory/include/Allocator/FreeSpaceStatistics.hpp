@@ -0,0 +1,13 @@
+#pragma once
+#include <cstddef>
+
+namespace Synapse::Memory::Allocator {
+    /**
+     * @brief Snapshot of the free space of an allocator.
+     */
+    struct FreeSpaceStatistics {
+        std::size_t free_bytes{ 0U };          ///< Bytes that can still be handed out, in total.
+        std::size_t free_block_count{ 0U };    ///< Number of separate free blocks.
+        std::size_t largest_free_block{ 0U };  ///< Size of the largest free block, bounds the largest request that can succeed.
+    };
+}
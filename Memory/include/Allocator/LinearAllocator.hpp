@@ -1,12 +1,15 @@
 #pragma once
 #include <AlignmentUtility.hpp>
+#include <Allocator/AllocationChecking.hpp>
+#include <Allocator/FreeSpaceStatistics.hpp>
 #include <Log.hpp>
 
 #include <libassert/assert.hpp>
 
+#include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <utility>
-#include <vadefs.h>
 
 namespace Synapse::Memory::Allocator {
     /**
@@ -25,12 +28,19 @@ namespace Synapse::Memory::Allocator {
      * padding between allocations.
      *
      * Use when lifetimes are uniform and you can discard all allocations at once.
+     *
+     * The requested size is stored in front of every block for `GetAllocationSize`. With a
+     * `TChecked` policy that does not store sizes the blocks are packed back to back.
      * 
-     * @tparam TOffset Number of bytes reserved immediately before the returned user pointer
-     *                 (e.g., for a small header, metadata, or back-pointer).
+     * @tparam TOffset  Number of bytes reserved immediately before the returned user pointer
+     *                  (e.g., for a small header, metadata, or back-pointer).
+     * @tparam TChecked Overflow checks and header layout, see `AllocationChecking`.
      */
-    template <std::size_t TOffset>
+    template <std::size_t TOffset, AllocationCheckingPolicy TChecked = CheckedAllocation>
     class LinearAllocator {
+        using OffsetType = typename TChecked::OffsetType;
+        static constexpr std::size_t HEADER_SIZE{ TChecked::STORE_SIZE ? sizeof(OffsetType) : 0U };
+
     public:
         LinearAllocator() = delete;
         /**
@@ -38,13 +48,15 @@ namespace Synapse::Memory::Allocator {
          * @param start Pointer to the first byte of the buffer.
          * @param end   Pointer one past the last byte of the buffer.
          */
-        LinearAllocator(std::byte* start, std::byte* end) noexcept : m_start(start), m_end(end), m_current(start) {};
+        LinearAllocator(std::byte* start, std::byte* end) noexcept : m_start(start), m_end(end), m_current(start) {
+            DEBUG_ASSERT(GetSize() <= TChecked::MAX_AREA_SIZE, "Area is too large for the header offset type.");
+        };
         /**
          * @brief Constructs the allocator with explicit size and start pointer.
          * @param size  Number of bytes to manage.
          * @param start Pointer to the first byte of the buffer.
          */
-        LinearAllocator(const std::size_t size, std::byte* start) noexcept : m_start(start), m_end(start + size), m_current(start) {};
+        LinearAllocator(const std::size_t size, std::byte* start) noexcept : LinearAllocator(start, start + size) {};
         ~LinearAllocator() = default;
 
         LinearAllocator(const LinearAllocator&) = delete;
@@ -61,22 +73,28 @@ namespace Synapse::Memory::Allocator {
          */
         [[nodiscard]] auto Allocate(const std::size_t size,
                 const std::size_t alignment) noexcept -> std::byte * {
-            DEBUG_ASSERT(std::has_single_bit(alignment) == 0, "Invalid alignment. Must be power of two.");
-            DEBUG_ASSERT(size >= 0, "Allocation has to be at least 1 byte");
+            DEBUG_ASSERT(std::has_single_bit(alignment), "Invalid alignment. Must be power of two.");
+            DEBUG_ASSERT(size > 0U, "Allocation has to be at least 1 byte");
 
-            std::byte* reset_ptr{ m_current };
             // offset the pointer first, align it, and offset it back
-            m_current = Utility::AlignAddress(m_current + TOffset + sizeof(std::size_t), alignment) - (TOffset + sizeof(std::size_t));
+            std::byte* header_ptr{ Utility::AlignAddress(m_current + TOffset + HEADER_SIZE, alignment) - (TOffset + HEADER_SIZE) };
 
-            if ((m_current + size + TOffset + sizeof(std::size_t)) >= m_end) {
-                CORE_DEBUG("LinearAllocator out of memory!");
-                m_current = reset_ptr;
-                return nullptr;
+            if constexpr (TChecked::CHECK_OVERFLOW) {
+                if (!FitsBefore(header_ptr, m_end, HEADER_SIZE + TOffset, size)) {
+                    CORE_DEBUG("LinearAllocator out of memory!");
+                    return nullptr;
+                }
+            } else {
+                DEBUG_ASSERT(FitsBefore(header_ptr, m_end, HEADER_SIZE + TOffset, size), "LinearAllocator out of memory!");
             }
 
-            (void)std::copy_n(m_current, sizeof(std::size_t), std::bit_cast<std::byte*>(&size));
+            if constexpr (TChecked::STORE_SIZE) {
+                const auto stored_size{ static_cast<OffsetType>(size) };
+                (void)std::copy_n(std::bit_cast<const std::byte*>(&stored_size), sizeof(OffsetType), header_ptr);
+            }
+            m_current = header_ptr + HEADER_SIZE + TOffset + size;
 
-            return m_current + sizeof(std::size_t);
+            return header_ptr + HEADER_SIZE;
         }
 
         /**
@@ -110,14 +128,22 @@ namespace Synapse::Memory::Allocator {
          * @brief Gives access to the raw buffer start pointer.
          */
         [[nodiscard]] auto GetStart() const noexcept -> const std::byte * { return m_start; };
+        /**
+         * @brief Everything above the cursor is one free block.
+         */
+        [[nodiscard]] auto GetFreeSpace() const noexcept -> FreeSpaceStatistics {
+            const auto free_bytes{ static_cast<std::size_t>(m_end - m_current) };
+            return FreeSpaceStatistics{ .free_bytes = free_bytes, .free_block_count = (free_bytes > 0U) ? 1U : 0U, .largest_free_block = free_bytes };
+        }
         /**
          * @brief Reads the stored size of a prior allocation.
          * @param ptr Pointer returned by Allocate.
          */
-        [[nodiscard]] auto GetAllocationSize(const std::byte *ptr) const noexcept -> std::size_t {
+        [[nodiscard]] auto GetAllocationSize(const std::byte *ptr) const noexcept -> std::size_t
+            requires TChecked::STORE_SIZE {
             DEBUG_ASSERT(ptr != nullptr, "Cannot get allocation size of a null pointer");
-            std::size_t size{};
-            (void)std::copy_n(ptr - (sizeof(std::size_t) + TOffset), sizeof(std::size_t), std::bit_cast<std::byte*>(&size));
+            OffsetType size{};
+            (void)std::copy_n(ptr - (HEADER_SIZE + TOffset), sizeof(OffsetType), std::bit_cast<std::byte*>(&size));
             return size;
         };
 
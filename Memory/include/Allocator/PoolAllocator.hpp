@@ -1,5 +1,6 @@
 #pragma once
 #include <AlignmentUtility.hpp>
+#include <Allocator/FreeSpaceStatistics.hpp>
 #include <Log.hpp>
 #include <bit>
 #include <cstddef>
@@ -65,6 +66,7 @@ namespace Synapse::Memory::Allocator {
             // obtain one element from the head of the free list
             std::byte *head = m_current;
             m_current = *std::bit_cast<std::byte **>(head);
+            ++m_used_count;
             return (head - TOffset);
         }
 
@@ -80,12 +82,13 @@ namespace Synapse::Memory::Allocator {
             const auto list_ptr = ptr + TOffset;
             *(std::bit_cast<std::byte**>(list_ptr)) = m_current;
             m_current = list_ptr;
+            --m_used_count;
         }
 
         /**
          * @brief Reports the block size that this pool hands out.
          */
-        [[nodiscard]] static auto GetAllocationSize([[maybe_unused]] const void *ptr) noexcept -> std::size_t {
+        [[nodiscard]] auto GetAllocationSize([[maybe_unused]] const void *ptr) const noexcept -> std::size_t {
             DEBUG_ASSERT(ptr != nullptr, "Cannot deallocate a null pointer");
             DEBUG_ASSERT((ptr >= m_start) && (ptr < m_end), "Pointer was not allocated by the alloctor");
             return TMaxElementSizeInBytes;
@@ -96,10 +99,12 @@ namespace Synapse::Memory::Allocator {
          */
         auto Reset() noexcept -> void {
             static_assert(alignof(void *) <= TMaxAlignment);
-            static_assert(std::has_single_bit(TMaxAlignment) == 0);
+            static_assert(std::has_single_bit(TMaxAlignment));
             static_assert(TMaxElementSizeInBytes >= sizeof(void *));
 
             std::byte *current = Utility::AlignAddress(m_start + TOffset, TMaxAlignment);
+            m_used_count = 0U;
+            m_block_count = 0U;
 
             if ((current + TMaxElementSizeInBytes) >= m_end) {
                 m_current = nullptr;
@@ -109,6 +114,7 @@ namespace Synapse::Memory::Allocator {
             auto next_node_ptr = std::bit_cast<std::byte**>(current);
             m_current = current;
             current += TMaxElementSizeInBytes;
+            ++m_block_count;
 
             // initialise the free list - make every link point to the next element in the list
             while (true) {
@@ -119,14 +125,36 @@ namespace Synapse::Memory::Allocator {
                 *(next_node_ptr) = current;
                 next_node_ptr = std::bit_cast<std::byte**>(current);
                 current += TMaxElementSizeInBytes;
+                ++m_block_count;
             }
 
             *(next_node_ptr) = nullptr;
         }
 
+        /**
+         * @brief Returns total managed capacity in bytes.
+         */
+        [[nodiscard]] auto GetSize() const noexcept -> std::size_t {
+            return std::bit_cast<uintptr_t>(m_end) - std::bit_cast<uintptr_t>(m_start);
+        }
+        /**
+         * @brief Reports bytes of the elements handed out.
+         */
+        [[nodiscard]] auto GetUsed() const noexcept -> std::size_t { return m_used_count * TMaxElementSizeInBytes; }
+        /**
+         * @brief Every free element is a block of its own, counted without walking the list.
+         */
+        [[nodiscard]] auto GetFreeSpace() const noexcept -> FreeSpaceStatistics {
+            const std::size_t free_count{ m_block_count - m_used_count };
+            return FreeSpaceStatistics{ .free_bytes = free_count * TMaxElementSizeInBytes, .free_block_count = free_count,
+                .largest_free_block = (free_count > 0U) ? TMaxElementSizeInBytes : 0U };
+        }
+
     private:
         std::byte *m_start;
         std::byte *m_end;
         std::byte *m_current{ nullptr };
+        std::size_t m_used_count{ 0U };
+        std::size_t m_block_count{ 0U };
     };
 }
@@ -1,10 +1,14 @@
 #pragma once
 #include <AlignmentUtility.hpp>
+#include <Allocator/AllocationChecking.hpp>
+#include <Allocator/FreeSpaceStatistics.hpp>
 #include <Log.hpp>
 #include <libassert/assert.hpp>
 
+#include <algorithm>
 #include <bit>
 #include <cstddef>
+#include <type_traits>
 
 namespace Synapse::Memory::Allocator {
     /**
@@ -15,9 +19,11 @@ namespace Synapse::Memory::Allocator {
      * the aligned address to the caller (after any reserved prefix), and advances the
      * cursor.
      *
-     * Overhead is low, but each allocation stores a small header (16 bytes) immediately
-     * before the returned pointer. The header records the adjustment/padding needed to
-     * satisfy alignment so that `Deallocate()` can rewind the cursor correctly.
+     * Overhead is low, but each allocation stores a small header (16 bytes, 8 bytes with a
+     * 32-bit `TChecked::OffsetType`) immediately before the returned pointer. The header
+     * records the size and the offset of the cursor before the allocation so that
+     * `Deallocate()` can rewind the cursor correctly. Without `TChecked::STORE_SIZE` only the
+     * offset is kept, which is all freeing needs.
      *
      * Deallocation is stack-like (LIFO): you may only free the most recently allocated
      * block, in exact reverse order of allocation. Internal fragmentation is limited to
@@ -26,18 +32,29 @@ namespace Synapse::Memory::Allocator {
      * When `STACK_LIFO_CHECK` is enabled, deallocations are validated and must occur
      * strictly in reverse order of allocations.
      *
-     * @tparam TOffset Number of bytes reserved immediately before the returned user pointer
-     *                 (e.g., for a small header, metadata, or back-pointer).
+     * @tparam TOffset  Number of bytes reserved immediately before the returned user pointer
+     *                  (e.g., for a small header, metadata, or back-pointer).
+     * @tparam TChecked Overflow checks and header layout, see `AllocationChecking`.
      */
-    template <std::size_t TOffset>
+    template <std::size_t TOffset, AllocationCheckingPolicy TChecked = CheckedAllocation>
     class StackAllocator {
-        struct AllocationHeader {
+        using OffsetType = typename TChecked::OffsetType;
+
+        struct SizedHeader {
+#ifdef STACK_LIFO_CHECK
+                    OffsetType stack_lifo_id;
+#endif
+            OffsetType allocation_size;
+            OffsetType allocation_reset_offset;
+        };
+        struct UnsizedHeader {
 #ifdef STACK_LIFO_CHECK
-                    std::size_t stack_lifo_id;
+                    OffsetType stack_lifo_id;
 #endif
-            std::size_t allocation_size;
-            std::byte* allocation_reset_ptr;
+            OffsetType allocation_reset_offset;
         };
+        // The size only serves `GetAllocationSize`, freeing rewinds the cursor to the reset offset
+        using AllocationHeader = std::conditional_t<TChecked::STORE_SIZE, SizedHeader, UnsizedHeader>;
 
     public:
         StackAllocator() = delete;
@@ -46,13 +63,15 @@ namespace Synapse::Memory::Allocator {
          * @param start Pointer to the first byte of the buffer.
          * @param end   Pointer one past the last byte of the buffer.
          */
-        StackAllocator(std::byte* start, std::byte* end) noexcept : m_start(start), m_end(end), m_current(start) {};
+        StackAllocator(std::byte* start, std::byte* end) noexcept : m_start(start), m_end(end), m_current(start) {
+            DEBUG_ASSERT(static_cast<std::size_t>(end - start) <= TChecked::MAX_AREA_SIZE, "Area is too large for the header offset type.");
+        };
         /**
          * @brief Constructs the allocator with a buffer start and explicit size.
          * @param size  Number of bytes managed by the allocator.
          * @param start Pointer to the first byte of the buffer.
          */
-        StackAllocator(const std::size_t size, std::byte* start) noexcept : m_start(start), m_end(start + size), m_current(start) {};
+        StackAllocator(const std::size_t size, std::byte* start) noexcept : StackAllocator(start, start + size) {};
         ~StackAllocator() = default;
 
         StackAllocator(const StackAllocator&) = delete;
@@ -69,24 +88,29 @@ namespace Synapse::Memory::Allocator {
          */
         [[nodiscard]] inline auto Allocate(const std::size_t size,
                 const std::size_t alignment) noexcept -> std::byte * {
-            DEBUG_ASSERT(std::has_single_bit(alignment) == 0, "Invalid alignment. Must be power of two.");
-            DEBUG_ASSERT(size >= 0, "Allocation has to be at least 1 byte");
-            const AllocationHeader header{
+            DEBUG_ASSERT(std::has_single_bit(alignment), "Invalid alignment. Must be power of two.");
+            DEBUG_ASSERT(size > 0U, "Allocation has to be at least 1 byte");
+            AllocationHeader header{};
 #ifdef STACK_LIFO_CHECK
-                        .stack_lifo_id = m_lifo_check_count + 1,
+            header.stack_lifo_id = static_cast<OffsetType>(m_lifo_check_count + 1);
 #endif
-                .allocation_size = size,
-                .allocation_reset_ptr = m_current
-            };
+            header.allocation_reset_offset = static_cast<OffsetType>(m_current - m_start);
+            if constexpr (TChecked::STORE_SIZE) {
+                header.allocation_size = static_cast<OffsetType>(size);
+            }
 
             // Offset the pointer first, align it, and then offset it back
-            m_current = Utility::AlignAddress(m_current + sizeof(AllocationHeader) + TOffset, alignment) - (sizeof(AllocationHeader) + TOffset);
+            std::byte* header_ptr{ Utility::AlignAddress(m_current + sizeof(AllocationHeader) + TOffset, alignment) - (sizeof(AllocationHeader) + TOffset) };
 
-            if ((m_current + size + sizeof(AllocationHeader) + TOffset) > m_end) {
-                CORE_DEBUG("StackAllocator out of memory!");
-                m_current = header.allocation_reset_ptr;
-                return nullptr;
+            if constexpr (TChecked::CHECK_OVERFLOW) {
+                if (!FitsBefore(header_ptr, m_end, sizeof(AllocationHeader) + TOffset, size)) {
+                    CORE_DEBUG("StackAllocator out of memory!");
+                    return nullptr;
+                }
+            } else {
+                DEBUG_ASSERT(FitsBefore(header_ptr, m_end, sizeof(AllocationHeader) + TOffset, size), "StackAllocator out of memory!");
             }
+            m_current = header_ptr;
 
 #ifdef STACK_LIFO_CHECK
             ++m_lifo_check_count;
@@ -116,17 +140,18 @@ namespace Synapse::Memory::Allocator {
             ASSERT(allocation_header.stack_lifo_id == m_lifo_check_count, "Stack deallacation must be LIFO order.");
             --m_lifo_check_count;
 #endif
-            m_current = allocation_header.allocation_reset_ptr;
+            m_current = m_start + allocation_header.allocation_reset_offset;
         }
 
         /**
          * @brief Returns the requested size for a previous allocation.
          * @param ptr Pointer returned by Allocate.
          */
-        [[nodiscard]] auto GetAllocationSize(std::byte *ptr) const noexcept -> std::size_t {
+        [[nodiscard]] auto GetAllocationSize(const std::byte *ptr) const noexcept -> std::size_t
+            requires TChecked::STORE_SIZE {
             DEBUG_ASSERT(ptr != nullptr, "Cannot get allocation size of a null pointer");
             DEBUG_ASSERT((ptr >= m_start) && (ptr < m_end), "Pointer was not allocated by the alloctor");
-            std::byte* shifted_ptr = ptr - (sizeof(AllocationHeader) + TOffset);
+            const std::byte* shifted_ptr = ptr - (sizeof(AllocationHeader) + TOffset);
             AllocationHeader allocation_header{};
             (void)std::copy_n(shifted_ptr, sizeof(AllocationHeader), std::bit_cast<std::byte*>(&allocation_header));
             return allocation_header.allocation_size;
@@ -142,6 +167,26 @@ namespace Synapse::Memory::Allocator {
 #endif
         }
 
+        /**
+         * @brief Returns total managed capacity in bytes.
+         */
+        [[nodiscard]] auto GetSize() const noexcept -> std::size_t {
+            return std::bit_cast<uintptr_t>(m_end) - std::bit_cast<uintptr_t>(m_start);
+        }
+        /**
+         * @brief Reports bytes below the top of the stack.
+         */
+        [[nodiscard]] auto GetUsed() const noexcept -> std::size_t {
+            return std::bit_cast<uintptr_t>(m_current) - std::bit_cast<uintptr_t>(m_start);
+        }
+        /**
+         * @brief Everything above the top of the stack is one free block.
+         */
+        [[nodiscard]] auto GetFreeSpace() const noexcept -> FreeSpaceStatistics {
+            const auto free_bytes{ static_cast<std::size_t>(m_end - m_current) };
+            return FreeSpaceStatistics{ .free_bytes = free_bytes, .free_block_count = (free_bytes > 0U) ? 1U : 0U, .largest_free_block = free_bytes };
+        }
+
     private:
         std::byte* m_start;
         std::byte* m_end;
@@ -33,7 +33,7 @@ namespace Synapse::Memory::Area {
         /**
          * @brief Reports the size of the allocated buffer in bytes.
          */
-        [[nodiscard]] auto GetMemory() const noexcept -> std::size_t { return m_end - m_start; }
+        [[nodiscard]] auto GetSize() const noexcept -> std::size_t { return static_cast<std::size_t>(m_end - m_start); }
 
     private:
         std::byte* m_start;
@@ -22,17 +22,17 @@ namespace Synapse::Memory::Area {
         /**
          * @brief Returns a pointer to the first byte of the buffer.
          */
-        [[nodiscard]] auto GetStart() const noexcept -> std::byte * { return &m_buffer.data(); }
+        [[nodiscard]] auto GetStart() noexcept -> std::byte * { return m_buffer.data(); }
         /**
          * @brief Returns a pointer one past the last byte of the buffer.
          */
-        [[nodiscard]] auto GetEnd() const noexcept -> std::byte * { return &m_buffer.data() + m_buffer.size(); }
+        [[nodiscard]] auto GetEnd() noexcept -> std::byte * { return m_buffer.data() + m_buffer.size(); }
         /**
          * @brief Reports the buffer capacity in bytes.
          */
         [[nodiscard]] auto GetSize() const noexcept -> std::size_t { return m_buffer.size(); }
 
     private:
-        std::array<std::byte, TSizeInBytes> m_buffer{};
+        alignas(std::max_align_t) std::array<std::byte, TSizeInBytes> m_buffer{};
     };
 }
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+#include <type_traits>
+
+namespace Synapse::Memory::Arena {
+    /**
+     * @brief Kind of operation stored in an `AllocationEvent`.
+     */
+    enum class AllocationEventType : std::uint8_t {
+        Allocate = 0,
+        Deallocate = 1
+    };
+
+    /**
+     * @brief Fixed-size binary record describing a single arena operation.
+     *
+     * Events are written verbatim (native endianness) into the allocation trace, so the
+     * layout must stay stable. Bump `ALLOCATION_TRACE_VERSION` when it changes.
+     * Deallocation events carry a size of zero; the analyser pairs them with the
+     * allocation of the same pointer.
+     */
+    struct AllocationEvent {
+        std::uint64_t timestamp;    ///< Nanoseconds since the recorder started.
+        std::uint64_t pointer;      ///< Address returned by, or passed to, the arena.
+        std::uint64_t size;         ///< Requested size in bytes.
+        std::uint32_t call_site;    ///< Hash of the call-site file and line, see `MakeCallSiteId`.
+        std::uint32_t alignment;    ///< Requested alignment in bytes.
+        std::uint32_t thread;       ///< Recorder assigned id of the calling thread.
+        AllocationEventType type;
+        std::uint8_t reserved[3];
+    };
+    static_assert(sizeof(AllocationEvent) == 40U);
+    static_assert(std::is_trivially_copyable_v<AllocationEvent>);
+
+    /**
+     * @brief Header written once at the start of every allocation trace.
+     */
+    struct AllocationTraceHeader {
+        std::uint32_t magic;
+        std::uint16_t version;
+        std::uint16_t event_size;
+        std::uint64_t start_time;   ///< System clock time of the recorder start, in nanoseconds since epoch.
+    };
+    static_assert(sizeof(AllocationTraceHeader) == 16U);
+
+    inline constexpr std::uint32_t ALLOCATION_TRACE_MAGIC{ 0x54414C41 }; // "ALAT"
+    inline constexpr std::uint16_t ALLOCATION_TRACE_VERSION{ 1 };
+
+    /**
+     * @brief Computes a stable 32-bit identifier for a call site.
+     *
+     * FNV-1a over the file name followed by the line number. The same location always maps
+     * to the same id, so ids can be resolved offline by hashing the candidate locations.
+     */
+    [[nodiscard]] constexpr auto MakeCallSiteId(const std::string_view file_name, const std::uint_least32_t line) noexcept
+            -> std::uint32_t {
+        std::uint32_t hash{ 2166136261U };
+        for (const char character : file_name) {
+            hash = (hash ^ static_cast<std::uint8_t>(character)) * 16777619U;
+        }
+        for (std::size_t i = 0U; i < sizeof(line); ++i) {
+            hash = (hash ^ static_cast<std::uint8_t>(line >> (i * 8U))) * 16777619U;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Convenience overload taking the call-site metadata captured by the arenas.
+     */
+    [[nodiscard]] constexpr auto MakeCallSiteId(const std::source_location &source_location) noexcept -> std::uint32_t {
+        return MakeCallSiteId(source_location.file_name(), source_location.line());
+    }
+}
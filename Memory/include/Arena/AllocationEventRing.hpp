@@ -0,0 +1,84 @@
+#pragma once
+#include <Arena/AllocationEvent.hpp>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace Synapse::Memory::Arena {
+    /**
+     * @brief Lock-free single-producer single-consumer ring of allocation events.
+     *
+     * Each recording thread owns one ring and is its only producer; the recorder drain
+     * thread is the only consumer. A full ring never blocks the producer, the event is
+     * dropped and counted instead so that recording cannot stall an allocation.
+     *
+     * @tparam TCapacity Number of events the ring can hold; must be a power of two.
+     */
+    template <std::size_t TCapacity>
+    class AllocationEventRing {
+        static_assert(std::has_single_bit(TCapacity), "Ring capacity must be a power of two.");
+        static constexpr std::size_t MASK{ TCapacity - 1U };
+
+    public:
+        AllocationEventRing() noexcept = default;
+        ~AllocationEventRing() = default;
+
+        AllocationEventRing(const AllocationEventRing&) = delete;
+        AllocationEventRing(AllocationEventRing&&) = delete;
+        auto operator=(const AllocationEventRing &) -> AllocationEventRing & = delete;
+        auto operator=(AllocationEventRing &&) -> AllocationEventRing & = delete;
+        auto operator==(const AllocationEventRing &other) const -> bool = delete;
+
+        /**
+         * @brief Appends an event; producer side only.
+         * @return `false` when the ring is full and the event was dropped.
+         */
+        auto TryPush(const AllocationEvent &event) noexcept -> bool {
+            const std::size_t head{ m_head.load(std::memory_order_relaxed) };
+            if ((head - m_cached_tail) == TCapacity) {
+                m_cached_tail = m_tail.load(std::memory_order_acquire);
+                if ((head - m_cached_tail) == TCapacity) {
+                    m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+                    return false;
+                }
+            }
+            m_events[head & MASK] = event;
+            m_head.store(head + 1U, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Moves up to `max_count` events into `output`; consumer side only.
+         * @return Number of events copied.
+         */
+        auto Drain(AllocationEvent *output, const std::size_t max_count) noexcept -> std::size_t {
+            const std::size_t tail{ m_tail.load(std::memory_order_relaxed) };
+            const std::size_t available{ m_head.load(std::memory_order_acquire) - tail };
+            const std::size_t count{ available < max_count ? available : max_count };
+            for (std::size_t i = 0U; i < count; ++i) {
+                output[i] = m_events[(tail + i) & MASK];
+            }
+            m_tail.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * @brief Number of events dropped because the ring was full.
+         */
+        [[nodiscard]] auto GetDroppedCount() const noexcept -> std::uint64_t {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static constexpr auto GetCapacity() noexcept -> std::size_t { return TCapacity; }
+
+    private:
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> m_head{ 0U };
+        std::size_t m_cached_tail{ 0U };
+        std::atomic<std::uint64_t> m_dropped{ 0U };
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> m_tail{ 0U };
+        alignas(std::hardware_destructive_interference_size) std::array<AllocationEvent, TCapacity> m_events{};
+    };
+}
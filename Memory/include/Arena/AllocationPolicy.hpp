@@ -1,19 +1,55 @@
 #pragma once
 #include <cstddef>
 #include <concepts>
+#include <Allocator/FreeSpaceStatistics.hpp>
 
 namespace Synapse::Memory::Arena {
+    /**
+     * @brief Allocator that can free a block from its pointer alone.
+     */
+    template <typename TPolicy>
+    concept UnsizedDeallocationPolicy = requires(TPolicy& p, std::byte* memory) {
+        p.Deallocate(memory);
+    };
+
+    /**
+     * @brief Allocator that can free a block when told the size and alignment it was allocated with.
+     *
+     * Such allocators do not need to keep the size in a header in front of every block.
+     */
+    template <typename TPolicy>
+    concept SizedDeallocationPolicy = requires(TPolicy& p, std::byte* memory, const std::size_t size, const std::size_t alignment) {
+        p.Deallocate(memory, size, alignment);
+    };
+
+    /**
+     * @brief Allocator that can report the size of a live block, needed by the unsized arena `Deallocate`.
+     */
+    template <typename TPolicy>
+    concept AllocationSizePolicy = requires(const TPolicy& p, const std::byte* memory) {
+        { p.GetAllocationSize(memory) } -> std::convertible_to<std::size_t>;
+    };
+
+    /**
+     * @brief Allocator that reports its capacity, the bytes in use and its free space, needed by `MemoryArena::GetStatistics`.
+     */
+    template <typename TPolicy>
+    concept StatisticsPolicy = requires(const TPolicy& p) {
+        { p.GetSize() } -> std::convertible_to<std::size_t>;
+        { p.GetUsed() } -> std::convertible_to<std::size_t>;
+        { p.GetFreeSpace() } -> std::same_as<Allocator::FreeSpaceStatistics>;
+    };
+
     /**
      * @brief Concept describing allocator requirements used by `MemoryArena`.
      *
-     * A valid allocation policy must provide `Allocate` and `Deallocate`
-     * functions that operate on raw byte pointers.
+     * A valid allocation policy must provide `Allocate` and a sized or unsized
+     * `Deallocate` function that operate on raw byte pointers.
      */
     template <typename TPolicy>
-    concept AllocationPolicy = requires(const TPolicy p, std::byte* memory, const std::size_t size, const std::size_t alignment) {
+    concept AllocationPolicy = requires(TPolicy& p, const std::size_t size, const std::size_t alignment) {
         { p.Allocate(size, alignment) } -> std::same_as<std::byte*>;
-        p.Deallocate(memory);
-    };
+    } && (UnsizedDeallocationPolicy<TPolicy> || SizedDeallocationPolicy<TPolicy>);
 
     /**
      * @brief Concept describing the backing storage required by `MemoryArena`.
@@ -22,7 +58,7 @@ namespace Synapse::Memory::Arena {
      * the managed buffer.
      */
     template <typename TPolicy>
-    concept AreaPolicy = requires(const TPolicy p) {
+    concept AreaPolicy = requires(TPolicy& p) {
         { p.GetStart() } -> std::convertible_to<std::byte*>;
         { p.GetEnd() } -> std::convertible_to<std::byte*>;
         { p.GetSize() } -> std::convertible_to<std::size_t>;
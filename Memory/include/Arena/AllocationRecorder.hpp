@@ -0,0 +1,128 @@
+#pragma once
+#include <Arena/AllocationEvent.hpp>
+#include <Arena/AllocationEventRing.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Synapse::Memory::Arena {
+    /**
+     * @brief Collects allocation events from any number of threads and streams them out.
+     *
+     * Recording threads write into their own lock-free ring, so the allocation path never
+     * takes a lock after the first event of a thread. A background thread drains all rings
+     * periodically and writes the events to a file or a local (Unix domain) socket, prefixed
+     * by an `AllocationTraceHeader`. The ring of a thread that exited is freed by the next
+     * drain after its last events are written. The resulting stream can be read back with
+     * `AllocationTrace` and replayed by the allocation analyser tool.
+     *
+     * @code{.cpp}
+     * AllocationRecorder recorder{};
+     * recorder.OpenFile("server.alat");
+     * recorder.Start();
+     * RecordingArena recording_arena{ arena, recorder };
+     * ...
+     * recorder.Stop();
+     * @endcode
+     */
+    class AllocationRecorder {
+    public:
+        using Ring = AllocationEventRing<4096>;
+
+        explicit AllocationRecorder(std::chrono::milliseconds drain_interval = std::chrono::milliseconds(10)) noexcept;
+        ~AllocationRecorder() noexcept;
+
+        AllocationRecorder(const AllocationRecorder&) = delete;
+        AllocationRecorder(AllocationRecorder&&) = delete;
+        auto operator=(const AllocationRecorder &) -> AllocationRecorder & = delete;
+        auto operator=(AllocationRecorder &&) -> AllocationRecorder & = delete;
+        auto operator==(const AllocationRecorder &other) const -> bool = delete;
+
+        /**
+         * @brief Streams the events into a file, truncating it.
+         * @return `false` if the file could not be opened or a sink is already open.
+         */
+        auto OpenFile(const std::filesystem::path &path) noexcept -> bool;
+
+        /**
+         * @brief Streams the events into a listening local stream socket.
+         * @param path File system path of the Unix domain socket.
+         * @return `false` if the connection failed, the platform lacks support, or a sink is already open.
+         */
+        auto ConnectLocalSocket(const std::string &path) noexcept -> bool;
+
+        /**
+         * @brief Writes the trace header and starts the drain thread.
+         * @return `false` if no sink is open or the recorder is already running.
+         */
+        auto Start() noexcept -> bool;
+
+        /**
+         * @brief Stops the drain thread, writes out every pending event and closes the sink.
+         */
+        auto Stop() noexcept -> void;
+
+        /**
+         * @brief Records one event from the calling thread. No-op while the recorder is stopped.
+         */
+        auto Record(AllocationEventType type, const void *ptr, std::size_t size, std::size_t alignment,
+                std::uint32_t call_site) noexcept -> void;
+
+        [[nodiscard]] auto IsRecording() const noexcept -> bool { return m_recording.load(std::memory_order_acquire); }
+        /**
+         * @brief Number of events lost because a thread ring was full when the event was produced.
+         */
+        [[nodiscard]] auto GetDroppedCount() const noexcept -> std::uint64_t;
+        /**
+         * @brief Number of events handed to the sink so far.
+         */
+        [[nodiscard]] auto GetWrittenCount() const noexcept -> std::uint64_t { return m_written.load(std::memory_order_relaxed); }
+        /**
+         * @brief Number of thread rings, one per live thread that recorded an event.
+         */
+        [[nodiscard]] auto GetRingCount() const noexcept -> std::size_t;
+
+    private:
+        struct ThreadRing {
+            std::unique_ptr<Ring> ring;
+            std::shared_ptr<std::atomic<bool>> thread_exited;  ///< Set by the thread on exit, shared so it outlives the recorder.
+        };
+
+        struct DrainRing {
+            Ring *ring;
+            bool thread_exited;  ///< Seen before draining, so the drain emptied the ring for good.
+        };
+
+        auto GetThreadRing() noexcept -> Ring *;
+        auto DrainThread(const std::stop_token &stop_token) noexcept -> void;
+        auto DrainAll() noexcept -> void;
+        auto WriteToSink(const void *data, std::size_t size) noexcept -> bool;
+        auto CloseSink() noexcept -> void;
+
+        const std::uint64_t m_instance_id;
+        const std::chrono::milliseconds m_drain_interval;
+        const std::chrono::steady_clock::time_point m_start_time;
+
+        std::atomic<bool> m_recording{ false };
+        std::atomic<std::uint64_t> m_written{ 0U };
+
+        mutable std::mutex m_rings_mutex{};
+        std::vector<ThreadRing> m_rings{};
+        std::uint64_t m_retired_dropped{ 0U };
+
+        std::FILE *m_file{ nullptr };
+        int m_socket{ -1 };
+
+        std::vector<AllocationEvent> m_drain_buffer{};
+        std::vector<DrainRing> m_drain_rings{};
+        std::jthread m_drain_thread{};
+    };
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <Arena/AllocationEvent.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Synapse::Memory::Arena {
+    /**
+     * @brief One step of a replayable allocation sequence.
+     *
+     * Pointers of the recorded process are replaced by dense slot indices, so a replay only
+     * needs an array lookup to find the block it has to free. Frees carry the size and
+     * alignment of the allocation, so they can go through the sized `Deallocate`.
+     */
+    struct ReplayOperation {
+        std::uint64_t size;
+        std::uint32_t slot;
+        std::uint32_t alignment;
+        AllocationEventType type;
+    };
+
+    /**
+     * @brief Allocation sequence prepared for replaying against an allocator.
+     */
+    struct AllocationReplay {
+        std::vector<ReplayOperation> operations;
+        std::uint32_t slot_count{ 0U };       ///< Number of distinct slots referenced by `operations`.
+        std::uint64_t peak_live_bytes{ 0U };  ///< Highest sum of live requested bytes over the sequence.
+        std::uint64_t unmatched_frees{ 0U };  ///< Frees of pointers allocated before the recording started.
+    };
+
+    /**
+     * @brief In-memory copy of an allocation trace written by `AllocationRecorder`.
+     */
+    class AllocationTrace {
+    public:
+        AllocationTrace() = default;
+        AllocationTrace(AllocationTraceHeader header, std::vector<AllocationEvent> events) noexcept;
+
+        /**
+         * @brief Reads a trace file and orders the events of all threads by timestamp.
+         * @return The trace, or `std::nullopt` if the file is missing, truncated or of an unknown version.
+         */
+        [[nodiscard]] static auto Load(const std::filesystem::path &path) -> std::optional<AllocationTrace>;
+
+        /**
+         * @brief Converts the recorded pointers into slots and computes the live byte profile.
+         */
+        [[nodiscard]] auto BuildReplay() const -> AllocationReplay;
+
+        [[nodiscard]] auto GetHeader() const noexcept -> const AllocationTraceHeader & { return m_header; }
+        [[nodiscard]] auto GetEvents() const noexcept -> std::span<const AllocationEvent> { return m_events; }
+
+    private:
+        AllocationTraceHeader m_header{};
+        std::vector<AllocationEvent> m_events{};
+    };
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <source_location>
+
+namespace Synapse::Memory::Arena {
+    /**
+     * @brief `std::pmr::memory_resource` that forwards to a memory arena.
+     *
+     * Lets the `std::pmr` containers, and anything else taking a memory resource such as the
+     * `ankerl::unordered_dense::pmr` maps, allocate from an arena without the arena type
+     * showing up in the container type. Deallocation passes the size and alignment on, so
+     * the arena takes the sized path. Two resources compare equal when they wrap the same
+     * arena.
+     *
+     * @code{.cpp}
+     * ArenaMemoryResource<ApplicationArena> resource{ arena };
+     * std::pmr::vector<int> values{ &resource };
+     * ankerl::unordered_dense::pmr::map<std::uint32_t, Session> sessions{ &resource };
+     * @endcode
+     *
+     * @tparam TArena Underlying arena type implementing `Allocate`/`Deallocate`, must outlive the resource.
+     */
+    template <class TArena>
+    class ArenaMemoryResource final : public std::pmr::memory_resource {
+    public:
+        ArenaMemoryResource() = delete;
+        explicit ArenaMemoryResource(TArena& arena) noexcept : m_arena(arena) {}
+        ~ArenaMemoryResource() override = default;
+
+        ArenaMemoryResource(const ArenaMemoryResource&) = delete;
+        ArenaMemoryResource(ArenaMemoryResource&&) = delete;
+        auto operator=(const ArenaMemoryResource &) -> ArenaMemoryResource & = delete;
+        auto operator=(ArenaMemoryResource &&) -> ArenaMemoryResource & = delete;
+
+        [[nodiscard]] auto GetArena() const noexcept -> TArena & { return m_arena; }
+
+    private:
+        /**
+         * @throws std::bad_alloc if the arena is out of memory, as required by `std::pmr::memory_resource`.
+         */
+        auto do_allocate(const std::size_t bytes, const std::size_t alignment) -> void * override {
+            std::byte *memory{ m_arena.Allocate(bytes, alignment, std::source_location::current()) };
+            if (memory == nullptr) {
+                throw std::bad_alloc();
+            }
+            return memory;
+        }
+
+        auto do_deallocate(void *p, const std::size_t bytes, const std::size_t alignment) -> void override {
+            m_arena.Deallocate(static_cast<std::byte *>(p), bytes, alignment);
+        }
+
+        [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override {
+            const auto *resource{ dynamic_cast<const ArenaMemoryResource *>(&other) };
+            return (resource != nullptr) && (&resource->m_arena == &m_arena);
+        }
+
+        TArena& m_arena;
+    };
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <Arena/ArenaStatistics.hpp>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Synapse::Memory::Arena {
+    /**
+     * @brief Statistics of a registered arena, as returned by `ArenaRegistry::Collect`.
+     */
+    struct NamedArenaStatistics {
+        std::string name;
+        ArenaStatistics statistics;
+    };
+
+    /**
+     * @brief Set of named arenas whose statistics can be collected and logged together.
+     *
+     * Lets the server dump every arena periodically, e.g. from a `PeriodicTaskThread`, so
+     * memory pressure shows up in the log before an arena runs out. Collecting calls
+     * `GetStatistics` on each arena, which enters the arena's thread guard, so arenas using
+     * `SingleThreadPolicy` must only be collected from the thread that uses them.
+     *
+     * @code{.cpp}
+     * ApplicationArena arena{ area };
+     * ArenaRegistration registration{ GetArenaRegistry(), "Application", arena };
+     * ...
+     * GetArenaRegistry().LogStatistics();
+     * @endcode
+     */
+    class ArenaRegistry {
+    public:
+        using StatisticsFunction = auto (*)(void *arena) noexcept -> ArenaStatistics;
+
+        /**
+         * @brief Arenas using more than this share of their capacity are logged as a warning.
+         */
+        static constexpr double PRESSURE_THRESHOLD{ 0.9 };
+
+        ArenaRegistry() = default;
+        ~ArenaRegistry() = default;
+
+        ArenaRegistry(const ArenaRegistry&) = delete;
+        ArenaRegistry(ArenaRegistry&&) = delete;
+        auto operator=(const ArenaRegistry &) -> ArenaRegistry & = delete;
+        auto operator=(ArenaRegistry &&) -> ArenaRegistry & = delete;
+        auto operator==(const ArenaRegistry &other) const -> bool = delete;
+
+        /**
+         * @brief Adds an arena, it has to be unregistered before it is destroyed.
+         */
+        template <typename TArena>
+        auto Register(std::string name, TArena &arena) -> void {
+            Register(std::move(name), &arena, [](void *registered) noexcept -> ArenaStatistics {
+                return static_cast<TArena *>(registered)->GetStatistics();
+            });
+        }
+        auto Register(std::string name, void *arena, StatisticsFunction get_statistics) -> void;
+        auto Unregister(const void *arena) noexcept -> void;
+
+        /**
+         * @brief Statistics of every registered arena, in registration order.
+         */
+        [[nodiscard]] auto Collect() const -> std::vector<NamedArenaStatistics>;
+
+        /**
+         * @brief Logs one line per registered arena, arenas under pressure or with failed allocations as warnings.
+         */
+        auto LogStatistics() const -> void;
+
+        [[nodiscard]] auto GetCount() const noexcept -> std::size_t;
+
+    private:
+        struct Entry {
+            std::string name;
+            void *arena;
+            StatisticsFunction get_statistics;
+        };
+
+        mutable std::mutex m_mutex{};
+        std::vector<Entry> m_entries{};
+    };
+
+    /**
+     * @brief Registers an arena for its lifetime, declare it right after the arena.
+     */
+    class ArenaRegistration {
+    public:
+        template <typename TArena>
+        ArenaRegistration(ArenaRegistry &registry, std::string name, TArena &arena) : m_registry(registry), m_arena(&arena) {
+            m_registry.Register(std::move(name), arena);
+        }
+        ~ArenaRegistration() { m_registry.Unregister(m_arena); }
+
+        ArenaRegistration(const ArenaRegistration&) = delete;
+        ArenaRegistration(ArenaRegistration&&) = delete;
+        auto operator=(const ArenaRegistration &) -> ArenaRegistration & = delete;
+        auto operator=(ArenaRegistration &&) -> ArenaRegistration & = delete;
+
+    private:
+        ArenaRegistry &m_registry;
+        const void *m_arena;
+    };
+
+    /**
+     * @brief Process wide registry.
+     */
+    auto GetArenaRegistry() -> ArenaRegistry &;
+}
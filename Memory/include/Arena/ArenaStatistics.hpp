@@ -0,0 +1,32 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace Synapse::Memory::Arena {
+    /**
+     * @brief Snapshot of the state of an arena, see `MemoryArena::GetStatistics`.
+     *
+     * Byte counts are taken from the allocator's point of view, so headers, guards and
+     * alignment padding count as in use.
+     */
+    struct ArenaStatistics {
+        std::size_t capacity{ 0U };              ///< Bytes managed by the allocator.
+        std::size_t bytes_in_use{ 0U };          ///< Bytes taken out of the area right now.
+        std::size_t peak_bytes_in_use{ 0U };     ///< High-water mark of `bytes_in_use` since construction.
+        std::size_t allocation_count{ 0U };      ///< Live allocations.
+        std::uint64_t total_allocations{ 0U };   ///< Successful allocations since construction.
+        std::uint64_t failed_allocations{ 0U };  ///< Allocations that returned `nullptr` since construction.
+        std::size_t free_bytes{ 0U };            ///< Bytes that can still be handed out, in total.
+        std::size_t free_block_count{ 0U };      ///< Number of separate free blocks.
+        std::size_t largest_free_block{ 0U };    ///< Size of the largest free block.
+
+        /**
+         * @brief Share of the free space outside the largest free block, between 0 and 1.
+         *
+         * 0 means all free space is one block, close to 1 means requests can fail with plenty of free bytes left.
+         */
+        [[nodiscard]] constexpr auto GetFragmentation() const noexcept -> double {
+            return (free_bytes == 0U) ? 0.0 : (1.0 - (static_cast<double>(largest_free_block) / static_cast<double>(free_bytes)));
+        }
+    };
+}
@@ -1,26 +1,32 @@
 #pragma once
 #include <cstddef>
+#include <cstdint>
 #include <concepts>
+#include <string_view>
+#include <Arena/GuardRegistry.hpp>
+#include <Log.hpp>
+#include <PatternUtility.hpp>
+#include <libassert/assert.hpp>
 
 namespace Synapse::Memory::Arena {
         /*
          * Useful for finding memory stomps
          * Options:
          * No bounds checking
+         * Guard bytes checked on free
+         * Guard bytes checked on free and by a background scrubber
         */
-    /// \todo Check all magic values at every allocation and deallocation
-    /// \todo Check for magic value at freeing, if overwritten then we have memory corruption
     /**
      * @brief Concept for policies that insert and validate guard regions.
      */
     template <typename TPolicy>
-    concept BoundsCheckingPolicy = requires(const TPolicy p) {
-        { TPolicy::SIZE_FRONT } -> std::same_as<std::size_t>;
-        { TPolicy::SIZE_BACK } -> std::same_as<std::size_t>;
-        p.GuardFront();
-        p.GuardBack();
-        p.CheckFront();
-        p.CheckBack();
+    concept BoundsCheckingPolicy = requires(TPolicy& p, std::byte* ptr) {
+        { TPolicy::SIZE_FRONT } -> std::convertible_to<std::size_t>;
+        { TPolicy::SIZE_BACK } -> std::convertible_to<std::size_t>;
+        p.GuardFront(ptr);
+        p.GuardBack(ptr);
+        p.CheckFront(ptr);
+        p.CheckBack(ptr);
     };
 
     /**
@@ -28,7 +34,7 @@ namespace Synapse::Memory::Arena {
      */
     class NoBoundsChecking {
     public:
-        NoBoundsChecking() = delete;
+        NoBoundsChecking() = default;
         auto operator==(const NoBoundsChecking& other) const -> bool = delete;
 
         static constexpr std::size_t SIZE_FRONT{ 0 };
@@ -40,4 +46,104 @@ namespace Synapse::Memory::Arena {
         static auto CheckFront([[maybe_unused]] const void* ptr) -> void {}
         static auto CheckBack([[maybe_unused]] const void* ptr) -> void {}
     };
+
+    /**
+     * @brief Verifies that a guard region still holds the guard pattern, reports the first overwritten byte.
+     * @return `true` if the guard is intact.
+     */
+    inline auto VerifyGuard(const std::byte* guard, const std::size_t size, const std::uint8_t pattern,
+            const std::string_view side) noexcept -> bool {
+        const std::byte* mismatch{ Utility::FindPatternMismatch(guard, size, pattern) };
+        if (mismatch == nullptr) {
+            return true;
+        }
+        CORE_ERROR("Memory stomp detected, {} guard at {} overwritten at byte {}", side, static_cast<const void*>(guard),
+                mismatch - guard);
+        DEBUG_ASSERT(mismatch == nullptr, "Memory stomp detected", side, guard, mismatch - guard);
+        return false;
+    }
+
+    /**
+     * @brief Surrounds every allocation with guard bytes and verifies them when it is freed.
+     *
+     * The guards are filled and compared with vector instructions, see `Utility::FillPattern`.
+     * The front guard is 16 bytes, so allocators keep user pointers aligned up to 16 bytes
+     * without extra padding.
+     */
+    class SimpleBoundsChecking {
+    public:
+        SimpleBoundsChecking() = default;
+        auto operator==(const SimpleBoundsChecking& other) const -> bool = delete;
+
+        static constexpr std::size_t SIZE_FRONT{ 16 };
+        static constexpr std::size_t SIZE_BACK{ 16 };
+        /**
+         * @brief Same value as the "no man's land" fill of the MSVC debug heap.
+         */
+        static constexpr std::uint8_t GUARD_PATTERN{ 0xFD };
+
+        static auto GuardFront(std::byte* ptr) noexcept -> void { Utility::FillPattern(ptr, SIZE_FRONT, GUARD_PATTERN); }
+        static auto GuardBack(std::byte* ptr) noexcept -> void { Utility::FillPattern(ptr, SIZE_BACK, GUARD_PATTERN); }
+
+        static auto CheckFront(const std::byte* ptr) noexcept -> void { (void)VerifyGuard(ptr, SIZE_FRONT, GUARD_PATTERN, "front"); }
+        static auto CheckBack(const std::byte* ptr) noexcept -> void { (void)VerifyGuard(ptr, SIZE_BACK, GUARD_PATTERN, "back"); }
+    };
+
+    /**
+     * @brief Guard bytes like `SimpleBoundsChecking`, and every live guard is registered for background verification.
+     *
+     * Frees only catch a stomp once the damaged block is released, which may be never for
+     * long lived blocks. The guards of live blocks go into a process wide `GuardRegistry`,
+     * that a `GuardScrubber` sweeps periodically. Registration costs a locked hash map
+     * insert per allocation, so this is meant for staging and load tests.
+     *
+     * The arena calls `GuardFront` and `GuardBack` back to back under its thread policy,
+     * the block is registered once both guards are written.
+     */
+    class ScrubbedBoundsChecking {
+    public:
+        ScrubbedBoundsChecking() = default;
+        /**
+         * @brief Drops the blocks still live when the arena goes away, their memory is about to be reused.
+         */
+        ~ScrubbedBoundsChecking() noexcept { s_registry.UnregisterOwner(this); }
+        ScrubbedBoundsChecking(const ScrubbedBoundsChecking&) = delete;
+        ScrubbedBoundsChecking(ScrubbedBoundsChecking&&) = delete;
+        auto operator=(const ScrubbedBoundsChecking &) -> ScrubbedBoundsChecking & = delete;
+        auto operator=(ScrubbedBoundsChecking &&) -> ScrubbedBoundsChecking & = delete;
+        auto operator==(const ScrubbedBoundsChecking& other) const -> bool = delete;
+
+        static constexpr std::size_t SIZE_FRONT{ SimpleBoundsChecking::SIZE_FRONT };
+        static constexpr std::size_t SIZE_BACK{ SimpleBoundsChecking::SIZE_BACK };
+        static constexpr std::uint8_t GUARD_PATTERN{ SimpleBoundsChecking::GUARD_PATTERN };
+
+        auto GuardFront(std::byte* ptr) noexcept -> void {
+            Utility::FillPattern(ptr, SIZE_FRONT, GUARD_PATTERN);
+            m_pending_front = ptr;
+        }
+        auto GuardBack(std::byte* ptr) noexcept -> void {
+            Utility::FillPattern(ptr, SIZE_BACK, GUARD_PATTERN);
+            s_registry.Register(this, m_pending_front, ptr);
+            m_pending_front = nullptr;
+        }
+
+        /**
+         * @brief Verifies the front guard and removes the block from the registry before the allocator reuses it.
+         */
+        static auto CheckFront(const std::byte* ptr) noexcept -> void {
+            s_registry.Unregister(ptr);
+            (void)VerifyGuard(ptr, SIZE_FRONT, GUARD_PATTERN, "front");
+        }
+        static auto CheckBack(const std::byte* ptr) noexcept -> void { (void)VerifyGuard(ptr, SIZE_BACK, GUARD_PATTERN, "back"); }
+
+        /**
+         * @brief Registry holding the guards of every live block allocated through this policy.
+         */
+        [[nodiscard]] static auto GetRegistry() noexcept -> GuardRegistry& { return s_registry; }
+
+    private:
+        std::byte* m_pending_front{ nullptr };
+
+        static inline GuardRegistry s_registry{ SIZE_FRONT, SIZE_BACK, GUARD_PATTERN };
+    };
 }
@@ -0,0 +1,188 @@
+#pragma once
+#include <Arena/AllocationPolicy.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Synapse::Memory::Arena {
+    /**
+     * @brief Reference to a block of a `CompactingArena`, stays valid when the block moves.
+     *
+     * Generation 0 is never issued, a default constructed handle is the null handle.
+     */
+    struct RelocatableHandle {
+        std::uint32_t index{ 0U };
+        std::uint32_t generation{ 0U };
+
+        [[nodiscard]] constexpr auto IsNull() const noexcept -> bool { return generation == 0U; }
+        constexpr auto operator==(const RelocatableHandle &other) const noexcept -> bool = default;
+    };
+
+    /**
+     * @brief Counters describing how well packed a `CompactingArena` is.
+     */
+    struct CompactionStatistics {
+        std::size_t live_bytes{ 0U };       ///< Bytes of live blocks, headers included.
+        std::size_t used_bytes{ 0U };       ///< Bytes between the start of the area and the allocation cursor.
+        std::size_t moved_bytes{ 0U };      ///< Bytes moved by compaction since construction.
+        std::size_t released_bytes{ 0U };   ///< Bytes handed back to the operating system since construction.
+        std::uint64_t completed_passes{ 0U };
+    };
+
+    // This is not thread safe, if you use it in multithreaded context you need to manage locking
+    /**
+     * @brief Arena handing out relocatable handles, whose blocks are compacted incrementally.
+     *
+     * A free-list heap serving a long running server fragments over time: free space ends up
+     * scattered in holes too small for the requests that arrive. This arena bump allocates,
+     * and `Compact` slides live blocks toward the start of the area in bounded time slices,
+     * e.g. at the end of a server tick. The handle table is updated as blocks move, so the
+     * user holds handles and resolves them to pointers when accessing the data.
+     *
+     * Every block is preceded by a 16 byte header and padded to 16 bytes, alignment padding
+     * is turned into dead filler blocks, so the area can be walked block by block. When a
+     * pass completes, the pages above the allocation cursor are returned to the operating
+     * system, so the resident size follows the live data.
+     *
+     * A pointer from `Resolve` is valid until the next `Compact` or `Free` call. Blocks that
+     * have to stay put across compaction, e.g. while an I/O operation writes into them, are
+     * pinned with `Pin` and `Unpin`. Compaction packs the blocks after a pinned block behind
+     * it, so pins are meant to be short lived.
+     *
+     * @code{.cpp}
+     * HeapArea area{ 256 * 1024 * 1024 };
+     * CompactingArena arena{ area };
+     * const RelocatableHandle session{ arena.Allocate(sizeof(SessionState), alignof(SessionState)) };
+     * ...
+     * auto *state{ std::bit_cast<SessionState *>(arena.Resolve(session)) };
+     * ...
+     * // Idle part of the tick
+     * (void)arena.Compact(std::chrono::microseconds(200));
+     * @endcode
+     */
+    class CompactingArena {
+    public:
+        /**
+         * @brief Blocks are aligned to at least this, larger alignments cost filler blocks.
+         */
+        static constexpr std::size_t GRANULARITY{ 16U };
+
+        CompactingArena() = delete;
+        /**
+         * @param area Storage provider exposing start/end pointers.
+         */
+        template <AreaPolicy TAreaPolicy>
+        explicit CompactingArena(TAreaPolicy &area) noexcept : CompactingArena(area.GetStart(), area.GetEnd()) {}
+        CompactingArena(std::byte *start, std::byte *end) noexcept;
+        ~CompactingArena() = default;
+
+        CompactingArena(const CompactingArena&) = delete;
+        CompactingArena(CompactingArena&&) = delete;
+        auto operator=(const CompactingArena &) -> CompactingArena & = delete;
+        auto operator=(CompactingArena &&) -> CompactingArena & = delete;
+        auto operator==(const CompactingArena &other) const -> bool = delete;
+
+        /**
+         * @brief Allocates a block at the end of the used part of the area.
+         * @return Handle to the block, the null handle if the area is full; compacting may make room.
+         */
+        [[nodiscard]] auto Allocate(std::size_t size, std::size_t alignment) noexcept -> RelocatableHandle;
+
+        /**
+         * @brief Frees a block, the space is reclaimed by the next compaction pass.
+         * @return `false` if the handle is stale or null.
+         */
+        auto Free(RelocatableHandle handle) noexcept -> bool;
+
+        /**
+         * @brief Current address of a block.
+         * @return `nullptr` if the handle is stale or null.
+         */
+        [[nodiscard]] auto Resolve(RelocatableHandle handle) const noexcept -> std::byte *;
+
+        /**
+         * @brief Size requested for a block, 0 if the handle is stale or null.
+         */
+        [[nodiscard]] auto GetAllocationSize(RelocatableHandle handle) const noexcept -> std::size_t;
+
+        /**
+         * @brief Keeps a block in place during compaction until the matching `Unpin`, pins nest.
+         * @return Address of the block, `nullptr` if the handle is stale or null.
+         */
+        auto Pin(RelocatableHandle handle) noexcept -> std::byte *;
+        auto Unpin(RelocatableHandle handle) noexcept -> void;
+
+        /**
+         * @brief Moves live blocks toward the start of the area until the pass ends or the budget runs out.
+         *
+         * A pass resumes where the previous call stopped. The clock is checked after every
+         * `COMPACTION_STEP_BYTES` of moved data, so a call may overrun the budget by one step.
+         * @param budget Time the call may spend compacting.
+         * @return `true` if the pass completed.
+         */
+        auto Compact(std::chrono::nanoseconds budget) noexcept -> bool;
+
+        /**
+         * @brief Moves at most `max_bytes` of live blocks, the deterministic form of `Compact`.
+         * @return `true` if the pass completed.
+         */
+        auto CompactStep(std::size_t max_bytes) noexcept -> bool;
+
+        [[nodiscard]] auto GetStatistics() const noexcept -> CompactionStatistics;
+        /**
+         * @brief Share of the used part of the area that is not live data, between 0 and 1.
+         */
+        [[nodiscard]] auto GetFragmentation() const noexcept -> double;
+        [[nodiscard]] auto GetLiveCount() const noexcept -> std::size_t { return m_live_count; }
+        [[nodiscard]] auto GetSize() const noexcept -> std::size_t { return static_cast<std::size_t>(m_end - m_start); }
+
+        /**
+         * @brief Amount of data `Compact` moves between two clock reads.
+         */
+        static constexpr std::size_t COMPACTION_STEP_BYTES{ 64U * 1024U };
+
+    private:
+        struct BlockHeader {
+            std::uint32_t size;          ///< Requested size, the payload is padded to `GRANULARITY`.
+            std::uint32_t handle_index;  ///< `NO_HANDLE` for freed blocks and filler.
+            std::uint32_t alignment;
+            std::uint32_t reserved;
+        };
+        static_assert(sizeof(BlockHeader) == GRANULARITY);
+
+        struct HandleEntry {
+            std::byte *header;
+            std::uint32_t generation;
+            std::uint32_t pins;
+            std::uint32_t next_free;
+        };
+
+        static constexpr std::uint32_t NO_HANDLE{ 0xFFFFFFFFU };
+
+        [[nodiscard]] static auto ReadHeader(const std::byte *header) noexcept -> BlockHeader;
+        static auto WriteHeader(std::byte *header, const BlockHeader &block) noexcept -> void;
+        static auto WriteFiller(std::byte *begin, const std::byte *end) noexcept -> void;
+        [[nodiscard]] static auto GetSpan(const BlockHeader &block) noexcept -> std::size_t;
+
+        [[nodiscard]] auto FindEntry(RelocatableHandle handle) const noexcept -> const HandleEntry *;
+        auto AcquireEntry() noexcept -> std::uint32_t;
+        auto FinishPass() noexcept -> void;
+        auto ReleasePages() noexcept -> void;
+
+        std::byte *m_start;
+        std::byte *m_end;
+        std::byte *m_top;              ///< Allocation cursor, every block lies below it.
+        std::byte *m_scan;             ///< Next block the running pass examines.
+        std::byte *m_compacted;        ///< End of the compacted prefix of the running pass.
+        std::byte *m_committed;        ///< Highest address touched since pages were last released.
+
+        std::vector<HandleEntry> m_handles{};
+        std::uint32_t m_free_handle{ NO_HANDLE };
+        std::size_t m_live_count{ 0U };
+        std::size_t m_live_bytes{ 0U };
+        std::size_t m_moved_bytes{ 0U };
+        std::size_t m_released_bytes{ 0U };
+        std::uint64_t m_completed_passes{ 0U };
+    };
+}
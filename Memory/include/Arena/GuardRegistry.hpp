@@ -0,0 +1,95 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <ankerl/unordered_dense.h>
+
+namespace Synapse::Memory::Arena {
+    /**
+     * @brief Outcome of verifying a batch of registered guards.
+     */
+    struct GuardScrubResult {
+        std::size_t blocks{ 0U };      ///< Number of blocks whose guards were verified.
+        std::size_t bytes{ 0U };       ///< Number of guard bytes compared.
+        std::size_t violations{ 0U };  ///< Number of blocks with an overwritten guard.
+    };
+
+    /**
+     * @brief Set of live guarded blocks, verified in batches by a `GuardScrubber`.
+     *
+     * Blocks are kept in a dense array so a sweep is a linear walk, a hash map from the front
+     * guard to the array index keeps removal O(1). Removal swaps the last block into the hole,
+     * so a block can be skipped by a sweep running at the same time, the next sweep covers it.
+     * Each damaged block is reported once.
+     *
+     * Both containers are reserved up front and the map keeps its entries in one array, so
+     * registering does not allocate under the lock until the reserved capacity is exceeded.
+     */
+    class GuardRegistry {
+    public:
+        /**
+         * @param capacity Number of live blocks reserved for, the registry grows past it.
+         */
+        GuardRegistry(std::size_t front_size, std::size_t back_size, std::uint8_t pattern, std::size_t capacity = 4096U);
+        ~GuardRegistry() = default;
+
+        GuardRegistry(const GuardRegistry&) = delete;
+        GuardRegistry(GuardRegistry&&) = delete;
+        auto operator=(const GuardRegistry &) -> GuardRegistry & = delete;
+        auto operator=(GuardRegistry &&) -> GuardRegistry & = delete;
+        auto operator==(const GuardRegistry &other) const -> bool = delete;
+
+        /**
+         * @brief Adds a block whose guards have been written.
+         * @param owner       Policy instance the block belongs to, see `UnregisterOwner`.
+         * @param front_guard First byte of the front guard.
+         * @param back_guard  First byte of the back guard.
+         */
+        auto Register(const void *owner, const std::byte *front_guard, const std::byte *back_guard) noexcept -> void;
+
+        /**
+         * @brief Removes a block, must happen before the allocator is allowed to reuse its memory.
+         * @param front_guard First byte of the front guard passed to `Register`.
+         */
+        auto Unregister(const std::byte *front_guard) noexcept -> void;
+
+        /**
+         * @brief Removes every block of an owner, e.g. when its arena is destroyed with blocks still live.
+         */
+        auto UnregisterOwner(const void *owner) noexcept -> void;
+
+        /**
+         * @brief Verifies up to `max_blocks` blocks starting at `cursor` and advances the cursor.
+         *
+         * The lock is held for one batch only, so allocations and frees on other threads are
+         * delayed by at most one batch worth of compares.
+         * @param cursor     Position of the sweep, start a new sweep with 0.
+         * @param max_blocks Upper bound of blocks verified under one lock acquisition.
+         * @param result     Accumulates the verified blocks, bytes and violations.
+         * @return `true` once the sweep reached the end of the registry.
+         */
+        auto ScrubBatch(std::size_t &cursor, std::size_t max_blocks, GuardScrubResult &result) noexcept -> bool;
+
+        /**
+         * @brief Number of registered blocks.
+         */
+        [[nodiscard]] auto GetCount() const noexcept -> std::size_t;
+
+    private:
+        struct GuardedBlock {
+            const void *owner;
+            const std::byte *front_guard;
+            const std::byte *back_guard;
+            bool reported;
+        };
+
+        const std::size_t m_front_size;
+        const std::size_t m_back_size;
+        const std::uint8_t m_pattern;
+
+        mutable std::mutex m_mutex{};
+        std::vector<GuardedBlock> m_blocks{};
+        ankerl::unordered_dense::map<const std::byte *, std::size_t> m_indices{};
+    };
+}
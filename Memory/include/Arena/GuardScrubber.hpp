@@ -0,0 +1,93 @@
+#pragma once
+#include <Arena/GuardRegistry.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace Synapse::Memory::Arena {
+    /**
+     * @brief Background thread that periodically verifies every live guard of a `GuardRegistry`.
+     *
+     * Catches memory stomps while the damaged block is still in use, instead of when it is
+     * freed. Each sweep walks the registry in batches, and the time spent sweeping is
+     * recorded, so the cost of scrubbing can be read next to the load test results.
+     *
+     * @code{.cpp}
+     * using StagingArena = MemoryArena<FreeListAllocator<ScrubbedBoundsChecking::SIZE_FRONT>, SingleThreadPolicy,
+     *         ScrubbedBoundsChecking, NoMemoryTracking, SimpleMemoryTagging>;
+     * GuardScrubber scrubber{ ScrubbedBoundsChecking::GetRegistry() };
+     * scrubber.Start();
+     * ...
+     * scrubber.Stop();
+     * @endcode
+     */
+    class GuardScrubber {
+    public:
+        /**
+         * @param registry   Guards to verify.
+         * @param interval   Pause between two sweeps.
+         * @param batch_size Blocks verified per registry lock acquisition.
+         */
+        explicit GuardScrubber(GuardRegistry &registry, std::chrono::milliseconds interval = std::chrono::milliseconds(100),
+                std::size_t batch_size = 256U) noexcept;
+        ~GuardScrubber() noexcept;
+
+        GuardScrubber(const GuardScrubber&) = delete;
+        GuardScrubber(GuardScrubber&&) = delete;
+        auto operator=(const GuardScrubber &) -> GuardScrubber & = delete;
+        auto operator=(GuardScrubber &&) -> GuardScrubber & = delete;
+        auto operator==(const GuardScrubber &other) const -> bool = delete;
+
+        /**
+         * @brief Starts the scrubber thread.
+         * @return `false` if the scrubber is already running.
+         */
+        auto Start() noexcept -> bool;
+
+        /**
+         * @brief Stops the scrubber thread, waiting for the current batch to finish.
+         */
+        auto Stop() noexcept -> void;
+
+        /**
+         * @brief Runs one full sweep on the calling thread, e.g. at the end of a test.
+         */
+        auto Sweep() noexcept -> GuardScrubResult;
+
+        [[nodiscard]] auto IsRunning() const noexcept -> bool { return m_thread.joinable(); }
+        /**
+         * @brief Number of completed sweeps.
+         */
+        [[nodiscard]] auto GetSweepCount() const noexcept -> std::uint64_t { return m_sweeps.load(std::memory_order_relaxed); }
+        /**
+         * @brief Number of damaged blocks found, a block stays damaged and is counted again by every sweep.
+         */
+        [[nodiscard]] auto GetViolationCount() const noexcept -> std::uint64_t { return m_violations.load(std::memory_order_relaxed); }
+        /**
+         * @brief Guard bytes compared over all sweeps.
+         */
+        [[nodiscard]] auto GetCheckedBytes() const noexcept -> std::uint64_t { return m_checked_bytes.load(std::memory_order_relaxed); }
+        /**
+         * @brief Total time spent sweeping, the cost of the scrubber.
+         */
+        [[nodiscard]] auto GetBusyTime() const noexcept -> std::chrono::nanoseconds {
+            return std::chrono::nanoseconds{ m_busy_nanoseconds.load(std::memory_order_relaxed) };
+        }
+
+    private:
+        auto ScrubThread(const std::stop_token &stop_token) noexcept -> void;
+
+        GuardRegistry &m_registry;
+        const std::chrono::milliseconds m_interval;
+        const std::size_t m_batch_size;
+
+        std::atomic<std::uint64_t> m_sweeps{ 0U };
+        std::atomic<std::uint64_t> m_violations{ 0U };
+        std::atomic<std::uint64_t> m_checked_bytes{ 0U };
+        std::atomic<std::uint64_t> m_busy_nanoseconds{ 0U };
+
+        std::jthread m_thread{};
+    };
+}
@@ -2,9 +2,13 @@
 
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <source_location>
 #include <type_traits>
+#include <utility>
+#include <algorithm>
 #include <Arena/AllocationPolicy.hpp>
+#include <Arena/ArenaStatistics.hpp>
 #include <Arena/BoundsCheckingPolicy.hpp>
 #include <Arena/ThreadPolicy.hpp>
 #include <Arena/MemoryTrackingPolicy.hpp>
@@ -57,13 +61,14 @@ namespace Synapse::Memory::Arena {
     public:
         MemoryArena() = delete;
 
-        template <AreaPolicy TAreaPolicy>
         /**
          * @brief Constructs a memory arena using the provided backing area.
-         * @param area Storage provider exposing start/end pointers.
+         * @param area        Storage provider exposing start/end pointers.
+         * @param thread_args Forwarded to the thread policy, e.g. the primitive of a `MultiThreadPolicy`.
          */
-        explicit MemoryArena(const TAreaPolicy& area) noexcept
-            : m_allocator(area.GetStart(), area.GetEnd()) {
+        template <AreaPolicy TAreaPolicy, typename... TThreadArgs>
+        explicit MemoryArena(TAreaPolicy& area, TThreadArgs&&... thread_args) noexcept
+            : m_allocator(area.GetStart(), area.GetEnd()), m_thread_guard(std::forward<TThreadArgs>(thread_args)...) {
         }
         ~MemoryArena() = default;
 
@@ -89,6 +94,16 @@ namespace Synapse::Memory::Arena {
 
             // The allocators have a TOffset template parameter that has to match the TBoundsChecking::SIZE_FRONT
             auto plain_memory{ static_cast<std::byte*>(m_allocator.Allocate(new_size, alignment)) };
+            if (plain_memory == nullptr) {
+                ++m_failed_allocations;
+                m_thread_guard.Leave();
+                return nullptr;
+            }
+            ++m_allocation_count;
+            ++m_total_allocations;
+            if constexpr (StatisticsPolicy<TAllocator>) {
+                m_peak_used = std::max(m_peak_used, m_allocator.GetUsed());
+            }
 
             m_bounds_checker.GuardFront(plain_memory);
             m_memory_tagger.TagAllocation(plain_memory + TBoundsChecking::SIZE_FRONT, original_size);
@@ -103,9 +118,12 @@ namespace Synapse::Memory::Arena {
 
         /**
          * @brief Frees memory previously allocated by this arena.
+         *
+         * Reads the size back from the allocator, prefer the sized overload when the size is known.
          * @param ptr Pointer returned by Allocate.
          */
-        auto Deallocate(std::byte *ptr) noexcept -> void {
+        auto Deallocate(std::byte *ptr) noexcept -> void
+            requires AllocationSizePolicy<TAllocator> && UnsizedDeallocationPolicy<TAllocator> {
             m_thread_guard.Enter();
 
             std::byte* original_memory{ ptr - TBoundsChecking::SIZE_FRONT };
@@ -119,15 +137,84 @@ namespace Synapse::Memory::Arena {
             m_memory_tracker.OnDeallocation(original_memory);
 
             m_allocator.Deallocate(original_memory);
+            --m_allocation_count;
 
             m_thread_guard.Leave();
         }
 
+        /**
+         * @brief Frees memory previously allocated by this arena, with the size and alignment it was allocated with.
+         *
+         * Skips reading the size back from the allocator, so allocators that support sized
+         * deallocation can run without a size header in front of every block.
+         * @param ptr       Pointer returned by Allocate.
+         * @param size      Size passed to Allocate.
+         * @param alignment Alignment passed to Allocate.
+         */
+        auto Deallocate(std::byte *ptr, const std::size_t size, [[maybe_unused]] const std::size_t alignment) noexcept -> void {
+            m_thread_guard.Enter();
+
+            std::byte* original_memory{ ptr - TBoundsChecking::SIZE_FRONT };
+            const std::size_t allocation_size{ size + TBoundsChecking::SIZE_BACK };
+
+            m_bounds_checker.CheckFront(original_memory);
+            m_memory_tagger.TagDeallocation(ptr, size);
+            m_bounds_checker.CheckBack(ptr + size);
+
+            m_memory_tracker.OnDeallocation(original_memory, allocation_size);
+
+            if constexpr (SizedDeallocationPolicy<TAllocator>) {
+                m_allocator.Deallocate(original_memory, allocation_size, alignment);
+            } else {
+                m_allocator.Deallocate(original_memory);
+            }
+            --m_allocation_count;
+
+            m_thread_guard.Leave();
+        }
+
+        /**
+         * @brief Collects the counters of the arena and the free space of the allocator.
+         *
+         * The counters are plain integers updated inside the thread guard, the free space is
+         * queried from the allocator, which walks its free list for a free-list allocator.
+         */
+        [[nodiscard]] auto GetStatistics() noexcept -> ArenaStatistics
+            requires StatisticsPolicy<TAllocator> {
+            m_thread_guard.Enter();
+            const Allocator::FreeSpaceStatistics free_space{ m_allocator.GetFreeSpace() };
+            const ArenaStatistics statistics{
+                .capacity = m_allocator.GetSize(),
+                .bytes_in_use = m_allocator.GetUsed(),
+                .peak_bytes_in_use = m_peak_used,
+                .allocation_count = m_allocation_count,
+                .total_allocations = m_total_allocations,
+                .failed_allocations = m_failed_allocations,
+                .free_bytes = free_space.free_bytes,
+                .free_block_count = free_space.free_block_count,
+                .largest_free_block = free_space.largest_free_block
+            };
+            m_thread_guard.Leave();
+            return statistics;
+        }
+
+        /**
+         * @brief Returns total managed capacity in bytes.
+         */
+        [[nodiscard]] auto GetSize() const noexcept -> std::size_t
+            requires StatisticsPolicy<TAllocator> {
+            return m_allocator.GetSize();
+        }
+
     private:
         TAllocator m_allocator;
         TThread m_thread_guard;
         NO_UNIQUE_ADDRESS TBoundsChecking m_bounds_checker;
         NO_UNIQUE_ADDRESS TMemoryTracking m_memory_tracker;
         NO_UNIQUE_ADDRESS TMemoryTagging m_memory_tagger;
+        std::size_t m_allocation_count{ 0U };
+        std::size_t m_peak_used{ 0U };
+        std::uint64_t m_total_allocations{ 0U };
+        std::uint64_t m_failed_allocations{ 0U };
     };
 }
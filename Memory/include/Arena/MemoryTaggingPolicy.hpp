@@ -1,6 +1,8 @@
 #pragma once
 #include <cstddef>
+#include <cstdint>
 #include <concepts>
+#include <PatternUtility.hpp>
 
 namespace Synapse::Memory::Arena {
     /*
@@ -8,13 +10,11 @@ namespace Synapse::Memory::Arena {
      * Options:
      * On or off
     */
-    /// \todo The Visual Studio Debug Heap implementation marks newly allocated heap memory with 0xCDCDCDCD, and freed memory with 0xDDDDDDDD.
-    /// \todo 0xDC fill pattern, destroy pattern 0xEF
     /**
      * @brief Concept for policies that paint allocations/deallocations with patterns.
      */
     template <typename TPolicy>
-    concept MemoryTaggingPolicy = requires(const TPolicy p, const void* ptr, const std::size_t size) {
+    concept MemoryTaggingPolicy = requires(TPolicy& p, std::byte* ptr, const std::size_t size) {
         p.TagAllocation(ptr, size);
         p.TagDeallocation(ptr, size);
     };
@@ -24,7 +24,7 @@ namespace Synapse::Memory::Arena {
      */
     class NoMemoryTagging {
     public:
-        NoMemoryTagging() = delete;
+        NoMemoryTagging() = default;
         auto operator==(const NoMemoryTagging &other) const -> bool = delete;
 
         static auto TagAllocation([[maybe_unused]] void *ptr, [[maybe_unused]] std::size_t size) -> void {}
@@ -32,4 +32,27 @@ namespace Synapse::Memory::Arena {
         static auto TagDeallocation([[maybe_unused]] void *ptr,
                 [[maybe_unused]] std::size_t size) -> void {}
     };
+
+    /**
+     * @brief Paints fresh allocations and freed blocks with the patterns of the MSVC debug heap.
+     *
+     * Reading 0xCDCDCDCD points at uninitialised memory, reading 0xDDDDDDDD at a dangling
+     * pointer. The fill uses vector stores, see `Utility::FillPattern`.
+     */
+    class SimpleMemoryTagging {
+    public:
+        SimpleMemoryTagging() = default;
+        auto operator==(const SimpleMemoryTagging &other) const -> bool = delete;
+
+        static constexpr std::uint8_t ALLOCATION_PATTERN{ 0xCD };
+        static constexpr std::uint8_t DEALLOCATION_PATTERN{ 0xDD };
+
+        static auto TagAllocation(std::byte *ptr, const std::size_t size) noexcept -> void {
+            Utility::FillPattern(ptr, size, ALLOCATION_PATTERN);
+        }
+
+        static auto TagDeallocation(std::byte *ptr, const std::size_t size) noexcept -> void {
+            Utility::FillPattern(ptr, size, DEALLOCATION_PATTERN);
+        }
+    };
 }
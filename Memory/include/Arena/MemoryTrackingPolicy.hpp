@@ -21,9 +21,10 @@ namespace Synapse::Memory::Arena {
      * @brief Concept for policies that record allocation/deallocation events.
      */
     template <typename TPolicy>
-    concept MemoryTrackingPolicy = requires(const TPolicy p, void* ptr, const std::size_t size, const std::size_t alignment, const std::source_location& source_info) {
+    concept MemoryTrackingPolicy = requires(TPolicy& p, void* ptr, const std::size_t size, const std::size_t alignment, const std::source_location& source_info) {
         p.OnAllocation(ptr, size, alignment, source_info);
         p.OnDeallocation(ptr);
+        p.OnDeallocation(ptr, size);
     };
 
     /**
@@ -31,7 +32,7 @@ namespace Synapse::Memory::Arena {
      */
     class NoMemoryTracking {
     public:
-        NoMemoryTracking() = delete;
+        NoMemoryTracking() = default;
         auto operator==(const NoMemoryTracking &other) const -> bool = delete;
 
         /**
@@ -45,11 +46,16 @@ namespace Synapse::Memory::Arena {
          * @brief Ignores deallocation event.
          */
         static auto OnDeallocation([[maybe_unused]] void *ptr) noexcept -> void {}
+
+        /**
+         * @brief Ignores sized deallocation event.
+         */
+        static auto OnDeallocation([[maybe_unused]] void *ptr, [[maybe_unused]] std::size_t size) noexcept -> void {}
     };
 
     class TracyMemoryTracking {
     public:
-        TracyMemoryTracking() = delete;
+        TracyMemoryTracking() = default;
         auto operator==(const TracyMemoryTracking &other) const -> bool = delete;
 
                 /**
@@ -71,6 +77,15 @@ namespace Synapse::Memory::Arena {
         static auto OnDeallocation(void *ptr) noexcept -> void {
             DEBUG_ASSERT(ptr != nullptr, "Invalid deallocation, null pointer");
         }
+
+        /**
+         * @brief Records a sized deallocation event and removes tracking from tracy.
+         * @param ptr  Pointer originally passed to `OnAllocation`.
+         * @param size Size originally passed to `OnAllocation`.
+         */
+        static auto OnDeallocation(void *ptr, [[maybe_unused]] std::size_t size) noexcept -> void {
+            OnDeallocation(ptr);
+        }
     };
 
     /**
@@ -89,7 +104,7 @@ namespace Synapse::Memory::Arena {
             std::string function;
         };
 
-        PostitionMemoryTracking() = delete;
+        PostitionMemoryTracking() = default;
         auto operator==(const PostitionMemoryTracking &other) const -> bool = delete;
 
         /**
@@ -130,6 +145,23 @@ namespace Synapse::Memory::Arena {
             }
         }
 
+        /**
+         * @brief Records a sized deallocation event, checks the size and removes tracking metadata.
+         * @param ptr  Pointer originally passed to `OnAllocation`.
+         * @param size Size the caller claims the allocation has, must match the recorded size.
+         */
+        static auto OnDeallocation(void *ptr, [[maybe_unused]] std::size_t size) noexcept -> void {
+            DEBUG_ASSERT(ptr != nullptr, "Invalid deallocation, null pointer");
+            DEBUG_ASSERT(s_live_allocations > 0U, "Invalid deallocation, no live allocation");
+            std::scoped_lock lock{s_mutex};
+            const auto it = s_allocations.find(ptr);
+            if (it != s_allocations.end()) {
+                DEBUG_ASSERT(it->second.size == size, "Sized deallocation does not match the allocation size", it->second.size, size);
+                s_allocations.erase(it);
+                --s_live_allocations;
+            }
+        }
+
         /**
          * @brief Number of currently live allocations tracked.
          */
@@ -186,7 +218,7 @@ namespace Synapse::Memory::Arena {
             std::stacktrace stack;
         };
 
-        CompleteMemoryTracking() = delete;
+        CompleteMemoryTracking() = default;
         auto operator==(const CompleteMemoryTracking &other) const -> bool = delete;
 
         /**
@@ -228,6 +260,23 @@ namespace Synapse::Memory::Arena {
             }
         }
 
+        /**
+         * @brief Records a sized deallocation event, checks the size and removes tracking metadata.
+         * @param ptr  Pointer originally passed to `OnAllocation`.
+         * @param size Size the caller claims the allocation has, must match the recorded size.
+         */
+        static auto OnDeallocation(void *ptr, [[maybe_unused]] std::size_t size) noexcept -> void {
+            DEBUG_ASSERT(ptr != nullptr, "Invalid deallocation, null pointer");
+            DEBUG_ASSERT(s_live_allocations > 0U, "Invalid deallocation, no live allocation");
+            std::scoped_lock lock{s_mutex};
+            const auto it = s_allocations.find(ptr);
+            if (it != s_allocations.end()) {
+                DEBUG_ASSERT(it->second.size == size, "Sized deallocation does not match the allocation size", it->second.size, size);
+                s_allocations.erase(it);
+                --s_live_allocations;
+            }
+        }
+
         /**
          * @brief Number of currently live allocations tracked.
          */
@@ -1,13 +1,16 @@
 #pragma once
+#include <Arena/AllocationEvent.hpp>
+#include <Arena/AllocationRecorder.hpp>
 #include <cstddef>
 #include <source_location>
 
 namespace Synapse::Memory::Arena {
     /**
-     * @brief Decorator arena that forwards calls while optionally recording them.
+     * @brief Decorator arena that forwards calls while recording them.
      *
-     * Intended for instrumentation (e.g., sending allocation data over the
-     * network) without changing the underlying arena implementation.
+     * Every allocation and deallocation is written as a binary `AllocationEvent` into the
+     * calling thread's ring of the `AllocationRecorder`, which streams them to a file or a
+     * local socket. The wrapped arena is left unchanged.
      */
     template <class TArena>
     class RecordingArena {
@@ -15,7 +18,7 @@ namespace Synapse::Memory::Arena {
         RecordingArena() = delete;
         ~RecordingArena() = default;
 
-        explicit RecordingArena(TArena& arena) noexcept : m_arena(arena) {}
+        RecordingArena(TArena& arena, AllocationRecorder& recorder) noexcept : m_arena(arena), m_recorder(recorder) {}
         RecordingArena(const RecordingArena&) = delete;
         RecordingArena(RecordingArena&&) = delete;
         auto operator=(const RecordingArena &) -> RecordingArena & = delete;
@@ -23,28 +26,39 @@ namespace Synapse::Memory::Arena {
         auto operator==(const RecordingArena &other) const -> bool = delete;
 
         /**
-         * @brief Forwards allocation to the wrapped arena.
+         * @brief Forwards allocation to the wrapped arena and records it.
          * @param size       Requested size.
          * @param alignment  Alignment requirement.
          * @param source_location Optional caller metadata.
          */
         [[nodiscard]] auto Allocate(const std::size_t size, const std::size_t alignment,
                 const std::source_location &source_location = std::source_location::current()) noexcept -> std::byte * {
-            // send info via TCP/IP...
-            /// \todo add network
-            return m_arena.Allocate(size, alignment, source_location);
+            std::byte* ptr{ m_arena.Allocate(size, alignment, source_location) };
+            m_recorder.Record(AllocationEventType::Allocate, ptr, size, alignment, MakeCallSiteId(source_location));
+            return ptr;
         }
 
         /**
-         * @brief Forwards deallocation to the wrapped arena.
+         * @brief Records the deallocation and forwards it to the wrapped arena.
          */
-        auto Deallocate(void *ptr) noexcept -> void {
-            // send info via TCP/IP...
-            /// \todo add network
+        auto Deallocate(std::byte *ptr, const std::source_location &source_location = std::source_location::current()) noexcept
+                -> void {
+            // Record before freeing, so a racing allocation reusing the address is ordered after this event
+            m_recorder.Record(AllocationEventType::Deallocate, ptr, 0U, 0U, MakeCallSiteId(source_location));
             m_arena.Deallocate(ptr);
         }
 
+        /**
+         * @brief Records the deallocation with its size and forwards it to the wrapped arena's sized path.
+         */
+        auto Deallocate(std::byte *ptr, const std::size_t size, const std::size_t alignment,
+                const std::source_location &source_location = std::source_location::current()) noexcept -> void {
+            m_recorder.Record(AllocationEventType::Deallocate, ptr, size, alignment, MakeCallSiteId(source_location));
+            m_arena.Deallocate(ptr, size, alignment);
+        }
+
     private:
         TArena& m_arena;
+        AllocationRecorder& m_recorder;
     };
 }
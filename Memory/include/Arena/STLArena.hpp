@@ -1,13 +1,27 @@
 #pragma once
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <new>
 #include <source_location>
+#include <type_traits>
 #include "MemoryArena.hpp"
 
 namespace Synapse::Memory::Arena {
     /**
      * @brief STL-compatible allocator adapter that forwards to a memory arena.
      *
-     * Provides the minimal interface required by standard containers so they
-     * can allocate from a custom `TArena` instance.
+     * Holds a pointer to the arena, so it is cheap to copy and rebinds to the node types
+     * containers allocate internally, e.g. the blocks of a `std::deque`. Two adapters compare
+     * equal when they use the same arena, memory allocated through one can be freed through
+     * the other. The adapter follows the container on copy, move and swap, so memory is
+     * always returned to the arena it came from.
+     *
+     * @code{.cpp}
+     * STLArena<int, ApplicationArena> allocator{ arena };
+     * std::vector<int, STLArena<int, ApplicationArena>> values{ allocator };
+     * std::deque<Message, STLArena<Message, ApplicationArena>> messages{ STLArena<Message, ApplicationArena>{ arena } };
+     * @endcode
      *
      * @tparam TType  Value type requested by the STL container.
      * @tparam TArena Underlying arena type implementing `Allocate`/`Deallocate`.
@@ -16,43 +30,62 @@ namespace Synapse::Memory::Arena {
     class STLArena {
     public:
         using value_type = TType;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
 
         STLArena() = delete;
         ~STLArena() = default;
         /**
          * @brief Constructs an allocator bound to a specific arena instance.
          */
-        explicit STLArena(TArena& arena) noexcept : m_arena(arena) {}
+        explicit STLArena(TArena& arena) noexcept : m_arena(&arena) {}
 
-        template <typename U>
-        explicit STLArena(const STLArena<U, TArena>& other) = delete;
-        template <typename U>
-        explicit STLArena(STLArena<U, TArena>&&) = delete;
-        template <typename U>
-        auto operator=(const STLArena<U, TArena> &) -> STLArena & = delete;
-        template <typename U>
-        auto operator=(STLArena<U, TArena> &&) -> STLArena & = delete;
+        STLArena(const STLArena &) noexcept = default;
+        STLArena(STLArena &&) noexcept = default;
+        auto operator=(const STLArena &) noexcept -> STLArena & = default;
+        auto operator=(STLArena &&) noexcept -> STLArena & = default;
 
+        /**
+         * @brief Rebinding constructor, used by containers to allocate their internal node types from the same arena.
+         */
         template <typename U>
-        auto operator==(const STLArena<U, TArena> &rhs) const -> bool = delete;
+        STLArena(const STLArena<U, TArena>& other) noexcept : m_arena(&other.GetArena()) {}
+
+        /**
+         * @brief Adapters are equal when they allocate from the same arena.
+         */
         template <typename U>
-        auto operator!=(const STLArena<U, TArena> &rhs) const -> bool = delete;
+        [[nodiscard]] auto operator==(const STLArena<U, TArena> &rhs) const noexcept -> bool { return m_arena == &rhs.GetArena(); }
 
         /**
          * @brief Allocates storage for `n` objects of `TType`.
+         * @throws std::bad_alloc if the arena is out of memory, standard containers do not check for `nullptr`.
          */
-        [[nodiscard]] constexpr auto allocate(const std::size_t n) noexcept -> TType * { return static_cast<TType*>(m_arena.Allocate(n * sizeof(TType), alignof(TType), std::source_location::current())); }
+        [[nodiscard]] auto allocate(const std::size_t n) -> TType * {
+            if (n > (std::numeric_limits<std::size_t>::max() / sizeof(TType))) {
+                throw std::bad_array_new_length();
+            }
+            std::byte *memory{ m_arena->Allocate(n * sizeof(TType), alignof(TType), std::source_location::current()) };
+            if (memory == nullptr) {
+                throw std::bad_alloc();
+            }
+            return std::bit_cast<TType*>(memory);
+        }
         /**
-         * @brief Releases storage previously allocated with `allocate`.
+         * @brief Releases storage previously allocated with `allocate`, the container knows `n` so the size is passed on.
          */
-        constexpr auto deallocate(TType *p, [[maybe_unused]] std::size_t n) noexcept -> void { m_arena.Deallocate(p); }
+        auto deallocate(TType *p, const std::size_t n) noexcept -> void { m_arena->Deallocate(std::bit_cast<std::byte*>(p), n * sizeof(TType), alignof(TType)); }
 
         /**
          * @brief Reports the maximum number of bytes this allocator can provide.
          */
-        [[nodiscard]] auto MaxAllocationSize() const noexcept -> std::size_t { return m_arena.GetSize(); }
+        [[nodiscard]] auto MaxAllocationSize() const noexcept -> std::size_t { return m_arena->GetSize(); }
+
+        [[nodiscard]] auto GetArena() const noexcept -> TArena & { return *m_arena; }
 
     private:
-        TArena& m_arena;
+        TArena* m_arena;
     };
 }
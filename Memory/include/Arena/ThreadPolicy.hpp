@@ -1,13 +1,14 @@
 #pragma once
 #include <cstddef>
 #include <concepts>
+#include <utility>
 
 namespace Synapse::Memory::Arena {
     /**
      * @brief Concept describing synchronization hooks required by arenas.
      */
     template <typename TPolicy>
-    concept ThreadPolicy = requires(const TPolicy p) {
+    concept ThreadPolicy = requires(TPolicy& p) {
         p.Enter();
         p.Leave();
     };
@@ -17,7 +18,7 @@ namespace Synapse::Memory::Arena {
      */
     class SingleThreadPolicy {
     public:
-        SingleThreadPolicy() = delete;
+        SingleThreadPolicy() = default;
         auto operator==(const SingleThreadPolicy &other) const -> bool = delete;
 
         static auto Enter() noexcept -> void {}
@@ -31,7 +32,7 @@ namespace Synapse::Memory::Arena {
     template <class TSynchronizationPrimitive>
     class MultiThreadPolicy {
     public:
-        explicit MultiThreadPolicy(const TSynchronizationPrimitive& primitive) noexcept
+        explicit MultiThreadPolicy(TSynchronizationPrimitive& primitive) noexcept
             : m_primitive(primitive) {
         }
         MultiThreadPolicy() = delete;
@@ -40,14 +41,14 @@ namespace Synapse::Memory::Arena {
         /**
          * @brief Acquires the underlying synchronization primitive.
          */
-        auto Enter() noexcept -> void {
+        auto Enter() noexcept(noexcept(std::declval<TSynchronizationPrimitive&>().Enter())) -> void {
             m_primitive.Enter();
         }
 
         /**
          * @brief Releases the underlying synchronization primitive.
          */
-        auto Leave() noexcept -> void {
+        auto Leave() noexcept(noexcept(std::declval<TSynchronizationPrimitive&>().Leave())) -> void {
             m_primitive.Leave();
         }
 
@@ -0,0 +1,114 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+
+namespace Synapse::Memory::Utility {
+    /**
+     * @brief Fills a memory range with a repeated byte pattern.
+     *
+     * Uses the widest vector stores available for the target (AVX2, SSE2 or NEON) with
+     * unaligned stores, so it works for guard regions and blocks at any address. AVX2 builds
+     * finish with one 128-bit store, so a 16 byte guard is a single store. The tail that does
+     * not fill a whole vector is written byte by byte.
+     *
+     * @param ptr     First byte of the range.
+     * @param size    Size of the range in bytes.
+     * @param pattern Byte value written to every byte of the range.
+     */
+    inline auto FillPattern(std::byte *ptr, const std::size_t size, const std::uint8_t pattern) noexcept -> void {
+        std::size_t i{ 0U };
+#if defined(__AVX2__)
+        const __m256i value{ _mm256_set1_epi8(static_cast<char>(pattern)) };
+        for (; (i + sizeof(__m256i)) <= size; i += sizeof(__m256i)) {
+            _mm256_storeu_si256(std::bit_cast<__m256i *>(ptr + i), value);
+        }
+        // 16 byte guards never reach the 256-bit loop
+        if ((i + sizeof(__m128i)) <= size) {
+            _mm_storeu_si128(std::bit_cast<__m128i *>(ptr + i), _mm256_castsi256_si128(value));
+            i += sizeof(__m128i);
+        }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        const __m128i value{ _mm_set1_epi8(static_cast<char>(pattern)) };
+        for (; (i + sizeof(__m128i)) <= size; i += sizeof(__m128i)) {
+            _mm_storeu_si128(std::bit_cast<__m128i *>(ptr + i), value);
+        }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        const uint8x16_t value{ vdupq_n_u8(pattern) };
+        for (; (i + sizeof(uint8x16_t)) <= size; i += sizeof(uint8x16_t)) {
+            vst1q_u8(std::bit_cast<std::uint8_t *>(ptr + i), value);
+        }
+#endif
+        for (; i < size; ++i) {
+            ptr[i] = std::byte{ pattern };
+        }
+    }
+
+    /**
+     * @brief Finds the first byte of a memory range that differs from a byte pattern.
+     *
+     * Compares a whole vector per step with the widest instructions available for the target
+     * and only falls back to bytes for the tail, so verifying guard regions costs a handful
+     * of instructions.
+     *
+     * @param ptr     First byte of the range.
+     * @param size    Size of the range in bytes.
+     * @param pattern Byte value every byte of the range is expected to hold.
+     * @return Pointer to the first mismatching byte, `nullptr` if the whole range matches.
+     */
+    [[nodiscard]] inline auto FindPatternMismatch(const std::byte *ptr, const std::size_t size, const std::uint8_t pattern) noexcept
+            -> const std::byte * {
+        std::size_t i{ 0U };
+#if defined(__AVX2__)
+        const __m256i value{ _mm256_set1_epi8(static_cast<char>(pattern)) };
+        for (; (i + sizeof(__m256i)) <= size; i += sizeof(__m256i)) {
+            const __m256i block{ _mm256_loadu_si256(std::bit_cast<const __m256i *>(ptr + i)) };
+            const auto equal{ static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, value))) };
+            if (equal != 0xFFFFFFFFU) {
+                return ptr + i + std::countr_one(equal);
+            }
+        }
+        if ((i + sizeof(__m128i)) <= size) {
+            const __m128i block{ _mm_loadu_si128(std::bit_cast<const __m128i *>(ptr + i)) };
+            const auto equal{ static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm256_castsi256_si128(value)))) };
+            if (equal != 0xFFFFU) {
+                return ptr + i + std::countr_one(equal);
+            }
+            i += sizeof(__m128i);
+        }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        const __m128i value{ _mm_set1_epi8(static_cast<char>(pattern)) };
+        for (; (i + sizeof(__m128i)) <= size; i += sizeof(__m128i)) {
+            const __m128i block{ _mm_loadu_si128(std::bit_cast<const __m128i *>(ptr + i)) };
+            const auto equal{ static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, value))) };
+            if (equal != 0xFFFFU) {
+                return ptr + i + std::countr_one(equal);
+            }
+        }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        const uint8x16_t value{ vdupq_n_u8(pattern) };
+        for (; (i + sizeof(uint8x16_t)) <= size; i += sizeof(uint8x16_t)) {
+            const uint8x16_t block{ vld1q_u8(std::bit_cast<const std::uint8_t *>(ptr + i)) };
+            if (vminvq_u8(vceqq_u8(block, value)) != 0xFFU) {
+                // Rare path, locate the byte with the scalar loop below
+                break;
+            }
+        }
+#endif
+        for (; i < size; ++i) {
+            if (ptr[i] != std::byte{ pattern }) {
+                return ptr + i;
+            }
+        }
+        return nullptr;
+    }
+}
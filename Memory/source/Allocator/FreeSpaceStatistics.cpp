@@ -0,0 +1 @@
+#include <Allocator/FreeSpaceStatistics.hpp>
@@ -0,0 +1,298 @@
+#include <Arena/AllocationRecorder.hpp>
+#include <Log.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace Synapse::Memory::Arena {
+    namespace {
+        struct CachedRing {
+            std::uint64_t recorder_id{ 0U };
+            AllocationRecorder::Ring *ring{ nullptr };
+        };
+
+        // One ring per recorder the thread recorded into; ids are never reused, so entries
+        // of destroyed recorders are never matched again. The exit flags are shared with the
+        // recorders, so a thread can flag its rings even if their recorder is already gone.
+        struct ThreadRingCache {
+            ThreadRingCache() = default;
+            ~ThreadRingCache() {
+                for (const std::shared_ptr<std::atomic<bool>> &exited : exit_flags) {
+                    exited->store(true, std::memory_order_release);
+                }
+            }
+
+            ThreadRingCache(const ThreadRingCache&) = delete;
+            ThreadRingCache(ThreadRingCache&&) = delete;
+            auto operator=(const ThreadRingCache &) -> ThreadRingCache & = delete;
+            auto operator=(ThreadRingCache &&) -> ThreadRingCache & = delete;
+
+            std::vector<CachedRing> rings{};
+            std::vector<std::shared_ptr<std::atomic<bool>>> exit_flags{};
+            CachedRing last{};
+            std::uint32_t thread{ 0U };
+        };
+
+        thread_local ThreadRingCache t_ring_cache{};
+
+        std::atomic<std::uint64_t> s_recorder_instance{ 1U };
+        std::atomic<std::uint32_t> s_thread_counter{ 1U };
+
+        constexpr std::size_t DRAIN_BATCH_SIZE{ 1024U };
+    }
+
+    AllocationRecorder::AllocationRecorder(const std::chrono::milliseconds drain_interval) noexcept :
+        m_instance_id(s_recorder_instance.fetch_add(1U, std::memory_order_relaxed)), m_drain_interval(drain_interval),
+        m_start_time(std::chrono::steady_clock::now()) {}
+
+    AllocationRecorder::~AllocationRecorder() noexcept {
+        Stop();
+        CloseSink();
+    }
+
+    auto AllocationRecorder::OpenFile(const std::filesystem::path &path) noexcept -> bool {
+        if ((m_file != nullptr) || (m_socket != -1)) {
+            CORE_ERROR("AllocationRecorder already has an open sink");
+            return false;
+        }
+#ifdef _WIN32
+        if (_wfopen_s(&m_file, path.c_str(), L"wb") != 0) {
+            m_file = nullptr;
+        }
+#else
+        m_file = std::fopen(path.c_str(), "wb");
+#endif
+        if (m_file == nullptr) {
+            CORE_ERROR("AllocationRecorder failed to open {}", path.string());
+            return false;
+        }
+        return true;
+    }
+
+    auto AllocationRecorder::ConnectLocalSocket([[maybe_unused]] const std::string &path) noexcept -> bool {
+        if ((m_file != nullptr) || (m_socket != -1)) {
+            CORE_ERROR("AllocationRecorder already has an open sink");
+            return false;
+        }
+#ifdef _WIN32
+        CORE_ERROR("AllocationRecorder local socket sink is not supported on this platform");
+        return false;
+#else
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)) {
+            CORE_ERROR("AllocationRecorder socket path is too long: {}", path);
+            return false;
+        }
+        (void)std::copy_n(path.data(), path.size(), address.sun_path);
+
+        const int socket_handle{ ::socket(AF_UNIX, SOCK_STREAM, 0) };
+        if (socket_handle == -1) {
+            CORE_ERROR("AllocationRecorder failed to create socket: {}", std::strerror(errno));
+            return false;
+        }
+        if (::connect(socket_handle, std::bit_cast<sockaddr *>(&address), sizeof(address)) == -1) {
+            CORE_ERROR("AllocationRecorder failed to connect to {}: {}", path, std::strerror(errno));
+            (void)::close(socket_handle);
+            return false;
+        }
+        m_socket = socket_handle;
+        return true;
+#endif
+    }
+
+    auto AllocationRecorder::Start() noexcept -> bool {
+        if (((m_file == nullptr) && (m_socket == -1)) || m_drain_thread.joinable()) {
+            return false;
+        }
+
+        const AllocationTraceHeader header{
+            .magic = ALLOCATION_TRACE_MAGIC,
+            .version = ALLOCATION_TRACE_VERSION,
+            .event_size = sizeof(AllocationEvent),
+            .start_time = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count())
+        };
+        if (!WriteToSink(&header, sizeof(header))) {
+            return false;
+        }
+
+        m_drain_buffer.resize(DRAIN_BATCH_SIZE);
+        m_recording.store(true, std::memory_order_release);
+        m_drain_thread = std::jthread([this](const std::stop_token &stop_token) { DrainThread(stop_token); });
+        return true;
+    }
+
+    auto AllocationRecorder::Stop() noexcept -> void {
+        // Pairs with the acquire in Record, a thread seeing the recorder stopped also sees what happened before Stop
+        m_recording.store(false, std::memory_order_release);
+        if (m_drain_thread.joinable()) {
+            m_drain_thread.request_stop();
+            m_drain_thread.join();
+            // Catch anything produced between the last drain and the recording flag flip
+            DrainAll();
+            CloseSink();
+        }
+    }
+
+    auto AllocationRecorder::Record(const AllocationEventType type, const void *ptr, const std::size_t size,
+            const std::size_t alignment, const std::uint32_t call_site) noexcept -> void {
+        if (!m_recording.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        Ring *ring{ GetThreadRing() };
+        if (ring == nullptr) {
+            return;
+        }
+
+        const AllocationEvent event{
+            .timestamp = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - m_start_time).count()),
+            .pointer = std::bit_cast<std::uintptr_t>(ptr),
+            .size = size,
+            .call_site = call_site,
+            .alignment = static_cast<std::uint32_t>(alignment),
+            .thread = t_ring_cache.thread,
+            .type = type,
+            .reserved = {}
+        };
+        (void)ring->TryPush(event);
+    }
+
+    auto AllocationRecorder::GetDroppedCount() const noexcept -> std::uint64_t {
+        std::scoped_lock lock{ m_rings_mutex };
+        std::uint64_t dropped{ m_retired_dropped };
+        for (const ThreadRing &ring : m_rings) {
+            dropped += ring.ring->GetDroppedCount();
+        }
+        return dropped;
+    }
+
+    auto AllocationRecorder::GetRingCount() const noexcept -> std::size_t {
+        std::scoped_lock lock{ m_rings_mutex };
+        return m_rings.size();
+    }
+
+    auto AllocationRecorder::GetThreadRing() noexcept -> Ring * {
+        if (t_ring_cache.last.recorder_id == m_instance_id) [[likely]] {
+            return t_ring_cache.last.ring;
+        }
+
+        // Thread alternates between recorders, reuse the ring it already owns in this one
+        const auto cached = std::ranges::find(t_ring_cache.rings, m_instance_id, &CachedRing::recorder_id);
+        if (cached != t_ring_cache.rings.end()) {
+            t_ring_cache.last = *cached;
+            return cached->ring;
+        }
+
+        // Slow path, first event of this thread for this recorder
+        std::unique_ptr<Ring> owned_ring{ std::make_unique<Ring>() };
+        Ring *ring{ owned_ring.get() };
+        auto thread_exited{ std::make_shared<std::atomic<bool>>(false) };
+        {
+            std::scoped_lock lock{ m_rings_mutex };
+            m_rings.push_back(ThreadRing{ .ring = std::move(owned_ring), .thread_exited = thread_exited });
+        }
+        if (t_ring_cache.thread == 0U) {
+            t_ring_cache.thread = s_thread_counter.fetch_add(1U, std::memory_order_relaxed);
+        }
+        t_ring_cache.last = CachedRing{ .recorder_id = m_instance_id, .ring = ring };
+        t_ring_cache.rings.push_back(t_ring_cache.last);
+        t_ring_cache.exit_flags.push_back(std::move(thread_exited));
+        return ring;
+    }
+
+    auto AllocationRecorder::DrainThread(const std::stop_token &stop_token) noexcept -> void {
+        while (!stop_token.stop_requested()) {
+            DrainAll();
+            std::this_thread::sleep_for(m_drain_interval);
+        }
+    }
+
+    auto AllocationRecorder::DrainAll() noexcept -> void {
+        // The sink may block, only the snapshot is taken under the lock so a thread creating
+        // its ring is not stalled behind it. Rings are only removed here, on this thread.
+        {
+            std::scoped_lock lock{ m_rings_mutex };
+            m_drain_rings.clear();
+            for (const ThreadRing &ring : m_rings) {
+                m_drain_rings.push_back(DrainRing{ .ring = ring.ring.get(),
+                        .thread_exited = ring.thread_exited->load(std::memory_order_acquire) });
+            }
+        }
+
+        bool retire{ false };
+        for (const DrainRing &ring : m_drain_rings) {
+            std::size_t count{ 0U };
+            do {
+                count = ring.ring->Drain(m_drain_buffer.data(), m_drain_buffer.size());
+                if ((count > 0U) && WriteToSink(m_drain_buffer.data(), count * sizeof(AllocationEvent))) {
+                    m_written.fetch_add(count, std::memory_order_relaxed);
+                }
+            } while (count == m_drain_buffer.size());
+            retire = retire || ring.thread_exited;
+        }
+        if (m_file != nullptr) {
+            (void)std::fflush(m_file);
+        }
+
+        // A ring whose thread had exited before it was drained holds nothing anymore
+        if (retire) {
+            std::scoped_lock lock{ m_rings_mutex };
+            for (const DrainRing &drained : m_drain_rings) {
+                if (!drained.thread_exited) {
+                    continue;
+                }
+                const auto it = std::ranges::find_if(m_rings, [&drained](const ThreadRing &ring) { return ring.ring.get() == drained.ring; });
+                m_retired_dropped += it->ring->GetDroppedCount();
+                (void)m_rings.erase(it);
+            }
+        }
+    }
+
+    auto AllocationRecorder::WriteToSink(const void *data, const std::size_t size) noexcept -> bool {
+        if (m_file != nullptr) {
+            return std::fwrite(data, 1U, size, m_file) == size;
+        }
+#ifndef _WIN32
+        if (m_socket != -1) {
+            const auto *bytes = static_cast<const std::byte *>(data);
+            std::size_t sent{ 0U };
+            while (sent < size) {
+                const ssize_t result{ ::send(m_socket, bytes + sent, size - sent, MSG_NOSIGNAL) };
+                if (result <= 0) {
+                    CORE_ERROR("AllocationRecorder lost the socket connection: {}", std::strerror(errno));
+                    (void)::close(m_socket);
+                    m_socket = -1;
+                    return false;
+                }
+                sent += static_cast<std::size_t>(result);
+            }
+            return true;
+        }
+#endif
+        return false;
+    }
+
+    auto AllocationRecorder::CloseSink() noexcept -> void {
+        if (m_file != nullptr) {
+            (void)std::fclose(m_file);
+            m_file = nullptr;
+        }
+#ifndef _WIN32
+        if (m_socket != -1) {
+            (void)::close(m_socket);
+            m_socket = -1;
+        }
+#endif
+    }
+}
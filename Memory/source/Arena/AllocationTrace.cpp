@@ -0,0 +1,95 @@
+#include <Arena/AllocationTrace.hpp>
+#include <Log.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <unordered_map>
+
+namespace Synapse::Memory::Arena {
+    AllocationTrace::AllocationTrace(const AllocationTraceHeader header, std::vector<AllocationEvent> events) noexcept :
+        m_header(header), m_events(std::move(events)) {}
+
+    auto AllocationTrace::Load(const std::filesystem::path &path) -> std::optional<AllocationTrace> {
+        std::ifstream file{ path, std::ios::binary };
+        if (!file) {
+            CORE_ERROR("Failed to open allocation trace {}", path.string());
+            return std::nullopt;
+        }
+
+        AllocationTraceHeader header{};
+        if (!file.read(std::bit_cast<char *>(&header), sizeof(header)) || (header.magic != ALLOCATION_TRACE_MAGIC)) {
+            CORE_ERROR("{} is not an allocation trace", path.string());
+            return std::nullopt;
+        }
+        if ((header.version != ALLOCATION_TRACE_VERSION) || (header.event_size != sizeof(AllocationEvent))) {
+            CORE_ERROR("Unsupported allocation trace version {} in {}", header.version, path.string());
+            return std::nullopt;
+        }
+
+        std::error_code error{};
+        const std::uintmax_t file_size{ std::filesystem::file_size(path, error) };
+        std::vector<AllocationEvent> events{};
+        if (!error && (file_size > sizeof(header))) {
+            events.reserve(static_cast<std::size_t>((file_size - sizeof(header)) / sizeof(AllocationEvent)));
+        }
+
+        AllocationEvent event{};
+        while (file.read(std::bit_cast<char *>(&event), sizeof(event))) {
+            events.push_back(event);
+        }
+        if (file.gcount() != 0) {
+            CORE_WARN("Allocation trace {} ends with a partial event, it was ignored", path.string());
+        }
+
+        // Rings are drained thread by thread, restore the global order
+        std::ranges::stable_sort(events, {}, &AllocationEvent::timestamp);
+        return AllocationTrace{ header, std::move(events) };
+    }
+
+    auto AllocationTrace::BuildReplay() const -> AllocationReplay {
+        AllocationReplay replay{};
+        replay.operations.reserve(m_events.size());
+
+        struct LiveBlock {
+            std::uint32_t slot;
+            std::uint64_t size;
+            std::uint32_t alignment;
+        };
+        std::unordered_map<std::uint64_t, LiveBlock> live_blocks{};
+        std::vector<std::uint32_t> free_slots{};
+        std::uint64_t live_bytes{ 0U };
+
+        for (const AllocationEvent &event : m_events) {
+            if (event.type == AllocationEventType::Allocate) {
+                if (event.pointer == 0U) {
+                    continue;
+                }
+                std::uint32_t slot{ replay.slot_count };
+                if (free_slots.empty()) {
+                    ++replay.slot_count;
+                } else {
+                    slot = free_slots.back();
+                    free_slots.pop_back();
+                }
+                live_blocks[event.pointer] = LiveBlock{ .slot = slot, .size = event.size, .alignment = event.alignment };
+                live_bytes += event.size;
+                replay.peak_live_bytes = std::max(replay.peak_live_bytes, live_bytes);
+                replay.operations.push_back(ReplayOperation{
+                    .size = event.size, .slot = slot, .alignment = event.alignment, .type = AllocationEventType::Allocate });
+            } else {
+                const auto it = live_blocks.find(event.pointer);
+                if (it == live_blocks.end()) {
+                    ++replay.unmatched_frees;
+                    continue;
+                }
+                live_bytes -= it->second.size;
+                free_slots.push_back(it->second.slot);
+                replay.operations.push_back(ReplayOperation{
+                    .size = it->second.size, .slot = it->second.slot, .alignment = it->second.alignment, .type = AllocationEventType::Deallocate });
+                live_blocks.erase(it);
+            }
+        }
+        return replay;
+    }
+}
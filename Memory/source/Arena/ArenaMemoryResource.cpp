@@ -0,0 +1 @@
+#include <Arena/ArenaMemoryResource.hpp>
@@ -0,0 +1,53 @@
+#include <Arena/ArenaRegistry.hpp>
+#include <Log.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace Synapse::Memory::Arena {
+    auto ArenaRegistry::Register(std::string name, void *arena, const StatisticsFunction get_statistics) -> void {
+        std::scoped_lock lock{ m_mutex };
+        m_entries.push_back(Entry{ .name = std::move(name), .arena = arena, .get_statistics = get_statistics });
+    }
+
+    auto ArenaRegistry::Unregister(const void *arena) noexcept -> void {
+        std::scoped_lock lock{ m_mutex };
+        (void)std::erase_if(m_entries, [arena](const Entry &entry) { return entry.arena == arena; });
+    }
+
+    auto ArenaRegistry::Collect() const -> std::vector<NamedArenaStatistics> {
+        std::scoped_lock lock{ m_mutex };
+        std::vector<NamedArenaStatistics> result{};
+        result.reserve(m_entries.size());
+        for (const Entry &entry : m_entries) {
+            result.push_back(NamedArenaStatistics{ .name = entry.name, .statistics = entry.get_statistics(entry.arena) });
+        }
+        return result;
+    }
+
+    auto ArenaRegistry::LogStatistics() const -> void {
+        for (const auto &[name, statistics] : Collect()) {
+            const double usage{ (statistics.capacity == 0U) ? 0.0 :
+                    (static_cast<double>(statistics.bytes_in_use) / static_cast<double>(statistics.capacity)) };
+            if ((usage > PRESSURE_THRESHOLD) || (statistics.failed_allocations > 0U)) {
+                CORE_WARN("Arena {}: {}/{} bytes in use (peak {}), {} allocations, {} failed, largest free block {} bytes, fragmentation {:.2f}",
+                        name, statistics.bytes_in_use, statistics.capacity, statistics.peak_bytes_in_use, statistics.allocation_count,
+                        statistics.failed_allocations, statistics.largest_free_block, statistics.GetFragmentation());
+            } else {
+                CORE_INFO("Arena {}: {}/{} bytes in use (peak {}), {} allocations, {} free blocks, largest free block {} bytes, fragmentation {:.2f}",
+                        name, statistics.bytes_in_use, statistics.capacity, statistics.peak_bytes_in_use, statistics.allocation_count,
+                        statistics.free_block_count, statistics.largest_free_block, statistics.GetFragmentation());
+            }
+        }
+    }
+
+    auto ArenaRegistry::GetCount() const noexcept -> std::size_t {
+        std::scoped_lock lock{ m_mutex };
+        return m_entries.size();
+    }
+
+    auto GetArenaRegistry() -> ArenaRegistry & {
+        static ArenaRegistry g_arena_registry;
+        return g_arena_registry;
+    }
+}
@@ -0,0 +1 @@
+#include <Arena/ArenaStatistics.hpp>
@@ -0,0 +1,247 @@
+#include <Arena/CompactingArena.hpp>
+#include <AlignmentUtility.hpp>
+#include <Log.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <libassert/assert.hpp>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Synapse::Memory::Arena {
+    namespace {
+        auto GetPageSize() noexcept -> std::size_t {
+#ifdef _WIN32
+            SYSTEM_INFO info{};
+            GetSystemInfo(&info);
+            return static_cast<std::size_t>(info.dwPageSize);
+#else
+            return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+        }
+
+        // Tells the operating system the contents of the pages are no longer needed, they are backed again on next touch
+        auto DiscardPages(std::byte *begin, const std::size_t size) noexcept -> bool {
+#ifdef _WIN32
+            return VirtualAlloc(begin, size, MEM_RESET, PAGE_READWRITE) != nullptr;
+#else
+            return madvise(begin, size, MADV_DONTNEED) == 0;
+#endif
+        }
+    }
+
+    CompactingArena::CompactingArena(std::byte *start, std::byte *end) noexcept :
+        m_start(Utility::AlignAddress(start, GRANULARITY)), m_end(end), m_top(m_start), m_scan(m_start), m_compacted(m_start),
+        m_committed(m_start) {
+        DEBUG_ASSERT(m_start <= m_end, "Area is too small");
+    }
+
+    auto CompactingArena::Allocate(const std::size_t size, const std::size_t alignment) noexcept -> RelocatableHandle {
+        DEBUG_ASSERT(std::has_single_bit(alignment), "Invalid alignment. Must be power of two.");
+        const std::size_t block_alignment{ std::max(alignment, GRANULARITY) };
+        const std::size_t available{ static_cast<std::size_t>(m_end - m_top) };
+        if ((size > std::numeric_limits<std::uint32_t>::max()) ||
+                ((sizeof(BlockHeader) + (block_alignment - GRANULARITY) + Utility::AlignSize(size, GRANULARITY)) > available)) {
+            CORE_DEBUG("CompactingArena out of memory!");
+            return RelocatableHandle{};
+        }
+
+        std::byte *header{ Utility::AlignAddress(m_top + sizeof(BlockHeader), block_alignment) - sizeof(BlockHeader) };
+        WriteFiller(m_top, header);
+
+        const std::uint32_t index{ AcquireEntry() };
+        HandleEntry &entry{ m_handles[index] };
+        entry.header = header;
+        entry.pins = 0U;
+        const BlockHeader block{ .size = static_cast<std::uint32_t>(size), .handle_index = index,
+            .alignment = static_cast<std::uint32_t>(block_alignment), .reserved = 0U };
+        WriteHeader(header, block);
+
+        m_top = header + GetSpan(block);
+        m_committed = std::max(m_committed, m_top);
+        ++m_live_count;
+        m_live_bytes += GetSpan(block);
+        return RelocatableHandle{ .index = index, .generation = entry.generation };
+    }
+
+    auto CompactingArena::Free(const RelocatableHandle handle) noexcept -> bool {
+        const HandleEntry *found{ FindEntry(handle) };
+        if (found == nullptr) {
+            return false;
+        }
+        HandleEntry &entry{ m_handles[handle.index] };
+        DEBUG_ASSERT(entry.pins == 0U, "Freeing a pinned block", handle.index);
+
+        BlockHeader block{ ReadHeader(entry.header) };
+        block.handle_index = NO_HANDLE;
+        WriteHeader(entry.header, block);
+        --m_live_count;
+        m_live_bytes -= GetSpan(block);
+
+        // Skip 0 on wrap around, it marks the null handle
+        entry.generation = (entry.generation == std::numeric_limits<std::uint32_t>::max()) ? 1U : (entry.generation + 1U);
+        entry.header = nullptr;
+        entry.next_free = m_free_handle;
+        m_free_handle = handle.index;
+        return true;
+    }
+
+    auto CompactingArena::Resolve(const RelocatableHandle handle) const noexcept -> std::byte * {
+        const HandleEntry *entry{ FindEntry(handle) };
+        return (entry == nullptr) ? nullptr : (entry->header + sizeof(BlockHeader));
+    }
+
+    auto CompactingArena::GetAllocationSize(const RelocatableHandle handle) const noexcept -> std::size_t {
+        const HandleEntry *entry{ FindEntry(handle) };
+        return (entry == nullptr) ? 0U : ReadHeader(entry->header).size;
+    }
+
+    auto CompactingArena::Pin(const RelocatableHandle handle) noexcept -> std::byte * {
+        if (FindEntry(handle) == nullptr) {
+            return nullptr;
+        }
+        HandleEntry &entry{ m_handles[handle.index] };
+        ++entry.pins;
+        return entry.header + sizeof(BlockHeader);
+    }
+
+    auto CompactingArena::Unpin(const RelocatableHandle handle) noexcept -> void {
+        if (FindEntry(handle) == nullptr) {
+            return;
+        }
+        HandleEntry &entry{ m_handles[handle.index] };
+        DEBUG_ASSERT(entry.pins > 0U, "Unpinning a block that is not pinned", handle.index);
+        --entry.pins;
+    }
+
+    auto CompactingArena::Compact(const std::chrono::nanoseconds budget) noexcept -> bool {
+        const auto deadline{ std::chrono::steady_clock::now() + budget };
+        do {
+            if (CompactStep(COMPACTION_STEP_BYTES)) {
+                return true;
+            }
+        } while (std::chrono::steady_clock::now() < deadline);
+        return false;
+    }
+
+    auto CompactingArena::CompactStep(const std::size_t max_bytes) noexcept -> bool {
+        std::size_t moved{ 0U };
+        while (m_scan < m_top) {
+            const BlockHeader block{ ReadHeader(m_scan) };
+            const std::size_t span{ GetSpan(block) };
+            if (block.handle_index == NO_HANDLE) {
+                m_scan += span;
+                continue;
+            }
+
+            HandleEntry &entry{ m_handles[block.handle_index] };
+            std::byte *destination{ Utility::AlignAddress(m_compacted + sizeof(BlockHeader), block.alignment) - sizeof(BlockHeader) };
+            if ((entry.pins > 0U) || (destination >= m_scan)) {
+                // The block stays, the compacted prefix continues after it
+                WriteFiller(m_compacted, m_scan);
+                m_scan += span;
+                m_compacted = m_scan;
+                continue;
+            }
+            if (moved >= max_bytes) {
+                return false;
+            }
+
+            WriteFiller(m_compacted, destination);
+            (void)std::memmove(destination, m_scan, span);
+            entry.header = destination;
+            m_compacted = destination + span;
+            m_scan += span;
+            moved += span;
+            m_moved_bytes += span;
+        }
+        FinishPass();
+        return true;
+    }
+
+    auto CompactingArena::GetStatistics() const noexcept -> CompactionStatistics {
+        return CompactionStatistics{
+            .live_bytes = m_live_bytes,
+            .used_bytes = static_cast<std::size_t>(m_top - m_start),
+            .moved_bytes = m_moved_bytes,
+            .released_bytes = m_released_bytes,
+            .completed_passes = m_completed_passes
+        };
+    }
+
+    auto CompactingArena::GetFragmentation() const noexcept -> double {
+        const auto used{ static_cast<std::size_t>(m_top - m_start) };
+        return (used == 0U) ? 0.0 : (1.0 - (static_cast<double>(m_live_bytes) / static_cast<double>(used)));
+    }
+
+    auto CompactingArena::ReadHeader(const std::byte *header) noexcept -> BlockHeader {
+        BlockHeader block{};
+        (void)std::copy_n(header, sizeof(BlockHeader), std::bit_cast<std::byte *>(&block));
+        return block;
+    }
+
+    auto CompactingArena::WriteHeader(std::byte *header, const BlockHeader &block) noexcept -> void {
+        (void)std::copy_n(std::bit_cast<const std::byte *>(&block), sizeof(BlockHeader), header);
+    }
+
+    auto CompactingArena::WriteFiller(std::byte *begin, const std::byte *end) noexcept -> void {
+        if (begin == end) {
+            return;
+        }
+        // Both ends are on the granularity, so the gap always fits a header
+        const BlockHeader filler{ .size = static_cast<std::uint32_t>((end - begin) - static_cast<std::ptrdiff_t>(sizeof(BlockHeader))),
+            .handle_index = NO_HANDLE, .alignment = GRANULARITY, .reserved = 0U };
+        WriteHeader(begin, filler);
+    }
+
+    auto CompactingArena::GetSpan(const BlockHeader &block) noexcept -> std::size_t {
+        return sizeof(BlockHeader) + Utility::AlignSize(block.size, GRANULARITY);
+    }
+
+    auto CompactingArena::FindEntry(const RelocatableHandle handle) const noexcept -> const HandleEntry * {
+        if (handle.IsNull() || (handle.index >= m_handles.size())) {
+            return nullptr;
+        }
+        const HandleEntry &entry{ m_handles[handle.index] };
+        return ((entry.generation == handle.generation) && (entry.header != nullptr)) ? &entry : nullptr;
+    }
+
+    auto CompactingArena::AcquireEntry() noexcept -> std::uint32_t {
+        if (m_free_handle != NO_HANDLE) {
+            const std::uint32_t index{ m_free_handle };
+            m_free_handle = m_handles[index].next_free;
+            return index;
+        }
+        m_handles.push_back(HandleEntry{ .header = nullptr, .generation = 1U, .pins = 0U, .next_free = NO_HANDLE });
+        return static_cast<std::uint32_t>(m_handles.size() - 1U);
+    }
+
+    auto CompactingArena::FinishPass() noexcept -> void {
+        m_top = m_compacted;
+        m_scan = m_start;
+        m_compacted = m_start;
+        ++m_completed_passes;
+        ReleasePages();
+    }
+
+    auto CompactingArena::ReleasePages() noexcept -> void {
+        static const std::size_t page_size{ GetPageSize() };
+        std::byte *first_page{ Utility::AlignAddress(m_top, page_size) };
+        const std::size_t size{ (m_committed > first_page) ?
+                Utility::AlignSize(static_cast<std::size_t>(m_committed - first_page), page_size) : 0U };
+        // Stay inside the area, the last partial page may be shared with other allocations
+        const std::size_t releasable{ std::min(size, static_cast<std::size_t>(std::max(m_end, first_page) - first_page) & ~(page_size - 1U)) };
+        if ((releasable > 0U) && DiscardPages(first_page, releasable)) {
+            m_released_bytes += releasable;
+        }
+        m_committed = m_top;
+    }
+}
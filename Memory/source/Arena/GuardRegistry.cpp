@@ -0,0 +1,81 @@
+#include <Arena/GuardRegistry.hpp>
+#include <Log.hpp>
+#include <PatternUtility.hpp>
+
+#include <algorithm>
+
+namespace Synapse::Memory::Arena {
+    GuardRegistry::GuardRegistry(const std::size_t front_size, const std::size_t back_size, const std::uint8_t pattern,
+            const std::size_t capacity) :
+        m_front_size(front_size), m_back_size(back_size), m_pattern(pattern) {
+        m_blocks.reserve(capacity);
+        m_indices.reserve(capacity);
+    }
+
+    auto GuardRegistry::Register(const void *owner, const std::byte *front_guard, const std::byte *back_guard) noexcept -> void {
+        std::scoped_lock lock{ m_mutex };
+        m_indices[front_guard] = m_blocks.size();
+        m_blocks.push_back(GuardedBlock{ .owner = owner, .front_guard = front_guard, .back_guard = back_guard, .reported = false });
+    }
+
+    auto GuardRegistry::Unregister(const std::byte *front_guard) noexcept -> void {
+        std::scoped_lock lock{ m_mutex };
+        const auto it = m_indices.find(front_guard);
+        if (it == m_indices.end()) {
+            return;
+        }
+        const std::size_t index{ it->second };
+        m_indices.erase(it);
+        if (index != (m_blocks.size() - 1U)) {
+            m_blocks[index] = m_blocks.back();
+            m_indices[m_blocks[index].front_guard] = index;
+        }
+        m_blocks.pop_back();
+    }
+
+    auto GuardRegistry::UnregisterOwner(const void *owner) noexcept -> void {
+        std::scoped_lock lock{ m_mutex };
+        std::size_t index{ 0U };
+        while (index < m_blocks.size()) {
+            if (m_blocks[index].owner != owner) {
+                ++index;
+                continue;
+            }
+            m_indices.erase(m_blocks[index].front_guard);
+            if (index != (m_blocks.size() - 1U)) {
+                m_blocks[index] = m_blocks.back();
+                m_indices[m_blocks[index].front_guard] = index;
+            }
+            m_blocks.pop_back();
+        }
+    }
+
+    auto GuardRegistry::ScrubBatch(std::size_t &cursor, const std::size_t max_blocks, GuardScrubResult &result) noexcept -> bool {
+        std::scoped_lock lock{ m_mutex };
+        const std::size_t end{ std::min(m_blocks.size(), cursor + max_blocks) };
+        for (; cursor < end; ++cursor) {
+            GuardedBlock &block{ m_blocks[cursor] };
+            const std::byte *front_mismatch{ Utility::FindPatternMismatch(block.front_guard, m_front_size, m_pattern) };
+            const std::byte *back_mismatch{ Utility::FindPatternMismatch(block.back_guard, m_back_size, m_pattern) };
+            ++result.blocks;
+            result.bytes += m_front_size + m_back_size;
+            if ((front_mismatch == nullptr) && (back_mismatch == nullptr)) {
+                continue;
+            }
+            ++result.violations;
+            if (!block.reported) {
+                block.reported = true;
+                CORE_ERROR("Guard scrubber found a memory stomp in the live block at {}, front guard {}, back guard {}",
+                        static_cast<const void *>(block.front_guard + m_front_size),
+                        (front_mismatch == nullptr) ? "intact" : "overwritten",
+                        (back_mismatch == nullptr) ? "intact" : "overwritten");
+            }
+        }
+        return cursor >= m_blocks.size();
+    }
+
+    auto GuardRegistry::GetCount() const noexcept -> std::size_t {
+        std::scoped_lock lock{ m_mutex };
+        return m_blocks.size();
+    }
+}
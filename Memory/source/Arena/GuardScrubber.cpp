@@ -0,0 +1,49 @@
+#include <Arena/GuardScrubber.hpp>
+
+namespace Synapse::Memory::Arena {
+    GuardScrubber::GuardScrubber(GuardRegistry &registry, const std::chrono::milliseconds interval, const std::size_t batch_size) noexcept :
+        m_registry(registry), m_interval(interval), m_batch_size(batch_size) {}
+
+    GuardScrubber::~GuardScrubber() noexcept {
+        Stop();
+    }
+
+    auto GuardScrubber::Start() noexcept -> bool {
+        if (m_thread.joinable()) {
+            return false;
+        }
+        m_thread = std::jthread([this](const std::stop_token &stop_token) { ScrubThread(stop_token); });
+        return true;
+    }
+
+    auto GuardScrubber::Stop() noexcept -> void {
+        if (m_thread.joinable()) {
+            m_thread.request_stop();
+            m_thread.join();
+        }
+    }
+
+    auto GuardScrubber::Sweep() noexcept -> GuardScrubResult {
+        const auto start{ std::chrono::steady_clock::now() };
+        GuardScrubResult result{};
+        std::size_t cursor{ 0U };
+        while (!m_registry.ScrubBatch(cursor, m_batch_size, result)) {
+            // Let the threads waiting on the registry lock in between batches
+            std::this_thread::yield();
+        }
+        const auto elapsed{ std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start) };
+
+        m_sweeps.fetch_add(1U, std::memory_order_relaxed);
+        m_violations.fetch_add(result.violations, std::memory_order_relaxed);
+        m_checked_bytes.fetch_add(result.bytes, std::memory_order_relaxed);
+        m_busy_nanoseconds.fetch_add(static_cast<std::uint64_t>(elapsed.count()), std::memory_order_relaxed);
+        return result;
+    }
+
+    auto GuardScrubber::ScrubThread(const std::stop_token &stop_token) noexcept -> void {
+        while (!stop_token.stop_requested()) {
+            (void)Sweep();
+            std::this_thread::sleep_for(m_interval);
+        }
+    }
+}
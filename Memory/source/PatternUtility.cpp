@@ -0,0 +1 @@
+#include <PatternUtility.hpp>
\ No newline at end of file
@@ -0,0 +1,227 @@
+#pragma once
+#include <Concurrent/ConcurrentCommon.hpp>
+#include <Concurrent/Futex.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <libassert/assert.hpp>
+
+namespace Synapse::STL::Concurrent {
+    /**
+     * @brief What one acquisition cost, filled by the acquire functions when passed.
+     */
+    struct AcquireStatistics {
+        std::uint32_t spin_rounds{ 0U };  ///< `SpinLoopPause` rounds before the lock was taken or the thread slept.
+        std::uint32_t sleeps{ 0U };       ///< Futex waits, spurious wakes included.
+        bool contended{ false };          ///< The first attempt failed.
+    };
+
+    /**
+     * @brief Reader-writer lock in one 32 bit word that spins briefly, then sleeps on a futex.
+     *
+     * A contended acquire first retries with exponential backoff of `SpinLoopPause` rounds.
+     * The spin budget adapts per lock: it doubles when spinning paid off and halves when the
+     * thread had to sleep anyway, so locks held for long stop burning CPU. After the budget
+     * the thread marks itself waiting in the word and sleeps until an unlock wakes it.
+     *
+     * Writers are preferred: once a writer waits, new readers wait behind it, so a steady
+     * stream of readers cannot starve writers. Unlocking only enters the kernel when the
+     * word says somebody sleeps.
+     *
+     * Not recursive, a thread already holding the lock uses `LockSharedRecursive`.
+     */
+    class AdaptiveSharedMutex {
+    public:
+        AdaptiveSharedMutex() = default;
+        ~AdaptiveSharedMutex() = default;
+
+        AdaptiveSharedMutex(const AdaptiveSharedMutex&) = delete;
+        AdaptiveSharedMutex(AdaptiveSharedMutex&&) = delete;
+        auto operator=(const AdaptiveSharedMutex &) -> AdaptiveSharedMutex & = delete;
+        auto operator=(AdaptiveSharedMutex &&) -> AdaptiveSharedMutex & = delete;
+        auto operator==(const AdaptiveSharedMutex &other) const -> bool = delete;
+
+        [[nodiscard]] auto TryLock() noexcept -> bool {
+            std::uint32_t state{ m_state.load(std::memory_order_relaxed) };
+            return ((state & (WRITE_LOCKED | READER_MASK)) == 0U) &&
+                    m_state.compare_exchange_strong(state, state | WRITE_LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto TryLockShared() noexcept -> bool {
+            std::uint32_t state{ m_state.load(std::memory_order_relaxed) };
+            while ((state & (WRITE_LOCKED | WRITER_WAITING)) == 0U) {
+                DEBUG_ASSERT((state & READER_MASK) != READER_MASK, "Too many readers");
+                if (m_state.compare_exchange_weak(state, state + 1U, std::memory_order_acquire, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        auto Lock(AcquireStatistics *statistics = nullptr) noexcept -> void { (void)LockExclusive(std::nullopt, statistics); }
+        auto LockShared(AcquireStatistics *statistics = nullptr) noexcept -> void { (void)LockSharedUntil(std::nullopt, statistics); }
+
+        /**
+         * @return `false` if the lock was not acquired before the deadline.
+         */
+        [[nodiscard]] auto TryLockUntil(const std::chrono::steady_clock::time_point deadline, AcquireStatistics *statistics = nullptr) noexcept -> bool {
+            return LockExclusive(deadline, statistics);
+        }
+
+        [[nodiscard]] auto TryLockSharedUntil(const std::chrono::steady_clock::time_point deadline, AcquireStatistics *statistics = nullptr) noexcept -> bool {
+            return LockSharedUntil(deadline, statistics);
+        }
+
+        /**
+         * @brief Adds a reader for a thread that already holds the lock, shared or exclusive; never waits.
+         *
+         * Skips the writer preference, a thread waiting behind a writer for a lock it holds itself would never wake.
+         */
+        auto LockSharedRecursive() noexcept -> void {
+            [[maybe_unused]] const std::uint32_t previous{ m_state.fetch_add(1U, std::memory_order_relaxed) };
+            DEBUG_ASSERT(((previous & WRITE_LOCKED) != 0U) || ((previous & READER_MASK) != 0U), "The lock is not held");
+        }
+
+        auto Unlock() noexcept -> void {
+            const std::uint32_t previous{ m_state.fetch_and(~(WRITE_LOCKED | WRITER_WAITING | READER_PARKED), std::memory_order_release) };
+            DEBUG_ASSERT((previous & WRITE_LOCKED) != 0U, "Unlocking a lock that is not held exclusively");
+            DEBUG_ASSERT((previous & READER_MASK) == 0U, "Unlocking for writing while reads taken under it are still held");
+            if ((previous & (WRITER_WAITING | READER_PARKED)) != 0U) {
+                FutexWakeAll(m_state);
+            }
+        }
+
+        auto UnlockShared() noexcept -> void {
+            const std::uint32_t previous{ m_state.fetch_sub(1U, std::memory_order_release) };
+            DEBUG_ASSERT((previous & READER_MASK) != 0U, "Unlocking a lock that is not held shared");
+            if (((previous & READER_MASK) == 1U) && ((previous & WRITER_WAITING) != 0U)) {
+                // Last reader out, let the waiting writers compete; the losers mark themselves again
+                const std::uint32_t cleared{ m_state.fetch_and(~(WRITER_WAITING | READER_PARKED), std::memory_order_relaxed) };
+                if ((cleared & (WRITER_WAITING | READER_PARKED)) != 0U) {
+                    FutexWakeAll(m_state);
+                }
+            }
+        }
+
+    private:
+        static constexpr std::uint32_t WRITE_LOCKED{ 1U << 31U };
+        static constexpr std::uint32_t WRITER_WAITING{ 1U << 30U };  ///< A writer sleeps or is about to, readers hold back.
+        static constexpr std::uint32_t READER_PARKED{ 1U << 29U };
+        static constexpr std::uint32_t READER_MASK{ READER_PARKED - 1U };
+
+        static constexpr std::uint32_t MIN_SPIN_BUDGET{ 16U };
+        static constexpr std::uint32_t MAX_SPIN_BUDGET{ 4096U };
+        static constexpr std::uint32_t MAX_BACKOFF{ 64U };
+
+        // Spins with exponential backoff, returns true once `try_acquire` succeeded
+        template <typename TTryAcquire>
+        [[nodiscard]] auto Spin(TTryAcquire &&try_acquire, AcquireStatistics *statistics) noexcept -> bool {
+            const std::uint32_t budget{ m_spin_budget.load(std::memory_order_relaxed) };
+            if (statistics != nullptr) {
+                statistics->contended = true;
+            }
+            std::uint32_t backoff{ 1U };
+            std::uint32_t spent{ 0U };
+            bool acquired{ false };
+            for (; spent < budget; spent += backoff, backoff = std::min(backoff * 2U, MAX_BACKOFF)) {
+                for (std::uint32_t i = 0U; i < backoff; ++i) {
+                    SpinLoopPause();
+                }
+                if (try_acquire()) {
+                    spent += backoff;
+                    acquired = true;
+                    break;
+                }
+            }
+            if (statistics != nullptr) {
+                statistics->spin_rounds += spent;
+            }
+            AdjustSpinBudget(budget, acquired ? std::min(budget * 2U, MAX_SPIN_BUDGET) : std::max(budget / 2U, MIN_SPIN_BUDGET));
+            return acquired;
+        }
+
+        // Stores only on change, the budget shares its cache line with the lock word
+        auto AdjustSpinBudget(const std::uint32_t budget, const std::uint32_t adjusted) noexcept -> void {
+            if (adjusted != budget) {
+                m_spin_budget.store(adjusted, std::memory_order_relaxed);
+            }
+        }
+
+        [[nodiscard]] static auto GetTimeout(const std::optional<std::chrono::steady_clock::time_point> deadline, bool &expired) noexcept
+                -> std::optional<std::chrono::nanoseconds> {
+            if (!deadline) {
+                return std::nullopt;
+            }
+            const std::chrono::nanoseconds remaining{ *deadline - std::chrono::steady_clock::now() };
+            expired = remaining.count() <= 0;
+            return remaining;
+        }
+
+        static auto CountSleep(AcquireStatistics *statistics) noexcept -> void {
+            if (statistics != nullptr) {
+                ++statistics->sleeps;
+            }
+        }
+
+        auto LockExclusive(const std::optional<std::chrono::steady_clock::time_point> deadline, AcquireStatistics *statistics) noexcept -> bool {
+            if (TryLock() || Spin([this] { return TryLock(); }, statistics)) {
+                return true;
+            }
+            while (true) {
+                std::uint32_t state{ m_state.load(std::memory_order_relaxed) };
+                if ((state & (WRITE_LOCKED | READER_MASK)) == 0U) {
+                    // Keeps the waiting flag, other sleeping writers still need the wake from our unlock
+                    if (m_state.compare_exchange_weak(state, state | WRITE_LOCKED, std::memory_order_acquire, std::memory_order_relaxed)) {
+                        return true;
+                    }
+                    continue;
+                }
+                if (((state & WRITER_WAITING) == 0U) &&
+                        !m_state.compare_exchange_weak(state, state | WRITER_WAITING, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                    continue;
+                }
+                bool expired{ false };
+                const std::optional<std::chrono::nanoseconds> timeout{ GetTimeout(deadline, expired) };
+                if (expired) {
+                    // The readers held back by our flag would otherwise wait for an unlock that may not come
+                    (void)m_state.fetch_and(~WRITER_WAITING, std::memory_order_relaxed);
+                    FutexWakeAll(m_state);
+                    return false;
+                }
+                CountSleep(statistics);
+                FutexWait(m_state, state | WRITER_WAITING, timeout);
+            }
+        }
+
+        auto LockSharedUntil(const std::optional<std::chrono::steady_clock::time_point> deadline, AcquireStatistics *statistics) noexcept -> bool {
+            if (TryLockShared() || Spin([this] { return TryLockShared(); }, statistics)) {
+                return true;
+            }
+            while (true) {
+                std::uint32_t state{ m_state.load(std::memory_order_relaxed) };
+                if ((state & (WRITE_LOCKED | WRITER_WAITING)) == 0U) {
+                    if (m_state.compare_exchange_weak(state, state + 1U, std::memory_order_acquire, std::memory_order_relaxed)) {
+                        return true;
+                    }
+                    continue;
+                }
+                if (((state & READER_PARKED) == 0U) &&
+                        !m_state.compare_exchange_weak(state, state | READER_PARKED, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                    continue;
+                }
+                bool expired{ false };
+                const std::optional<std::chrono::nanoseconds> timeout{ GetTimeout(deadline, expired) };
+                if (expired) {
+                    return false;
+                }
+                CountSleep(statistics);
+                FutexWait(m_state, state | READER_PARKED, timeout);
+            }
+        }
+
+        std::atomic<std::uint32_t> m_state{ 0U };
+        std::atomic<std::uint32_t> m_spin_budget{ 256U };
+    };
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <thread>
+
+#ifdef __linux__
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+
+namespace Synapse::STL::Concurrent {
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "Futex words are plain 32 bit integers");
+
+    /**
+     * @brief Blocks while `word` holds `expected`, until woken by `FutexWakeAll` or the timeout passes.
+     *
+     * The check and the sleep are atomic in the kernel, a wake between the caller's load and
+     * this call is not lost. Returns spuriously as well, callers re-check their condition.
+     */
+    inline auto FutexWait(std::atomic<std::uint32_t> &word, const std::uint32_t expected,
+            const std::optional<std::chrono::nanoseconds> timeout = std::nullopt) noexcept -> void {
+#ifdef __linux__
+        timespec relative{};
+        if (timeout) {
+            const std::chrono::seconds seconds{ std::chrono::duration_cast<std::chrono::seconds>(*timeout) };
+            relative.tv_sec = static_cast<std::time_t>(seconds.count());
+            relative.tv_nsec = static_cast<long>((*timeout - seconds).count());
+        }
+        (void)::syscall(SYS_futex, std::bit_cast<std::uint32_t *>(&word), FUTEX_WAIT_PRIVATE, expected, timeout ? &relative : nullptr,
+                nullptr, 0);
+#elif defined(_WIN32)
+        std::uint32_t compare{ expected };
+        const DWORD milliseconds{ timeout ? static_cast<DWORD>(std::chrono::ceil<std::chrono::milliseconds>(*timeout).count()) : INFINITE };
+        (void)::WaitOnAddress(&word, &compare, sizeof(compare), milliseconds);
+#else
+        if (timeout) {
+            std::this_thread::yield();
+        } else {
+            word.wait(expected, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    /**
+     * @brief Wakes every thread blocked in `FutexWait` on `word`.
+     */
+    inline auto FutexWakeAll(std::atomic<std::uint32_t> &word) noexcept -> void {
+#ifdef __linux__
+        (void)::syscall(SYS_futex, std::bit_cast<std::uint32_t *>(&word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#elif defined(_WIN32)
+        ::WakeByAddressAll(&word);
+#else
+        word.notify_all();
+#endif
+    }
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <atomic>
+#include <concepts>
+#include <new>
+
+namespace Synapse::STL::Concurrent {
+    /**
+     * @brief Link embedded in the items of an `IntrusiveMpscQueue`, an item is in at most one queue at a time.
+     */
+    struct IntrusiveMpscNode {
+        std::atomic<IntrusiveMpscNode *> mpsc_next{ nullptr };
+    };
+
+    /**
+     * @brief Unbounded multi producer, single consumer queue linking the items through an embedded node.
+     *
+     * Vyukov's intrusive MPSC queue: a push is one exchange and one store, whatever the
+     * number of producers, and a pop touches no shared cache line unless the queue is
+     * nearly empty. The queue allocates nothing, the caller owns the items and keeps them
+     * alive until they are popped.
+     *
+     * A producer is briefly between its exchange and its link store, during that window
+     * `Pop` returns `nullptr` although the queue is not empty. A consumer that knows an
+     * item was pushed, e.g. from a separate counter, simply retries.
+     *
+     * @tparam TItem Item type, derived from `IntrusiveMpscNode`.
+     */
+    template <typename TItem>
+        requires std::derived_from<TItem, IntrusiveMpscNode>
+    class IntrusiveMpscQueue {
+    public:
+        IntrusiveMpscQueue() noexcept = default;
+        ~IntrusiveMpscQueue() = default;
+
+        IntrusiveMpscQueue(const IntrusiveMpscQueue&) = delete;
+        IntrusiveMpscQueue(IntrusiveMpscQueue&&) = delete;
+        auto operator=(const IntrusiveMpscQueue &) -> IntrusiveMpscQueue & = delete;
+        auto operator=(IntrusiveMpscQueue &&) -> IntrusiveMpscQueue & = delete;
+        auto operator==(const IntrusiveMpscQueue &other) const -> bool = delete;
+
+        /**
+         * @brief Appends an item, any thread.
+         */
+        auto Push(TItem *item) noexcept -> void {
+            PushNode(item);
+        }
+
+        /**
+         * @brief Takes the oldest item, consumer thread only.
+         * @return The item, `nullptr` if the queue is empty or the next push is not linked yet.
+         */
+        [[nodiscard]] auto Pop() noexcept -> TItem * {
+            IntrusiveMpscNode *tail{ m_tail };
+            IntrusiveMpscNode *next{ tail->mpsc_next.load(std::memory_order_acquire) };
+            if (tail == &m_stub) {
+                if (next == nullptr) {
+                    return nullptr;
+                }
+                m_tail = next;
+                tail = next;
+                next = next->mpsc_next.load(std::memory_order_acquire);
+            }
+            if (next != nullptr) {
+                m_tail = next;
+                return static_cast<TItem *>(tail);
+            }
+            if (tail != m_head.load(std::memory_order_acquire)) {
+                // A producer has swapped the head but not linked its item yet
+                return nullptr;
+            }
+            // Tail is the last item, put the stub behind it so it can be handed out
+            PushNode(&m_stub);
+            next = tail->mpsc_next.load(std::memory_order_acquire);
+            if (next != nullptr) {
+                m_tail = next;
+                return static_cast<TItem *>(tail);
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief `true` if nothing was pushed that has not been popped, consumer thread only.
+         */
+        [[nodiscard]] auto IsEmpty() const noexcept -> bool {
+            return (m_tail == &m_stub) && (m_stub.mpsc_next.load(std::memory_order_acquire) == nullptr) &&
+                    (m_head.load(std::memory_order_acquire) == &m_stub);
+        }
+
+    private:
+        auto PushNode(IntrusiveMpscNode *node) noexcept -> void {
+            node->mpsc_next.store(nullptr, std::memory_order_relaxed);
+            IntrusiveMpscNode *previous{ m_head.exchange(node, std::memory_order_acq_rel) };
+            previous->mpsc_next.store(node, std::memory_order_release);
+        }
+
+        alignas(std::hardware_destructive_interference_size) std::atomic<IntrusiveMpscNode *> m_head{ &m_stub };
+        alignas(std::hardware_destructive_interference_size) IntrusiveMpscNode *m_tail{ &m_stub };  ///< Consumer thread only.
+        IntrusiveMpscNode m_stub{};
+    };
+}
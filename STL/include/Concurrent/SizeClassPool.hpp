@@ -0,0 +1,66 @@
+#pragma once
+#include <Concurrent/ThreadCachedPool.hpp>
+#include <array>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace Synapse::STL::Concurrent {
+    /**
+     * @brief Allocator for variable sized blocks, rounded up to power of two size classes served by `ThreadCachedPool`.
+     *
+     * Meant for short lived blocks whose size is only known at runtime but repeats, e.g.
+     * coroutine frames. Blocks larger than `MAX_SIZE` come from the global operator new.
+     * The size has to be passed back on deallocation, like the sized operator delete does.
+     */
+    class SizeClassPool {
+        template <std::size_t TSize>
+        struct alignas(std::max_align_t) Block {
+            std::byte bytes[TSize];
+        };
+
+        static constexpr std::size_t MIN_SIZE{ 64U };
+        static constexpr std::size_t CLASS_COUNT{ 7U };
+
+    public:
+        static constexpr std::size_t MAX_SIZE{ MIN_SIZE << (CLASS_COUNT - 1U) };
+
+        [[nodiscard]] static auto Allocate(const std::size_t size) -> void * {
+            const std::size_t size_class{ GetClass(size) };
+            return (size_class == CLASS_COUNT) ? ::operator new(size) : GetClasses()[size_class].allocate();
+        }
+
+        static auto Deallocate(void *block, const std::size_t size) -> void {
+            const std::size_t size_class{ GetClass(size) };
+            if (size_class == CLASS_COUNT) {
+                ::operator delete(block, size);
+            } else {
+                GetClasses()[size_class].deallocate(block);
+            }
+        }
+
+    private:
+        struct ClassEntry {
+            void *(*allocate)();
+            void (*deallocate)(void *);
+        };
+
+        [[nodiscard]] static constexpr auto GetClass(const std::size_t size) noexcept -> std::size_t {
+            std::size_t size_class{ 0U };
+            for (std::size_t class_size = MIN_SIZE; (class_size < size) && (size_class < CLASS_COUNT); class_size <<= 1U) {
+                ++size_class;
+            }
+            return size_class;
+        }
+
+        template <std::size_t... TClass>
+        [[nodiscard]] static consteval auto MakeClasses(std::index_sequence<TClass...>) noexcept -> std::array<ClassEntry, CLASS_COUNT> {
+            return { ClassEntry{ &ThreadCachedPool<Block<(MIN_SIZE << TClass)>>::Allocate, &ThreadCachedPool<Block<(MIN_SIZE << TClass)>>::Deallocate }... };
+        }
+
+        [[nodiscard]] static auto GetClasses() noexcept -> const std::array<ClassEntry, CLASS_COUNT> & {
+            static constexpr std::array<ClassEntry, CLASS_COUNT> CLASSES{ MakeClasses(std::make_index_sequence<CLASS_COUNT>{}) };
+            return CLASSES;
+        }
+    };
+}
@@ -0,0 +1,160 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Synapse::STL::Concurrent {
+    /**
+     * @brief Process wide pool of `TType` sized slots with a free list cached per thread.
+     *
+     * A thread takes and returns slots through its own cache without synchronisation. The
+     * caches exchange whole batches of `BATCH_SIZE` slots with a shared list under a mutex,
+     * so the lock is taken at most once every `BATCH_SIZE` operations, also when objects are
+     * created on one thread and destroyed on another. New slots are allocated a batch at a
+     * time and are kept until the process exits.
+     *
+     * @tparam TType Type of the objects constructed in the slots.
+     */
+    template <typename TType>
+    class ThreadCachedPool {
+        struct FreeSlot {
+            FreeSlot *next;
+        };
+
+        struct alignas(std::max(alignof(TType), alignof(FreeSlot))) Slot {
+            std::byte bytes[std::max(sizeof(TType), sizeof(FreeSlot))];
+        };
+
+        // Shared part: batches of exactly BATCH_SIZE linked slots
+        class Central {
+        public:
+            auto TakeBatch() -> FreeSlot * {
+                std::scoped_lock lock{ m_mutex };
+                if (!m_batches.empty()) {
+                    FreeSlot *batch{ m_batches.back() };
+                    m_batches.pop_back();
+                    return batch;
+                }
+                auto &chunk{ m_chunks.emplace_back(std::make_unique<Slot[]>(BATCH_SIZE)) };
+                FreeSlot *head{ nullptr };
+                for (std::size_t index = BATCH_SIZE; index > 0U; --index) {
+                    head = std::construct_at(std::bit_cast<FreeSlot *>(&chunk[index - 1U]), FreeSlot{ head });
+                }
+                return head;
+            }
+
+            auto GiveBatch(FreeSlot *batch) -> void {
+                std::scoped_lock lock{ m_mutex };
+                m_batches.push_back(batch);
+            }
+
+        private:
+            std::mutex m_mutex{};
+            std::vector<FreeSlot *> m_batches{};
+            std::vector<std::unique_ptr<Slot[]>> m_chunks{};
+        };
+
+        // Per thread part, hands its slots back when the thread exits
+        class Cache {
+        public:
+            Cache() = default;
+            ~Cache() {
+                while (m_count >= BATCH_SIZE) {
+                    GetCentral().GiveBatch(SplitBatch());
+                }
+                // A partial batch is leaked into the chunks, they live until the process exits
+            }
+
+            Cache(const Cache&) = delete;
+            Cache(Cache&&) = delete;
+            auto operator=(const Cache &) -> Cache & = delete;
+            auto operator=(Cache &&) -> Cache & = delete;
+
+            [[nodiscard]] auto Pop() -> void * {
+                if (m_head == nullptr) {
+                    m_head = GetCentral().TakeBatch();
+                    m_count = BATCH_SIZE;
+                }
+                FreeSlot *slot{ m_head };
+                m_head = slot->next;
+                --m_count;
+                std::destroy_at(slot);
+                return slot;
+            }
+
+            auto Push(void *storage) -> void {
+                m_head = std::construct_at(static_cast<FreeSlot *>(storage), FreeSlot{ m_head });
+                if (++m_count == (2U * BATCH_SIZE)) {
+                    GetCentral().GiveBatch(SplitBatch());
+                }
+            }
+
+        private:
+            // Unlinks the first BATCH_SIZE slots
+            auto SplitBatch() noexcept -> FreeSlot * {
+                FreeSlot *batch{ m_head };
+                FreeSlot *last{ m_head };
+                for (std::size_t index = 1U; index < BATCH_SIZE; ++index) {
+                    last = last->next;
+                }
+                m_head = last->next;
+                last->next = nullptr;
+                m_count -= BATCH_SIZE;
+                return batch;
+            }
+
+            FreeSlot *m_head{ nullptr };
+            std::size_t m_count{ 0U };
+        };
+
+    public:
+        static constexpr std::size_t BATCH_SIZE{ 64U };
+
+        /**
+         * @brief Uninitialised storage for one `TType`.
+         */
+        [[nodiscard]] static auto Allocate() -> void * {
+            return GetCache().Pop();
+        }
+
+        /**
+         * @brief Returns storage obtained from `Allocate` on any thread.
+         */
+        static auto Deallocate(void *storage) -> void {
+            GetCache().Push(storage);
+        }
+
+        template <typename... TArgs>
+        [[nodiscard]] static auto Create(TArgs&&... args) -> TType * {
+            void *storage{ Allocate() };
+            try {
+                return std::construct_at(static_cast<TType *>(storage), std::forward<TArgs>(args)...);
+            } catch (...) {
+                Deallocate(storage);
+                throw;
+            }
+        }
+
+        static auto Destroy(TType *object) -> void {
+            std::destroy_at(object);
+            Deallocate(object);
+        }
+
+    private:
+        // Never destroyed, the main thread's cache may be destroyed after the function statics at exit
+        static auto GetCentral() -> Central & {
+            static Central *const central{ new Central{} };
+            return *central;
+        }
+
+        static auto GetCache() -> Cache & {
+            thread_local Cache cache{};
+            return cache;
+        }
+    };
+}
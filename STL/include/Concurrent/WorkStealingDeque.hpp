@@ -0,0 +1,149 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace Synapse::STL::Concurrent {
+    /**
+     * @brief Chase-Lev work-stealing deque.
+     *
+     * The owning thread pushes and pops at the bottom without contention, any other thread
+     * steals from the top with one compare-exchange. Only a pop racing a steal for the last
+     * item costs the owner a compare-exchange. Uses the memory orderings of Lê et al.,
+     * "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+     *
+     * The ring buffer doubles when it is full. Replaced buffers are kept until the deque is
+     * destroyed, because a thief may still be reading from them.
+     *
+     * @tparam TType Item type, copied with plain atomic loads and stores, e.g. a pointer.
+     */
+    template <typename TType>
+    class WorkStealingDeque {
+        static_assert(std::is_trivially_copyable_v<TType> && std::atomic<TType>::is_always_lock_free,
+                "Items are copied with atomic loads and stores");
+
+        struct Buffer {
+            explicit Buffer(const std::int64_t capacity) :
+                mask(capacity - 1), items(std::make_unique<std::atomic<TType>[]>(static_cast<std::size_t>(capacity))) {}
+
+            [[nodiscard]] auto GetCapacity() const noexcept -> std::int64_t { return mask + 1; }
+            [[nodiscard]] auto Load(const std::int64_t index) const noexcept -> TType {
+                return items[static_cast<std::size_t>(index & mask)].load(std::memory_order_relaxed);
+            }
+            auto Store(const std::int64_t index, const TType item) noexcept -> void {
+                items[static_cast<std::size_t>(index & mask)].store(item, std::memory_order_relaxed);
+            }
+
+            std::int64_t mask;
+            std::unique_ptr<std::atomic<TType>[]> items;
+        };
+
+    public:
+        /**
+         * @param initial_capacity Number of items before the first growth, rounded up to a power of two.
+         */
+        explicit WorkStealingDeque(const std::size_t initial_capacity = 256U) {
+            m_buffers.push_back(std::make_unique<Buffer>(static_cast<std::int64_t>(std::bit_ceil(std::max<std::size_t>(initial_capacity, 2U)))));
+            m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+        }
+        ~WorkStealingDeque() = default;
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque(WorkStealingDeque&&) = delete;
+        auto operator=(const WorkStealingDeque &) -> WorkStealingDeque & = delete;
+        auto operator=(WorkStealingDeque &&) -> WorkStealingDeque & = delete;
+        auto operator==(const WorkStealingDeque &other) const -> bool = delete;
+
+        /**
+         * @brief Adds an item at the bottom, owner thread only.
+         */
+        auto Push(const TType item) -> void {
+            const std::int64_t bottom{ m_bottom.load(std::memory_order_relaxed) };
+            const std::int64_t top{ m_top.load(std::memory_order_acquire) };
+            Buffer *buffer{ m_buffer.load(std::memory_order_relaxed) };
+            if ((bottom - top) >= buffer->GetCapacity()) {
+                buffer = Grow(buffer, top, bottom);
+            }
+            buffer->Store(bottom, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Takes the most recently pushed item, owner thread only.
+         */
+        [[nodiscard]] auto Pop() noexcept -> std::optional<TType> {
+            const std::int64_t bottom{ m_bottom.load(std::memory_order_relaxed) - 1 };
+            Buffer *buffer{ m_buffer.load(std::memory_order_relaxed) };
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t top{ m_top.load(std::memory_order_relaxed) };
+
+            if (top > bottom) {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+            const TType item{ buffer->Load(bottom) };
+            if (top == bottom) {
+                // Last item, race the thieves for it
+                const bool won{ m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) };
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                if (!won) {
+                    return std::nullopt;
+                }
+            }
+            return item;
+        }
+
+        /**
+         * @brief Takes the oldest item, any thread.
+         * @return The item, empty if the deque is empty or another thread took the item first.
+         */
+        [[nodiscard]] auto Steal() noexcept -> std::optional<TType> {
+            std::int64_t top{ m_top.load(std::memory_order_acquire) };
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::int64_t bottom{ m_bottom.load(std::memory_order_acquire) };
+            if (top >= bottom) {
+                return std::nullopt;
+            }
+            const TType item{ m_buffer.load(std::memory_order_acquire)->Load(top) };
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return std::nullopt;
+            }
+            return item;
+        }
+
+        /**
+         * @brief Number of items at the time of the call, the state may have changed by the time it is examined.
+         */
+        [[nodiscard]] auto WasSize() const noexcept -> std::size_t {
+            const std::int64_t bottom{ m_bottom.load(std::memory_order_relaxed) };
+            const std::int64_t top{ m_top.load(std::memory_order_relaxed) };
+            return (bottom > top) ? static_cast<std::size_t>(bottom - top) : 0U;
+        }
+
+    private:
+        auto Grow(const Buffer *buffer, const std::int64_t top, const std::int64_t bottom) -> Buffer * {
+            auto grown{ std::make_unique<Buffer>(buffer->GetCapacity() * 2) };
+            for (std::int64_t index = top; index < bottom; ++index) {
+                grown->Store(index, buffer->Load(index));
+            }
+            Buffer *result{ grown.get() };
+            m_buffers.push_back(std::move(grown));
+            m_buffer.store(result, std::memory_order_release);
+            return result;
+        }
+
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::int64_t> m_top{ 0 };
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::int64_t> m_bottom{ 0 };
+        std::atomic<Buffer *> m_buffer{ nullptr };
+        std::vector<std::unique_ptr<Buffer>> m_buffers{};  ///< Every buffer ever used, owner thread only.
+    };
+}
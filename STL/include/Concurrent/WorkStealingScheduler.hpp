@@ -0,0 +1,394 @@
+#pragma once
+#include <Concurrent/Futex.hpp>
+#include <Concurrent/WorkStealingDeque.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <vector>
+#include <libassert/assert.hpp>
+
+namespace Synapse::STL::Concurrent {
+    /**
+     * @brief Distributes items over per-worker work-stealing deques, idle workers steal or park.
+     *
+     * A worker pushes onto its own deque and pops from it first, so work created by a worker
+     * stays on its core while it is busy. An idle worker checks the injection queue, which
+     * takes the items pushed by threads that are not workers, then steals from the other
+     * workers starting at a random victim. Workers that find nothing park on a futex word of
+     * their own, so a push wakes exactly one of them; threads that are not workers park on a
+     * shared condition variable. Pushing only wakes anyone when someone is parked.
+     *
+     * `PushTo` hands an item to a chosen worker, e.g. the one whose cache holds the item's data.
+     * It waits in that worker's inbox, which the worker drains right after its own deque. Other
+     * workers take it only once it has waited the steal delay, so a busy worker does not hold
+     * up its items for long, and an idle one gets them without losing them to a thief.
+     *
+     * The caller identifies the worker by the index it was given, e.g. kept in a thread local.
+     *
+     * @tparam TItem Item type, copied with plain atomic loads and stores, e.g. a pointer.
+     */
+    template <typename TItem>
+    class WorkStealingScheduler {
+        struct Mailed {
+            TItem item;
+            std::int64_t pushed;  ///< Steady clock nanoseconds.
+        };
+
+        struct alignas(std::hardware_destructive_interference_size) Worker {
+            WorkStealingDeque<TItem> deque{};
+            std::uint64_t random_state{ 0U };  ///< Owner thread only.
+
+            std::mutex inbox_mutex{};
+            std::deque<Mailed> inbox{};
+            std::atomic<std::size_t> inbox_size{ 0U };
+            std::atomic<std::int64_t> inbox_front_pushed{ 0 };  ///< Of the oldest mailed item, read by thieves without the mutex.
+
+            std::atomic<std::uint32_t> wake_word{ 0U };  ///< Futex word the worker parks on, bumped to wake it.
+            std::atomic<bool> parked{ false };           ///< Cleared by the thread that claims the worker to wake it.
+        };
+
+    public:
+        static constexpr std::uint32_t NO_WORKER{ 0xFFFFFFFFU };
+
+        /**
+         * @param worker_count Number of threads that can register as workers.
+         * @param steal_delay How long an item handed to a worker with `PushTo` is kept from the other workers.
+         */
+        explicit WorkStealingScheduler(const std::uint32_t worker_count, const std::chrono::nanoseconds steal_delay = std::chrono::nanoseconds{ 0 })
+                : m_workers(std::max<std::uint32_t>(worker_count, 1U)), m_steal_delay(steal_delay.count()) {
+            for (std::uint32_t index = 0U; index < m_workers.size(); ++index) {
+                // Any odd seed works, spread them so the workers pick different victims
+                m_workers[index].random_state = (0x9E3779B97F4A7C15ULL * (index + 1U)) | 1U;
+            }
+        }
+        ~WorkStealingScheduler() = default;
+
+        WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+        WorkStealingScheduler(WorkStealingScheduler&&) = delete;
+        auto operator=(const WorkStealingScheduler &) -> WorkStealingScheduler & = delete;
+        auto operator=(WorkStealingScheduler &&) -> WorkStealingScheduler & = delete;
+        auto operator==(const WorkStealingScheduler &other) const -> bool = delete;
+
+        /**
+         * @brief Hands out a worker index, each worker thread registers once.
+         * @return The index, `NO_WORKER` when every index is taken; such a thread uses the injection queue.
+         */
+        [[nodiscard]] auto RegisterWorker() noexcept -> std::uint32_t {
+            const std::uint32_t index{ m_registered.fetch_add(1U, std::memory_order_relaxed) };
+            return (index < m_workers.size()) ? index : NO_WORKER;
+        }
+
+        /**
+         * @brief Adds an item, onto the worker's own deque or the injection queue for `NO_WORKER`.
+         */
+        auto Push(const TItem item, const std::uint32_t worker) -> void {
+            if (worker == NO_WORKER) {
+                std::scoped_lock lock{ m_injection_mutex };
+                m_injection.push_back(item);
+                m_injection_size.store(m_injection.size(), std::memory_order_relaxed);
+            } else {
+                DEBUG_ASSERT(worker < m_workers.size(), "Invalid worker index", worker);
+                m_workers[worker].deque.Push(item);
+            }
+            WakeOne();
+        }
+
+        /**
+         * @brief Adds an item for `target`, from the thread of `worker`.
+         *
+         * Onto the own deque when the target is the caller, as `Push` when there is no target.
+         */
+        auto PushTo(const TItem item, const std::uint32_t target, const std::uint32_t worker) -> void {
+            if ((target == worker) || (target >= m_workers.size())) {
+                Push(item, worker);
+                return;
+            }
+
+            Worker &receiver{ m_workers[target] };
+            {
+                std::scoped_lock lock{ receiver.inbox_mutex };
+                const std::int64_t now{ Now() };
+                if (receiver.inbox.empty()) {
+                    receiver.inbox_front_pushed.store(now, std::memory_order_relaxed);
+                }
+                receiver.inbox.push_back(Mailed{ item, now });
+                receiver.inbox_size.store(receiver.inbox.size(), std::memory_order_relaxed);
+            }
+            // A busy target may not get to the item before the steal delay, then let one other worker
+            // park again with a deadline at which it may steal it
+            if (!WakeWorker(receiver)) {
+                WakeOne();
+            }
+        }
+
+        /**
+         * @brief Takes an item: own deque and inbox first, then the injection queue, then the other workers.
+         */
+        [[nodiscard]] auto Pop(const std::uint32_t worker) -> std::optional<TItem> {
+            if (worker != NO_WORKER) {
+                if (const std::optional<TItem> item{ m_workers[worker].deque.Pop() }) {
+                    return item;
+                }
+                if (const std::optional<TItem> item{ PopMailed(m_workers[worker], std::numeric_limits<std::int64_t>::max()) }) {
+                    return item;
+                }
+            }
+            if (const std::optional<TItem> item{ PopInjected() }) {
+                return item;
+            }
+            return Steal(worker);
+        }
+
+        /**
+         * @brief Blocks until an item is pushed, `Stop` is called or the deadline passes.
+         *
+         * Returns immediately if work `worker` may take is visible, so a push racing the call is not
+         * missed. Wakes early when an item in another worker's inbox becomes stealable.
+         */
+        auto Park(std::chrono::steady_clock::time_point deadline, const std::uint32_t worker = NO_WORKER) -> void {
+            if (worker == NO_WORKER) {
+                std::unique_lock lock{ m_park_mutex };
+                (void)m_sleepers.fetch_add(1U, std::memory_order_seq_cst);
+                // Pairs with the fence in WakeOne: either the pusher sees the sleeper or we see its item
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (!HasWorkFor(worker, deadline) && !m_stopped.load(std::memory_order_relaxed)) {
+                    const std::uint64_t epoch{ m_wake_epoch };
+                    (void)m_park_condition.wait_until(lock, deadline,
+                            [&] { return (m_wake_epoch != epoch) || m_stopped.load(std::memory_order_relaxed); });
+                }
+                (void)m_sleepers.fetch_sub(1U, std::memory_order_relaxed);
+                return;
+            }
+
+            Worker &self{ m_workers[worker] };
+            // Read before announcing, a wake that bumps it from here on makes the futex wait return at once
+            const std::uint32_t word{ self.wake_word.load(std::memory_order_acquire) };
+            (void)m_parked_workers.fetch_add(1U, std::memory_order_relaxed);
+            self.parked.store(true, std::memory_order_relaxed);
+            // Pairs with the fence in WakeOne and WakeWorker: either the pusher sees us parked or we see its item
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!HasWorkFor(worker, deadline) && !m_stopped.load(std::memory_order_relaxed)) {
+                const std::chrono::steady_clock::duration timeout{ deadline - std::chrono::steady_clock::now() };
+                if (timeout > std::chrono::steady_clock::duration::zero()) {
+                    FutexWait(self.wake_word, word, timeout);
+                }
+            }
+            self.parked.store(false, std::memory_order_relaxed);
+            (void)m_parked_workers.fetch_sub(1U, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Wakes every parked worker and keeps `Park` from blocking, e.g. on shutdown.
+         */
+        auto Stop() -> void {
+            {
+                std::scoped_lock lock{ m_park_mutex };
+                m_stopped.store(true, std::memory_order_relaxed);
+            }
+            m_park_condition.notify_all();
+            for (Worker &worker : m_workers) {
+                (void)worker.wake_word.fetch_add(1U, std::memory_order_release);
+                FutexWakeAll(worker.wake_word);
+            }
+        }
+
+        /**
+         * @brief Hands every item left to `visitor`, ignoring the steal delay, e.g. to release them on shutdown.
+         *
+         * Only once no thread pushes or pops any more.
+         */
+        template <typename TVisitor>
+        auto Drain(TVisitor &&visitor) -> void {
+            for (Worker &worker : m_workers) {
+                while (const std::optional<TItem> item{ worker.deque.Steal() }) {
+                    visitor(*item);
+                }
+                while (const std::optional<TItem> item{ PopMailed(worker, std::numeric_limits<std::int64_t>::max()) }) {
+                    visitor(*item);
+                }
+            }
+            while (const std::optional<TItem> item{ PopInjected() }) {
+                visitor(*item);
+            }
+        }
+
+        [[nodiscard]] auto HasWork() const noexcept -> bool {
+            if (m_injection_size.load(std::memory_order_relaxed) > 0U) {
+                return true;
+            }
+            return std::ranges::any_of(m_workers, [](const Worker &worker) {
+                return (worker.deque.WasSize() > 0U) || (worker.inbox_size.load(std::memory_order_relaxed) > 0U);
+            });
+        }
+
+        [[nodiscard]] auto GetWorkerCount() const noexcept -> std::uint32_t { return static_cast<std::uint32_t>(m_workers.size()); }
+
+        auto SetStealDelay(const std::chrono::nanoseconds steal_delay) noexcept -> void {
+            m_steal_delay.store(steal_delay.count(), std::memory_order_relaxed);
+        }
+
+    private:
+        [[nodiscard]] static auto Now() noexcept -> std::int64_t {
+            return std::chrono::steady_clock::now().time_since_epoch().count();
+        }
+
+        // Work the worker may take now; moves the deadline up to when the first item it may not take yet becomes stealable
+        [[nodiscard]] auto HasWorkFor(const std::uint32_t worker, std::chrono::steady_clock::time_point &deadline) const -> bool {
+            if (m_injection_size.load(std::memory_order_relaxed) > 0U) {
+                return true;
+            }
+            const std::int64_t steal_delay{ m_steal_delay.load(std::memory_order_relaxed) };
+            for (std::uint32_t index = 0U; index < m_workers.size(); ++index) {
+                const Worker &other{ m_workers[index] };
+                if (other.deque.WasSize() > 0U) {
+                    return true;
+                }
+                if (other.inbox_size.load(std::memory_order_relaxed) == 0U) {
+                    continue;
+                }
+                if (index == worker) {
+                    return true;
+                }
+                const std::chrono::steady_clock::time_point stealable{ std::chrono::nanoseconds{ other.inbox_front_pushed.load(std::memory_order_relaxed) + steal_delay } };
+                if (stealable <= std::chrono::steady_clock::now()) {
+                    return true;
+                }
+                deadline = std::min(deadline, stealable);
+            }
+            return false;
+        }
+
+        // Wakes the worker if it is parked, returns whether it was
+        auto WakeWorker(Worker &worker) -> bool {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return Unpark(worker);
+        }
+
+        // Parked workers first, they can take any item; threads that are not workers otherwise
+        auto WakeOne() -> void {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_parked_workers.load(std::memory_order_relaxed) > 0U) {
+                for (Worker &worker : m_workers) {
+                    if (Unpark(worker)) {
+                        return;
+                    }
+                }
+            }
+            if (m_sleepers.load(std::memory_order_relaxed) == 0U) {
+                return;
+            }
+            {
+                std::scoped_lock lock{ m_park_mutex };
+                ++m_wake_epoch;
+            }
+            m_park_condition.notify_one();
+        }
+
+        // Claims the parked worker so no other push wakes it as well, then wakes it
+        static auto Unpark(Worker &worker) -> bool {
+            if (!worker.parked.load(std::memory_order_relaxed) || !worker.parked.exchange(false, std::memory_order_relaxed)) {
+                return false;
+            }
+            (void)worker.wake_word.fetch_add(1U, std::memory_order_release);
+            FutexWakeAll(worker.wake_word);
+            return true;
+        }
+
+        [[nodiscard]] auto PopInjected() -> std::optional<TItem> {
+            if (m_injection_size.load(std::memory_order_relaxed) == 0U) {
+                return std::nullopt;
+            }
+            std::scoped_lock lock{ m_injection_mutex };
+            if (m_injection.empty()) {
+                return std::nullopt;
+            }
+            const TItem item{ m_injection.front() };
+            m_injection.pop_front();
+            m_injection_size.store(m_injection.size(), std::memory_order_relaxed);
+            return item;
+        }
+
+        // Takes the oldest mailed item if it was pushed at or before `pushed_before`
+        [[nodiscard]] static auto PopMailed(Worker &owner, const std::int64_t pushed_before) -> std::optional<TItem> {
+            if ((owner.inbox_size.load(std::memory_order_relaxed) == 0U) || (owner.inbox_front_pushed.load(std::memory_order_relaxed) > pushed_before)) {
+                return std::nullopt;
+            }
+            std::scoped_lock lock{ owner.inbox_mutex };
+            if (owner.inbox.empty() || (owner.inbox.front().pushed > pushed_before)) {
+                return std::nullopt;
+            }
+            const TItem item{ owner.inbox.front().item };
+            owner.inbox.pop_front();
+            owner.inbox_size.store(owner.inbox.size(), std::memory_order_relaxed);
+            if (!owner.inbox.empty()) {
+                owner.inbox_front_pushed.store(owner.inbox.front().pushed, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        // Visits every other worker once, starting at a random one; inboxes only after their deques, and only what waited the steal delay
+        [[nodiscard]] auto Steal(const std::uint32_t worker) -> std::optional<TItem> {
+            const auto count{ static_cast<std::uint32_t>(m_workers.size()) };
+            const std::uint32_t start{ (worker == NO_WORKER) ? 0U : static_cast<std::uint32_t>(NextRandom(m_workers[worker].random_state) % count) };
+            for (std::uint32_t offset = 0U; offset < count; ++offset) {
+                const std::uint32_t victim{ (start + offset) % count };
+                if (victim == worker) {
+                    continue;
+                }
+                if (const std::optional<TItem> item{ m_workers[victim].deque.Steal() }) {
+                    return item;
+                }
+            }
+
+            std::int64_t pushed_before{ std::numeric_limits<std::int64_t>::min() };
+            for (std::uint32_t offset = 0U; offset < count; ++offset) {
+                const std::uint32_t index{ (start + offset) % count };
+                Worker &victim{ m_workers[index] };
+                if ((index == worker) || (victim.inbox_size.load(std::memory_order_relaxed) == 0U)) {
+                    continue;
+                }
+                // The clock is only read once some inbox has items
+                if (pushed_before == std::numeric_limits<std::int64_t>::min()) {
+                    pushed_before = Now() - m_steal_delay.load(std::memory_order_relaxed);
+                }
+                if (const std::optional<TItem> item{ PopMailed(victim, pushed_before) }) {
+                    return item;
+                }
+            }
+            return std::nullopt;
+        }
+
+        // xorshift64, good enough to spread the victims
+        [[nodiscard]] static auto NextRandom(std::uint64_t &state) noexcept -> std::uint64_t {
+            state ^= state << 13U;
+            state ^= state >> 7U;
+            state ^= state << 17U;
+            return state;
+        }
+
+        std::vector<Worker> m_workers;
+        std::atomic<std::uint32_t> m_registered{ 0U };
+        std::atomic<std::int64_t> m_steal_delay;  ///< Nanoseconds.
+
+        std::mutex m_injection_mutex{};
+        std::deque<TItem> m_injection{};
+        std::atomic<std::size_t> m_injection_size{ 0U };
+
+        // Threads that are not workers park on the condition variable
+        std::mutex m_park_mutex{};
+        std::condition_variable m_park_condition{};
+        alignas(std::hardware_destructive_interference_size) std::atomic<std::uint32_t> m_sleepers{ 0U };
+        std::atomic<std::uint32_t> m_parked_workers{ 0U };
+        std::uint64_t m_wake_epoch{ 0U };  ///< Guarded by the park mutex.
+        std::atomic<bool> m_stopped{ false };
+    };
+}
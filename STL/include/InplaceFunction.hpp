@@ -0,0 +1,138 @@
+#pragma once
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <libassert/assert.hpp>
+
+namespace Synapse::STL {
+    template <typename TSignature, std::size_t TCapacity = 48U>
+    class InplaceFunction;
+
+    /**
+     * @brief Move-only type-erased callable storing the callable inside the object.
+     *
+     * Unlike `std::function` the callable does not have to be copyable, and any callable up
+     * to `TCapacity` bytes that is nothrow move constructible is kept in the inline buffer,
+     * so wrapping a lambda does not allocate. Larger callables fall back to the heap, check
+     * `IS_INLINE` to keep hot paths allocation free.
+     *
+     * @tparam TReturn   Return type of the call.
+     * @tparam TArgs     Parameter types of the call.
+     * @tparam TCapacity Size of the inline buffer in bytes.
+     */
+    template <typename TReturn, typename... TArgs, std::size_t TCapacity>
+    class InplaceFunction<TReturn(TArgs...), TCapacity> {
+        static_assert(TCapacity >= sizeof(void *), "The inline buffer has to hold the pointer of the heap fallback");
+
+        enum class Operation : std::uint8_t { MOVE, DESTROY };
+        using Invoker = TReturn (*)(std::byte *, TArgs&&...);
+        using Manager = void (*)(Operation, std::byte *, std::byte *) noexcept;
+
+    public:
+        template <typename TCallable>
+        static constexpr bool IS_INLINE{ (sizeof(TCallable) <= TCapacity) && (alignof(TCallable) <= alignof(std::max_align_t)) &&
+                std::is_nothrow_move_constructible_v<TCallable> };
+
+        InplaceFunction() noexcept = default;
+
+        template <typename TCallable>
+            requires (!std::same_as<std::remove_cvref_t<TCallable>, InplaceFunction>) &&
+                    std::is_invocable_r_v<TReturn, std::decay_t<TCallable>&, TArgs...>
+        InplaceFunction(TCallable &&callable) {  // Implicit, like std::function
+            using Stored = std::decay_t<TCallable>;
+            if constexpr (IS_INLINE<Stored>) {
+                std::construct_at(std::bit_cast<Stored *>(&m_storage[0]), std::forward<TCallable>(callable));
+                m_invoker = &InvokeInline<Stored>;
+                m_manager = &ManageInline<Stored>;
+            } else {
+                std::construct_at(std::bit_cast<Stored **>(&m_storage[0]), new Stored(std::forward<TCallable>(callable)));
+                m_invoker = &InvokeHeap<Stored>;
+                m_manager = &ManageHeap<Stored>;
+            }
+        }
+
+        ~InplaceFunction() {
+            Reset();
+        }
+
+        InplaceFunction(const InplaceFunction&) = delete;
+        InplaceFunction(InplaceFunction &&other) noexcept : m_invoker(other.m_invoker), m_manager(other.m_manager) {
+            if (m_manager != nullptr) {
+                m_manager(Operation::MOVE, &other.m_storage[0], &m_storage[0]);
+                other.m_invoker = nullptr;
+                other.m_manager = nullptr;
+            }
+        }
+        auto operator=(const InplaceFunction &) -> InplaceFunction & = delete;
+        auto operator=(InplaceFunction &&other) noexcept -> InplaceFunction & {
+            if (this != &other) {
+                Reset();
+                if (other.m_manager != nullptr) {
+                    other.m_manager(Operation::MOVE, &other.m_storage[0], &m_storage[0]);
+                    m_invoker = std::exchange(other.m_invoker, nullptr);
+                    m_manager = std::exchange(other.m_manager, nullptr);
+                }
+            }
+            return *this;
+        }
+        auto operator==(const InplaceFunction &other) const -> bool = delete;
+
+        auto operator()(TArgs... args) -> TReturn {
+            DEBUG_ASSERT(m_invoker != nullptr, "Calling an empty InplaceFunction");
+            return m_invoker(&m_storage[0], std::forward<TArgs>(args)...);
+        }
+
+        explicit operator bool() const noexcept { return m_invoker != nullptr; }
+
+        /**
+         * @brief Destroys the callable, the function is empty afterwards.
+         */
+        auto Reset() noexcept -> void {
+            if (m_manager != nullptr) {
+                m_manager(Operation::DESTROY, &m_storage[0], nullptr);
+                m_invoker = nullptr;
+                m_manager = nullptr;
+            }
+        }
+
+    private:
+        template <typename TCallable>
+        static auto InvokeInline(std::byte *storage, TArgs&&... args) -> TReturn {
+            return std::invoke(*std::launder(std::bit_cast<TCallable *>(storage)), std::forward<TArgs>(args)...);
+        }
+
+        template <typename TCallable>
+        static auto InvokeHeap(std::byte *storage, TArgs&&... args) -> TReturn {
+            return std::invoke(**std::launder(std::bit_cast<TCallable **>(storage)), std::forward<TArgs>(args)...);
+        }
+
+        template <typename TCallable>
+        static auto ManageInline(const Operation operation, std::byte *source, std::byte *destination) noexcept -> void {
+            TCallable *callable{ std::launder(std::bit_cast<TCallable *>(source)) };
+            if (operation == Operation::MOVE) {
+                std::construct_at(std::bit_cast<TCallable *>(destination), std::move(*callable));
+            }
+            std::destroy_at(callable);
+        }
+
+        template <typename TCallable>
+        static auto ManageHeap(const Operation operation, std::byte *source, std::byte *destination) noexcept -> void {
+            TCallable **callable{ std::launder(std::bit_cast<TCallable **>(source)) };
+            if (operation == Operation::MOVE) {
+                std::construct_at(std::bit_cast<TCallable **>(destination), *callable);
+            } else {
+                delete *callable;
+            }
+        }
+
+        alignas(std::max_align_t) std::byte m_storage[TCapacity];
+        Invoker m_invoker{ nullptr };
+        Manager m_manager{ nullptr };
+    };
+}
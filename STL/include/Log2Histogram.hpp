@@ -0,0 +1,67 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace Synapse::STL {
+    /**
+     * @brief Counts of values in power of two buckets, for latency distributions.
+     *
+     * Bucket `i` counts values in [2^i, 2^(i+1)), zero goes to the first bucket and the last
+     * bucket is open ended. Quantiles are read as the upper bound of their bucket, so they
+     * are exact to within a factor of two.
+     *
+     * Not thread safe, concurrent writers keep one each and `Merge` them.
+     */
+    struct Log2Histogram {
+        static constexpr std::size_t BUCKET_COUNT{ 32U };
+
+        std::array<std::uint64_t, BUCKET_COUNT> counts{};
+
+        [[nodiscard]] static constexpr auto GetBucket(const std::uint64_t value) noexcept -> std::size_t {
+            return std::min<std::size_t>(std::bit_width(std::max<std::uint64_t>(value, 1U)) - 1U, BUCKET_COUNT - 1U);
+        }
+
+        constexpr auto Record(const std::uint64_t value) noexcept -> void {
+            ++counts[GetBucket(value)];
+        }
+
+        constexpr auto Merge(const Log2Histogram& other) noexcept -> void {
+            for (std::size_t bucket{ 0U }; bucket < BUCKET_COUNT; ++bucket) {
+                counts[bucket] += other.counts[bucket];
+            }
+        }
+
+        [[nodiscard]] constexpr auto GetCount() const noexcept -> std::uint64_t {
+            std::uint64_t count{ 0U };
+            for (const std::uint64_t bucket_count : counts) {
+                count += bucket_count;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Upper bound of the bucket holding the `quantile` (0 to 1), zero when empty.
+         */
+        [[nodiscard]] constexpr auto GetQuantile(const double quantile) const noexcept -> std::uint64_t {
+            const std::uint64_t count{ GetCount() };
+            if (count == 0U) {
+                return 0U;
+            }
+
+            // The smallest bucket at which the running count reaches the quantile
+            const std::uint64_t rank{ std::max<std::uint64_t>(static_cast<std::uint64_t>(quantile * static_cast<double>(count) + 0.5), 1U) };
+            std::uint64_t seen{ 0U };
+            std::size_t bucket{ 0U };
+            for (; bucket < BUCKET_COUNT - 1U; ++bucket) {
+                seen += counts[bucket];
+                if (seen >= rank) {
+                    break;
+                }
+            }
+            return std::uint64_t{ 1U } << (bucket + 1U);
+        }
+    };
+}
\ No newline at end of file
@@ -1,48 +1,112 @@
 #pragma once
-#include <array>
+#include <algorithm>
 #include <bit>
-#include <bitset>
+#include <concepts>
+#include <cstddef>
 #include <memory>
 #include <new>
-#include <vector>
+#include <type_traits>
+#include <utility>
+#include <libassert/assert.hpp>
 
 namespace Synapse {
     namespace STL {
-        // This is not thread safe, if you use it in multithreaded context you need to manage locking
-        template <class TType, std::size_t TCount>
-        class ObjectPool {
+        /**
+         * @brief Intrusive free list over an array of uninitialised object slots, shared by the object pools.
+         *
+         * Slots are handed out in address order until the array has been used once, after that
+         * from the list of returned slots. A returned slot stores the link to the next free
+         * slot in its own bytes, so the pool needs no side array and touches a slot only when
+         * it is first used.
+         */
+        template <class TType>
+        class ObjectPoolSlots {
         public:
-            template <class... Args>
-            explicit ObjectPool(Args&&... args) noexcept
-                : m_last_free_block_index(TCount - 1), m_free_index_queue{}, m_pool{}, m_status{} {
-                m_pool.fill(TType{ std::forward<Args>(args)... });
-                m_status.reset();
-                for (std::size_t i = 0; i < TCount; ++i) {
-                    m_free_index_queue[i] = i;
+            static constexpr std::size_t SLOT_SIZE{ std::max(sizeof(TType), sizeof(std::byte *)) };
+            static constexpr std::size_t SLOT_ALIGNMENT{ std::max(alignof(TType), alignof(std::byte *)) };
+            static constexpr std::size_t SLOT_STRIDE{ ((SLOT_SIZE + SLOT_ALIGNMENT - 1U) / SLOT_ALIGNMENT) * SLOT_ALIGNMENT };
+
+            ObjectPoolSlots() noexcept = default;
+            ObjectPoolSlots(std::byte *slots, const std::size_t capacity) noexcept : m_slots(slots), m_capacity(capacity) {}
+
+            [[nodiscard]] auto Acquire() noexcept -> std::byte * {
+                if (m_free_head != nullptr) {
+                    std::byte *slot{ m_free_head };
+                    (void)std::copy_n(slot, sizeof(std::byte *), std::bit_cast<std::byte *>(&m_free_head));
+                    ++m_live_count;
+                    return slot;
                 }
+                if (m_next_unused == m_capacity) {
+                    return nullptr;
+                }
+                ++m_live_count;
+                return m_slots + (SLOT_STRIDE * m_next_unused++);
             }
 
-            template <class Iterator>
-            ObjectPool(Iterator begin, Iterator end) noexcept
-                : m_last_free_block_index(TCount - 1), m_free_index_queue{}, m_pool{}, m_status{} {
-                static_assert(TCount == std::distance(begin, end));
-
-                std::move(begin, end, m_pool.begin());
-                m_status.reset();
-                for (std::size_t i = 0; i < TCount; ++i) {
-                    m_free_index_queue[i] = i;
+            /**
+             * @brief Constructs an object in a free slot, the slot is handed back if the constructor throws.
+             */
+            template <class... TArgs>
+            auto Construct(TArgs&&... args) noexcept(std::is_nothrow_constructible_v<TType, TArgs...>) -> TType * {
+                std::byte *slot{ Acquire() };
+                if (slot == nullptr) {
+                    return nullptr;
+                }
+                if constexpr (std::is_nothrow_constructible_v<TType, TArgs...>) {
+                    return std::construct_at(std::bit_cast<TType *>(slot), std::forward<TArgs>(args)...);
+                } else {
+                    try {
+                        return std::construct_at(std::bit_cast<TType *>(slot), std::forward<TArgs>(args)...);
+                    } catch (...) {
+                        Release(slot);
+                        throw;
+                    }
                 }
             }
 
-            ObjectPool(std::initializer_list<TType> init) noexcept
-                : m_last_free_block_index(TCount - 1), m_free_index_queue{}, m_pool{}, m_status{} {
-                static_assert(TCount == init.size());
+            auto Release(std::byte *slot) noexcept -> void {
+                DEBUG_ASSERT(Owns(slot), "Object was not allocated by the pool");
+                (void)std::copy_n(std::bit_cast<const std::byte *>(&m_free_head), sizeof(std::byte *), slot);
+                m_free_head = slot;
+                --m_live_count;
+            }
 
-                (void)std::copy_n(init.begin(), init.end(), m_pool.begin());
-                m_status.reset();
-                for (std::size_t i = 0; i < TCount; ++i) {
-                    m_free_index_queue[i] = i;
-                }
+            [[nodiscard]] auto Owns(const std::byte *slot) const noexcept -> bool {
+                return (slot >= m_slots) && (slot < (m_slots + (SLOT_STRIDE * m_next_unused))) &&
+                        ((static_cast<std::size_t>(slot - m_slots) % SLOT_STRIDE) == 0U);
+            }
+
+            [[nodiscard]] auto GetLiveCount() const noexcept -> std::size_t { return m_live_count; }
+            [[nodiscard]] auto GetCapacity() const noexcept -> std::size_t { return m_capacity; }
+            [[nodiscard]] auto GetStorage() const noexcept -> std::byte * { return m_slots; }
+
+        private:
+            std::byte *m_slots{ nullptr };
+            std::size_t m_capacity{ 0U };
+            std::size_t m_next_unused{ 0U };
+            std::size_t m_live_count{ 0U };
+            std::byte *m_free_head{ nullptr };
+        };
+
+        // This is not thread safe, if you use it in multithreaded context you need to manage locking
+        /**
+         * @brief Fixed capacity pool constructing objects in place on `Pop` and destroying them on `Push`.
+         *
+         * Storage is raw and uninitialised, so creating the pool constructs nothing and the
+         * slots are only touched when first used. Every object popped has to be pushed back
+         * before the pool is destroyed.
+         *
+         * @tparam TType  Pooled object type.
+         * @tparam TCount Number of objects the pool holds.
+         */
+        template <class TType, std::size_t TCount>
+        class ObjectPool {
+            using Slots = ObjectPoolSlots<TType>;
+
+        public:
+            ObjectPool() noexcept : m_slots(m_storage, TCount) {}
+            ~ObjectPool() noexcept {
+                DEBUG_ASSERT(m_slots.GetLiveCount() == 0U, "Objects were not returned to the pool", m_slots.GetLiveCount());
             }
 
             ObjectPool(const ObjectPool& other) = delete;
@@ -50,69 +114,109 @@ namespace Synapse {
             auto operator=(const ObjectPool &other) -> ObjectPool & = delete;
             auto operator=(ObjectPool &&other) -> ObjectPool & = delete;
 
-            auto Pop() noexcept -> TType * {
-                if (m_last_free_block_index == std::numeric_limits<std::size_t>::max()) {
-                    return nullptr;
-                }
-
-                std::size_t index = m_free_index_queue[m_last_free_block_index];
-                DEBUG_ASSERT(!m_status[index]);
-                m_status.set(index);
-                --m_last_free_block_index;
-                return &m_pool[index];
+            /**
+             * @brief Constructs an object in a free slot.
+             * @return Pointer to the object, `nullptr` if the pool is exhausted.
+             */
+            template <class... TArgs>
+            auto Pop(TArgs&&... args) noexcept(std::is_nothrow_constructible_v<TType, TArgs...>) -> TType * {
+                return m_slots.Construct(std::forward<TArgs>(args)...);
             }
 
+            /**
+             * @brief Destroys an object and returns its slot to the pool.
+             */
             auto Push(TType *object) noexcept -> void {
                 DEBUG_ASSERT(nullptr != object);
-                DEBUG_ASSERT(!std::less<TType*>{}(object, m_pool.data()));
-                DEBUG_ASSERT(!std::greater<TType*>{}(object, m_pool.data() + m_pool.size()));
-                DEBUG_ASSERT(((std::bit_cast<std::byte*>(object) - std::bit_cast<std::byte*>(m_pool.data())) % sizeof(object)) == 0);
-                std::size_t index = object - m_pool.data();
-                if (m_status[index]) {
-                    m_status.reset(index);
-                    m_free_index_queue[++m_last_free_block_index] = index;
-                }
+                std::destroy_at(object);
+                m_slots.Release(std::bit_cast<std::byte *>(object));
             }
 
             auto GetNumberOfAvailableObjects() const noexcept -> std::size_t {
-                return m_last_free_block_index + 1;
+                return TCount - m_slots.GetLiveCount();
             }
 
         private:
-            std::size_t m_last_free_block_index;
-            alignas(std::hardware_destructive_interference_size) std::array<std::size_t, TCount> m_free_index_queue;
-            alignas(std::hardware_destructive_interference_size) std::array<TType, TCount> m_pool;
-            alignas(std::hardware_destructive_interference_size) std::bitset<TCount> m_status;
+            alignas(Slots::SLOT_ALIGNMENT) std::byte m_storage[Slots::SLOT_STRIDE * TCount];
+            Slots m_slots;
+        };
+
+        /**
+         * @brief Arena a runtime sized object pool takes its storage from, e.g. a `Memory::Arena::MemoryArena`.
+         */
+        template <typename TArena>
+        concept ObjectPoolArena = requires(TArena& arena, std::byte* ptr, const std::size_t size, const std::size_t alignment) {
+            { arena.Allocate(size, alignment) } -> std::same_as<std::byte*>;
+            arena.Deallocate(ptr, size, alignment);
         };
     }
     namespace Runtime {
-        /// \todo add allocator, make it work with the allocators
-        template <class T>
+        // This is not thread safe, if you use it in multithreaded context you need to manage locking
+        /**
+         * @brief Object pool whose capacity is chosen at runtime, the storage is one block from an arena.
+         *
+         * Behaves like `STL::ObjectPool`: objects are constructed on `Pop` and destroyed on
+         * `Push`, and the slots are only touched when first used. The block is returned with
+         * the sized `Deallocate`.
+         *
+         * @tparam TType  Pooled object type.
+         * @tparam TArena Arena providing the storage, must outlive the pool.
+         */
+        template <class TType, STL::ObjectPoolArena TArena>
         class ObjectPool {
+            using Slots = STL::ObjectPoolSlots<TType>;
+
         public:
-            ObjectPool(int size = 100) {
-                // m_pool.resize(size);
+            ObjectPool() = delete;
+            /**
+             * @param arena    Arena providing the storage.
+             * @param capacity Number of objects the pool holds, the pool is empty if the arena cannot provide the storage.
+             */
+            ObjectPool(TArena &arena, const std::size_t capacity) noexcept : m_arena(arena) {
+                std::byte *block{ (capacity == 0U) ? nullptr : m_arena.Allocate(Slots::SLOT_STRIDE * capacity, Slots::SLOT_ALIGNMENT) };
+                if (block != nullptr) {
+                    m_slots = Slots{ block, capacity };
+                }
             }
-
-            auto IsEmpty() const -> bool {
-                // return m_pool.empty();
+            ~ObjectPool() noexcept {
+                DEBUG_ASSERT(m_slots.GetLiveCount() == 0U, "Objects were not returned to the pool", m_slots.GetLiveCount());
+                if (m_slots.GetCapacity() > 0U) {
+                    m_arena.Deallocate(m_slots.GetStorage(), Slots::SLOT_STRIDE * m_slots.GetCapacity(), Slots::SLOT_ALIGNMENT);
+                }
             }
 
-            auto GetSize() const -> std::size_t {
-                // return m_pool.size();
-            }
+            ObjectPool(const ObjectPool& other) = delete;
+            ObjectPool(ObjectPool&& other) = delete;
+            auto operator=(const ObjectPool &other) -> ObjectPool & = delete;
+            auto operator=(ObjectPool &&other) -> ObjectPool & = delete;
 
-            auto Resize(std::size_t size) -> void {
-                // m_pool.resize(size);
+            /**
+             * @brief Constructs an object in a free slot.
+             * @return Pointer to the object, `nullptr` if the pool is exhausted.
+             */
+            template <class... TArgs>
+            auto Pop(TArgs&&... args) noexcept(std::is_nothrow_constructible_v<TType, TArgs...>) -> TType * {
+                return m_slots.Construct(std::forward<TArgs>(args)...);
             }
 
-            auto Clear() -> void {
-                // m_pool.clear();
+            /**
+             * @brief Destroys an object and returns its slot to the pool.
+             */
+            auto Push(TType *object) noexcept -> void {
+                DEBUG_ASSERT(nullptr != object);
+                std::destroy_at(object);
+                m_slots.Release(std::bit_cast<std::byte *>(object));
             }
 
-            auto Set(std::size_t index, T object) -> void {
-                // m_pool[index] = object;
+            [[nodiscard]] auto GetNumberOfAvailableObjects() const noexcept -> std::size_t {
+                return m_slots.GetCapacity() - m_slots.GetLiveCount();
             }
+            [[nodiscard]] auto GetCapacity() const noexcept -> std::size_t { return m_slots.GetCapacity(); }
+            [[nodiscard]] auto IsEmpty() const noexcept -> bool { return m_slots.GetLiveCount() == 0U; }
+
+        private:
+            TArena &m_arena;
+            Slots m_slots{};
         };
     }
-}
\ No newline at end of file
+}
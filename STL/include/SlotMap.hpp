@@ -0,0 +1,269 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <libassert/assert.hpp>
+
+namespace Synapse::STL {
+    /**
+     * @brief Stable reference to an object in a `SlotMap`.
+     *
+     * The index selects the slot, the generation tells whether the object the handle was
+     * issued for is still in it. Generation 0 is never issued, a default constructed handle
+     * is the null handle.
+     */
+    struct SlotHandle {
+        std::uint32_t index{ 0U };
+        std::uint32_t generation{ 0U };
+
+        [[nodiscard]] constexpr auto IsNull() const noexcept -> bool { return generation == 0U; }
+
+        /**
+         * @brief Packs the handle into 64 bits, e.g. to store it in an atomic or send it as an id.
+         */
+        [[nodiscard]] constexpr auto Pack() const noexcept -> std::uint64_t {
+            return (static_cast<std::uint64_t>(generation) << 32U) | index;
+        }
+        [[nodiscard]] static constexpr auto Unpack(const std::uint64_t packed) noexcept -> SlotHandle {
+            return SlotHandle{ .index = static_cast<std::uint32_t>(packed), .generation = static_cast<std::uint32_t>(packed >> 32U) };
+        }
+
+        constexpr auto operator==(const SlotHandle &other) const noexcept -> bool = default;
+    };
+
+    /**
+     * @brief Arena the slot map takes its storage from, e.g. a `Memory::Arena::MemoryArena`.
+     */
+    template <typename TArena>
+    concept SlotMapArena = requires(TArena& arena, std::byte* ptr, const std::size_t size, const std::size_t alignment) {
+        { arena.Allocate(size, alignment) } -> std::same_as<std::byte*>;
+        arena.Deallocate(ptr, size, alignment);
+    };
+
+    /**
+     * @brief Container handing out generational handles to densely stored objects.
+     *
+     * Objects live in one contiguous array, so iterating them is a linear walk. A slot array
+     * maps handle indices to positions in that array, insertion and erasure are O(1): erasing
+     * moves the last object into the hole. Erasing bumps the generation of the slot, so a
+     * stale handle is detected by one compare instead of keeping the object alive with a
+     * reference count.
+     *
+     * Storage is a single block taken from `TArena` and grown by doubling. The block is
+     * returned with the sized `Deallocate`, so the arena's allocator needs no size header.
+     * Pointers to objects are invalidated by erasure and growth, handles are not.
+     *
+     * Not synchronised, the owner locks around it when several threads use the map. Objects that
+     * are handed between threads, like jobs and job queues, keep their pool and `shared_ptr`.
+     *
+     * @tparam TType  Stored object type, moving it must not throw.
+     * @tparam TArena Arena providing the storage.
+     */
+    template <typename TType, SlotMapArena TArena>
+    class SlotMap {
+        static_assert(std::is_nothrow_move_constructible_v<TType>, "SlotMap moves objects on erase and growth");
+
+        struct Slot {
+            std::uint32_t generation;
+            std::uint32_t link;  ///< Position in the dense array when live, next free slot otherwise.
+        };
+
+        static constexpr std::uint32_t NO_SLOT{ std::numeric_limits<std::uint32_t>::max() };
+        static constexpr std::size_t MAX_CAPACITY{ NO_SLOT };
+
+    public:
+        SlotMap() = delete;
+        /**
+         * @param arena            Arena providing the storage, must outlive the slot map.
+         * @param initial_capacity Number of objects the slot map holds before it first grows.
+         */
+        explicit SlotMap(TArena &arena, const std::uint32_t initial_capacity = 64U) noexcept : m_arena(arena) {
+            (void)Grow(std::max<std::uint32_t>(initial_capacity, 1U));
+        }
+        ~SlotMap() noexcept {
+            Clear();
+            Release();
+        }
+
+        SlotMap(const SlotMap&) = delete;
+        SlotMap(SlotMap&&) = delete;
+        auto operator=(const SlotMap &) -> SlotMap & = delete;
+        auto operator=(SlotMap &&) -> SlotMap & = delete;
+        auto operator==(const SlotMap &other) const -> bool = delete;
+
+        /**
+         * @brief Constructs an object in place.
+         * @return Handle to the object, the null handle if the storage could not grow.
+         */
+        template <typename... TArgs>
+        auto Emplace(TArgs&&... args) noexcept(std::is_nothrow_constructible_v<TType, TArgs...>) -> SlotHandle {
+            if ((m_size == m_capacity) && !Grow(std::max<std::size_t>(static_cast<std::size_t>(m_capacity) * 2U, 1U))) {
+                return SlotHandle{};
+            }
+            // Construct first, a throwing constructor leaves the map untouched
+            (void)std::construct_at(m_values + m_size, std::forward<TArgs>(args)...);
+
+            const std::uint32_t index{ m_free_head };
+            Slot &slot{ m_slots[index] };
+            m_free_head = slot.link;
+            slot.link = m_size;
+            m_dense_to_slot[m_size] = index;
+            ++m_size;
+            return SlotHandle{ .index = index, .generation = slot.generation };
+        }
+
+        /**
+         * @brief Destroys the object of a handle, later lookups with the handle fail.
+         * @return `false` if the handle is stale or null.
+         */
+        auto Erase(const SlotHandle handle) noexcept -> bool {
+            if (!Contains(handle)) {
+                return false;
+            }
+            Slot &slot{ m_slots[handle.index] };
+            const std::uint32_t position{ slot.link };
+            const std::uint32_t last{ m_size - 1U };
+
+            std::destroy_at(m_values + position);
+            if (position != last) {
+                (void)std::construct_at(m_values + position, std::move(m_values[last]));
+                std::destroy_at(m_values + last);
+                m_dense_to_slot[position] = m_dense_to_slot[last];
+                m_slots[m_dense_to_slot[position]].link = position;
+            }
+            --m_size;
+
+            RetireSlot(handle.index);
+            return true;
+        }
+
+        /**
+         * @brief Checks whether a handle still refers to a live object.
+         *
+         * A free slot keeps its generation, so a handle that was never issued for it, e.g. one
+         * unpacked from an untrusted id, can match. The slot must also be the owner of the
+         * position it links to.
+         */
+        [[nodiscard]] auto Contains(const SlotHandle handle) const noexcept -> bool {
+            if ((handle.index >= m_capacity) || handle.IsNull()) {
+                return false;
+            }
+            const Slot &slot{ m_slots[handle.index] };
+            return (slot.generation == handle.generation) && (slot.link < m_size) && (m_dense_to_slot[slot.link] == handle.index);
+        }
+
+        /**
+         * @brief Looks up the object of a handle.
+         * @return Pointer to the object, `nullptr` if the handle is stale or null.
+         */
+        [[nodiscard]] auto Get(const SlotHandle handle) noexcept -> TType * {
+            return Contains(handle) ? (m_values + m_slots[handle.index].link) : nullptr;
+        }
+        [[nodiscard]] auto Get(const SlotHandle handle) const noexcept -> const TType * {
+            return Contains(handle) ? (m_values + m_slots[handle.index].link) : nullptr;
+        }
+
+        /**
+         * @brief Handle of the object at a position of the dense array, e.g. while iterating.
+         */
+        [[nodiscard]] auto GetHandleAt(const std::size_t position) const noexcept -> SlotHandle {
+            DEBUG_ASSERT(position < m_size, "Position is out of range", position, m_size);
+            const std::uint32_t index{ m_dense_to_slot[position] };
+            return SlotHandle{ .index = index, .generation = m_slots[index].generation };
+        }
+
+        /**
+         * @brief Destroys every object, all handles issued so far become stale.
+         */
+        auto Clear() noexcept -> void {
+            for (std::uint32_t position = m_size; position > 0U; --position) {
+                std::destroy_at(m_values + (position - 1U));
+                RetireSlot(m_dense_to_slot[position - 1U]);
+            }
+            m_size = 0U;
+        }
+
+        [[nodiscard]] auto begin() noexcept -> TType * { return m_values; }
+        [[nodiscard]] auto end() noexcept -> TType * { return m_values + m_size; }
+        [[nodiscard]] auto begin() const noexcept -> const TType * { return m_values; }
+        [[nodiscard]] auto end() const noexcept -> const TType * { return m_values + m_size; }
+
+        [[nodiscard]] auto GetSize() const noexcept -> std::size_t { return m_size; }
+        [[nodiscard]] auto GetCapacity() const noexcept -> std::size_t { return m_capacity; }
+        [[nodiscard]] auto IsEmpty() const noexcept -> bool { return m_size == 0U; }
+
+    private:
+        // Values first, the slot and back-reference arrays after them in the same block
+        [[nodiscard]] static constexpr auto GetSlotsOffset(const std::size_t capacity) noexcept -> std::size_t {
+            return (((capacity * sizeof(TType)) + alignof(Slot) - 1U) / alignof(Slot)) * alignof(Slot);
+        }
+        [[nodiscard]] static constexpr auto GetBlockSize(const std::size_t capacity) noexcept -> std::size_t {
+            return GetSlotsOffset(capacity) + (capacity * sizeof(Slot)) + (capacity * sizeof(std::uint32_t));
+        }
+        static constexpr std::size_t BLOCK_ALIGNMENT{ std::max(alignof(TType), alignof(Slot)) };
+
+        auto Grow(const std::size_t new_capacity) noexcept -> bool {
+            if ((new_capacity > MAX_CAPACITY) || (new_capacity <= m_capacity)) {
+                return false;
+            }
+            std::byte *block{ m_arena.Allocate(GetBlockSize(new_capacity), BLOCK_ALIGNMENT) };
+            if (block == nullptr) {
+                return false;
+            }
+            auto *values{ std::bit_cast<TType *>(block) };
+            auto *slots{ std::bit_cast<Slot *>(block + GetSlotsOffset(new_capacity)) };
+            auto *dense_to_slot{ std::bit_cast<std::uint32_t *>(block + GetSlotsOffset(new_capacity) + (new_capacity * sizeof(Slot))) };
+
+            for (std::uint32_t position = 0U; position < m_size; ++position) {
+                (void)std::construct_at(values + position, std::move(m_values[position]));
+                std::destroy_at(m_values + position);
+            }
+            (void)std::copy_n(m_slots, m_capacity, slots);
+            (void)std::copy_n(m_dense_to_slot, m_size, dense_to_slot);
+
+            // Chain the new slots in front of the free list, the lowest index is handed out first
+            for (std::size_t index = new_capacity; index > m_capacity; --index) {
+                slots[index - 1U] = Slot{ .generation = 1U, .link = m_free_head };
+                m_free_head = static_cast<std::uint32_t>(index - 1U);
+            }
+
+            Release();
+            m_block = block;
+            m_values = values;
+            m_slots = slots;
+            m_dense_to_slot = dense_to_slot;
+            m_capacity = static_cast<std::uint32_t>(new_capacity);
+            return true;
+        }
+
+        auto Release() noexcept -> void {
+            if (m_block != nullptr) {
+                m_arena.Deallocate(m_block, GetBlockSize(m_capacity), BLOCK_ALIGNMENT);
+                m_block = nullptr;
+            }
+        }
+
+        auto RetireSlot(const std::uint32_t index) noexcept -> void {
+            Slot &slot{ m_slots[index] };
+            // Skip 0 on wrap around, it marks the null handle
+            slot.generation = (slot.generation == std::numeric_limits<std::uint32_t>::max()) ? 1U : (slot.generation + 1U);
+            slot.link = m_free_head;
+            m_free_head = index;
+        }
+
+        TArena &m_arena;
+        std::byte *m_block{ nullptr };
+        TType *m_values{ nullptr };
+        Slot *m_slots{ nullptr };
+        std::uint32_t *m_dense_to_slot{ nullptr };
+        std::uint32_t m_size{ 0U };
+        std::uint32_t m_capacity{ 0U };
+        std::uint32_t m_free_head{ NO_SLOT };
+    };
+}
@@ -0,0 +1,194 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace Synapse::STL {
+    // This is not thread safe, if you use it in multithreaded context you need to manage locking
+    /**
+     * @brief Hierarchical timing wheel, O(1) insertion and expiry of items due at integer ticks.
+     *
+     * Four wheels of 64 slots each cover 64, 64^2, 64^3 and 64^4 ticks ahead of the current
+     * tick, items further out wait in an overflow list. An item goes into the coarsest wheel
+     * it needs. When a finer wheel wraps around, the matching slot of the next coarser wheel
+     * is cascaded down, so every item is moved at most once per level before it expires.
+     * Advancing walks the ticks one by one, which is cheap for a wheel advanced regularly,
+     * e.g. every millisecond tick of a server.
+     *
+     * Items in one slot expire in insertion order. There is no removal, callers that need to
+     * cancel mark the item and skip it when it expires.
+     *
+     * @tparam TItem Payload of a timer, e.g. an index into a table of timers.
+     */
+    template <typename TItem>
+        requires std::is_trivially_copyable_v<TItem>
+    class TimingWheel {
+    public:
+        static constexpr std::uint32_t SLOT_BITS{ 6U };
+        static constexpr std::uint32_t SLOT_COUNT{ 1U << SLOT_BITS };
+        static constexpr std::uint32_t LEVEL_COUNT{ 4U };
+
+        /**
+         * @param current_tick Tick the wheel starts at, items due at or before it expire on the first advance.
+         */
+        explicit TimingWheel(const std::uint64_t current_tick = 0U) noexcept : m_current_tick(current_tick) {}
+        ~TimingWheel() = default;
+
+        TimingWheel(const TimingWheel&) = delete;
+        TimingWheel(TimingWheel&&) = delete;
+        auto operator=(const TimingWheel &) -> TimingWheel & = delete;
+        auto operator=(TimingWheel &&) -> TimingWheel & = delete;
+        auto operator==(const TimingWheel &other) const -> bool = delete;
+
+        /**
+         * @brief Schedules an item, an item due in the past expires on the next advance.
+         */
+        auto Insert(const std::uint64_t due_tick, const TItem item) -> void {
+            const std::uint32_t node{ AcquireNode() };
+            m_nodes[node].item = item;
+            m_nodes[node].due_tick = due_tick;
+            Place(node, m_current_tick + 1U);
+            ++m_count;
+        }
+
+        /**
+         * @brief Moves the wheel to `tick`, calling `expire(item)` for every item due at or before it.
+         *
+         * `expire` may insert new items, items due before `tick` expire within the same call.
+         */
+        template <typename TExpire>
+        auto Advance(const std::uint64_t tick, TExpire &&expire) -> void {
+            while (m_current_tick < tick) {
+                ++m_current_tick;
+                const auto slot{ static_cast<std::uint32_t>(m_current_tick & (SLOT_COUNT - 1U)) };
+                if (slot == 0U) {
+                    Cascade();
+                }
+                // Detach first, expire may insert into this slot
+                List due{ m_levels[0][slot] };
+                m_levels[0][slot] = List{};
+                while (due.head != NO_NODE) {
+                    const std::uint32_t node{ due.head };
+                    due.head = m_nodes[node].next;
+                    const TItem item{ m_nodes[node].item };
+                    ReleaseNode(node);
+                    --m_count;
+                    expire(item);
+                }
+            }
+        }
+
+        /**
+         * @brief Removes every item, calling `discard(item)` for each.
+         */
+        template <typename TDiscard>
+        auto Clear(TDiscard &&discard) -> void {
+            const auto drain = [&](List &list) {
+                for (std::uint32_t node = list.head; node != NO_NODE; node = m_nodes[node].next) {
+                    discard(m_nodes[node].item);
+                }
+                list = List{};
+            };
+            for (auto &level : m_levels) {
+                for (List &list : level) {
+                    drain(list);
+                }
+            }
+            drain(m_overflow);
+            m_nodes.clear();
+            m_free_node = NO_NODE;
+            m_count = 0U;
+        }
+
+        [[nodiscard]] auto GetCurrentTick() const noexcept -> std::uint64_t { return m_current_tick; }
+        [[nodiscard]] auto GetCount() const noexcept -> std::size_t { return m_count; }
+
+    private:
+        static constexpr std::uint32_t NO_NODE{ 0xFFFFFFFFU };
+
+        struct Node {
+            TItem item;
+            std::uint64_t due_tick;
+            std::uint32_t next;
+        };
+
+        struct List {
+            std::uint32_t head{ NO_NODE };
+            std::uint32_t tail{ NO_NODE };
+        };
+
+        // Items due before `earliest_tick` go into its slot
+        auto Place(const std::uint32_t node, const std::uint64_t earliest_tick) -> void {
+            const std::uint64_t due_tick{ m_nodes[node].due_tick };
+            if (due_tick <= earliest_tick) {
+                Append(m_levels[0][earliest_tick & (SLOT_COUNT - 1U)], node);
+                return;
+            }
+            const std::uint64_t delta{ due_tick - m_current_tick };
+            for (std::uint32_t level = 0U; level < LEVEL_COUNT; ++level) {
+                if (delta < (std::uint64_t{ 1U } << (SLOT_BITS * (level + 1U)))) {
+                    Append(m_levels[level][(due_tick >> (SLOT_BITS * level)) & (SLOT_COUNT - 1U)], node);
+                    return;
+                }
+            }
+            Append(m_overflow, node);
+        }
+
+        // Called when the finest wheel wraps, re-places the slots of the coarser wheels that are now current
+        auto Cascade() -> void {
+            for (std::uint32_t level = 1U; level < LEVEL_COUNT; ++level) {
+                const auto slot{ static_cast<std::uint32_t>((m_current_tick >> (SLOT_BITS * level)) & (SLOT_COUNT - 1U)) };
+                Replace(m_levels[level][slot]);
+                if (slot != 0U) {
+                    return;
+                }
+            }
+            Replace(m_overflow);
+        }
+
+        auto Replace(List &list) -> void {
+            List moved{ list };
+            list = List{};
+            while (moved.head != NO_NODE) {
+                const std::uint32_t node{ moved.head };
+                moved.head = m_nodes[node].next;
+                // The current slot has not expired yet, items due now still make it
+                Place(node, m_current_tick);
+            }
+        }
+
+        auto Append(List &list, const std::uint32_t node) noexcept -> void {
+            m_nodes[node].next = NO_NODE;
+            if (list.tail == NO_NODE) {
+                list.head = node;
+            } else {
+                m_nodes[list.tail].next = node;
+            }
+            list.tail = node;
+        }
+
+        auto AcquireNode() -> std::uint32_t {
+            if (m_free_node != NO_NODE) {
+                const std::uint32_t node{ m_free_node };
+                m_free_node = m_nodes[node].next;
+                return node;
+            }
+            m_nodes.push_back(Node{});
+            return static_cast<std::uint32_t>(m_nodes.size() - 1U);
+        }
+
+        auto ReleaseNode(const std::uint32_t node) noexcept -> void {
+            m_nodes[node].next = m_free_node;
+            m_free_node = node;
+        }
+
+        std::array<std::array<List, SLOT_COUNT>, LEVEL_COUNT> m_levels{};
+        List m_overflow{};
+        std::vector<Node> m_nodes{};
+        std::uint32_t m_free_node{ NO_NODE };
+        std::uint64_t m_current_tick;
+        std::size_t m_count{ 0U };
+    };
+}
@@ -0,0 +1 @@
+#include <Concurrent/AdaptiveSharedMutex.hpp>
\ No newline at end of file
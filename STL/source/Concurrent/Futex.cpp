@@ -0,0 +1 @@
+#include <Concurrent/Futex.hpp>
\ No newline at end of file
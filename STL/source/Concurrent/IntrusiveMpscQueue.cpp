@@ -0,0 +1 @@
+#include <Concurrent/IntrusiveMpscQueue.hpp>
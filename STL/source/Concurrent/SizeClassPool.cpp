@@ -0,0 +1 @@
+#include "Concurrent/SizeClassPool.hpp"
\ No newline at end of file
@@ -0,0 +1 @@
+#include <Concurrent/ThreadCachedPool.hpp>
@@ -0,0 +1 @@
+#include <Concurrent/WorkStealingDeque.hpp>
@@ -0,0 +1 @@
+#include <Concurrent/WorkStealingScheduler.hpp>
@@ -0,0 +1 @@
+#include <InplaceFunction.hpp>
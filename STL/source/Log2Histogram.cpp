@@ -0,0 +1 @@
+#include <Log2Histogram.hpp>
\ No newline at end of file
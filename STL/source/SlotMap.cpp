@@ -0,0 +1 @@
+#include <SlotMap.hpp>
\ No newline at end of file
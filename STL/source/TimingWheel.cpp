@@ -0,0 +1 @@
+#include <TimingWheel.hpp>
@@ -0,0 +1,150 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <Area/HeapArea.hpp>
+#include <Arena/AllocationRecorder.hpp>
+#include <Arena/AllocationTrace.hpp>
+#include <Arena/RecordingArena.hpp>
+#include "MemoryTestUtility.hpp"
+
+using namespace Synapse::Memory;
+using namespace Synapse::Memory::Arena;
+using MemoryTest::EnsureLogger;
+using MemoryTest::FreeListArena;
+
+namespace {
+    // Removed again when the test ends
+    struct TraceFile {
+        explicit TraceFile(const std::string &name) : path(std::filesystem::temp_directory_path() / name) {}
+        ~TraceFile() {
+            std::error_code error{};
+            (void)std::filesystem::remove(path, error);
+        }
+
+        TraceFile(const TraceFile&) = delete;
+        TraceFile(TraceFile&&) = delete;
+        auto operator=(const TraceFile &) -> TraceFile & = delete;
+        auto operator=(TraceFile &&) -> TraceFile & = delete;
+
+        std::filesystem::path path;
+    };
+}
+
+TEST_CASE("AllocationRecorder writes the events of a recording arena and the trace reads them back", "[AllocationRecorder]") {
+    EnsureLogger();
+    const TraceFile file{ "SynapseRecorderTest.alat" };
+    Area::HeapArea area{ 4096U };
+    FreeListArena arena{ area };
+    AllocationRecorder recorder{};
+    REQUIRE_FALSE(recorder.Start());
+    REQUIRE(recorder.OpenFile(file.path));
+    REQUIRE(recorder.Start());
+    REQUIRE(recorder.IsRecording());
+
+    RecordingArena recording_arena{ arena, recorder };
+    std::byte *const first{ recording_arena.Allocate(64U, 8U) };
+    std::byte *const second{ recording_arena.Allocate(128U, 16U) };
+    recording_arena.Deallocate(first);
+    recording_arena.Deallocate(second, 128U, 16U);
+    recorder.Stop();
+    REQUIRE_FALSE(recorder.IsRecording());
+    REQUIRE(recorder.GetWrittenCount() == 4U);
+    REQUIRE(recorder.GetDroppedCount() == 0U);
+
+    // Stopped, the event is ignored before a ring is made for the thread
+    std::thread{ [&] { recorder.Record(AllocationEventType::Allocate, first, 8U, 8U, 0U); } }.join();
+    REQUIRE(recorder.GetRingCount() == 1U);
+
+    const std::optional<AllocationTrace> trace{ AllocationTrace::Load(file.path) };
+    REQUIRE(trace.has_value());
+    REQUIRE(trace->GetHeader().magic == ALLOCATION_TRACE_MAGIC);
+    REQUIRE(trace->GetEvents().size() == 4U);
+    const AllocationEvent &allocation{ trace->GetEvents()[1] };
+    REQUIRE(allocation.type == AllocationEventType::Allocate);
+    REQUIRE(allocation.pointer == std::bit_cast<std::uintptr_t>(second));
+    REQUIRE(allocation.size == 128U);
+    REQUIRE(allocation.alignment == 16U);
+    REQUIRE(trace->GetEvents()[2].type == AllocationEventType::Deallocate);
+
+    // The unsized free takes its size from the matching allocation
+    const AllocationReplay replay{ trace->BuildReplay() };
+    REQUIRE(replay.operations.size() == 4U);
+    REQUIRE(replay.slot_count == 2U);
+    REQUIRE(replay.peak_live_bytes == 192U);
+    REQUIRE(replay.unmatched_frees == 0U);
+    REQUIRE(replay.operations[2].slot == replay.operations[0].slot);
+    REQUIRE(replay.operations[2].size == 64U);
+}
+
+TEST_CASE("AllocationRecorder keeps one ring per thread while the thread alternates between recorders", "[AllocationRecorder]") {
+    EnsureLogger();
+    const TraceFile first_file{ "SynapseRecorderTestFirst.alat" };
+    const TraceFile second_file{ "SynapseRecorderTestSecond.alat" };
+    AllocationRecorder first{};
+    AllocationRecorder second{};
+    REQUIRE(first.OpenFile(first_file.path));
+    REQUIRE(second.OpenFile(second_file.path));
+    REQUIRE(first.Start());
+    REQUIRE(second.Start());
+
+    int block{ 0 };
+    for (std::uint32_t i = 0U; i < 100U; ++i) {
+        first.Record(AllocationEventType::Allocate, &block, 4U, 4U, i);
+        second.Record(AllocationEventType::Allocate, &block, 4U, 4U, i);
+    }
+    REQUIRE(first.GetRingCount() == 1U);
+    REQUIRE(second.GetRingCount() == 1U);
+
+    std::thread{ [&] { first.Record(AllocationEventType::Deallocate, &block, 4U, 4U, 0U); } }.join();
+    first.Stop();
+    second.Stop();
+    REQUIRE(first.GetWrittenCount() == 101U);
+    REQUIRE(second.GetWrittenCount() == 100U);
+    // The ring of the exited thread was freed once its event was written
+    REQUIRE(first.GetRingCount() == 1U);
+
+    // Events of both threads merged back into time order, the free of the other thread comes last
+    const std::optional<AllocationTrace> trace{ AllocationTrace::Load(first_file.path) };
+    REQUIRE(trace.has_value());
+    REQUIRE(trace->GetEvents().back().type == AllocationEventType::Deallocate);
+    REQUIRE(trace->GetEvents().back().thread != trace->GetEvents().front().thread);
+}
+
+TEST_CASE("AllocationRecorder frees the rings of exited threads while it runs", "[AllocationRecorder]") {
+    EnsureLogger();
+    constexpr std::uint32_t THREAD_COUNT{ 32U };
+    const TraceFile file{ "SynapseRecorderTestChurn.alat" };
+    AllocationRecorder recorder{ std::chrono::milliseconds(1) };
+    REQUIRE(recorder.OpenFile(file.path));
+    REQUIRE(recorder.Start());
+
+    int block{ 0 };
+    for (std::uint32_t i = 0U; i < THREAD_COUNT; ++i) {
+        std::thread{ [&] { recorder.Record(AllocationEventType::Allocate, &block, 4U, 4U, i); } }.join();
+    }
+    const std::chrono::steady_clock::time_point end{ std::chrono::steady_clock::now() + std::chrono::seconds(5) };
+    while ((recorder.GetRingCount() > 0U) && (std::chrono::steady_clock::now() < end)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(recorder.GetRingCount() == 0U);
+    recorder.Stop();
+    REQUIRE(recorder.GetWrittenCount() == THREAD_COUNT);
+}
+
+TEST_CASE("AllocationTrace rejects a file that is not a trace", "[AllocationTrace]") {
+    EnsureLogger();
+    const TraceFile file{ "SynapseRecorderTestInvalid.alat" };
+    {
+        std::ofstream stream{ file.path, std::ios::binary };
+        stream << "not an allocation trace";
+    }
+    REQUIRE_FALSE(AllocationTrace::Load(file.path).has_value());
+    REQUIRE_FALSE(AllocationTrace::Load(file.path.string() + ".missing").has_value());
+}
@@ -0,0 +1,81 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+#include <Area/HeapArea.hpp>
+#include <Arena/ArenaMemoryResource.hpp>
+#include "MemoryTestUtility.hpp"
+
+using namespace Synapse::Memory;
+using namespace Synapse::Memory::Arena;
+using MemoryTest::FreeListArena;
+
+namespace {
+    constexpr std::size_t AREA_SIZE{ 64U * 1024U };
+}
+
+TEST_CASE("ArenaMemoryResource backs the std::pmr containers and gets every block back", "[ArenaMemoryResource]") {
+    Area::HeapArea area{ AREA_SIZE };
+    FreeListArena arena{ area };
+    ArenaMemoryResource<FreeListArena> resource{ arena };
+    {
+        std::pmr::vector<std::pmr::string> names{ &resource };
+        std::pmr::map<std::uint32_t, std::pmr::string> sessions{ &resource };
+        for (std::uint32_t i = 0U; i < 100U; ++i) {
+            // Too long for the small string buffer
+            names.emplace_back("a session name that has to live on the heap");
+            sessions.emplace(i, names.back());
+        }
+        // The resource is handed down to the nested strings
+        REQUIRE(names.back().get_allocator().resource() == &resource);
+        REQUIRE(sessions.at(42U).get_allocator().resource() == &resource);
+        REQUIRE(sessions.at(42U) == names[42]);
+        REQUIRE(arena.GetStatistics().allocation_count > 200U);
+    }
+    // Freed through the sized path with the size and alignment of each block
+    REQUIRE(arena.GetStatistics().bytes_in_use == 0U);
+    REQUIRE(arena.GetStatistics().allocation_count == 0U);
+}
+
+TEST_CASE("ArenaMemoryResource compares equal to resources over the same arena", "[ArenaMemoryResource]") {
+    Area::HeapArea first_area{ AREA_SIZE };
+    Area::HeapArea second_area{ AREA_SIZE };
+    FreeListArena first{ first_area };
+    FreeListArena second{ second_area };
+    ArenaMemoryResource<FreeListArena> resource{ first };
+    ArenaMemoryResource<FreeListArena> same_arena{ first };
+    ArenaMemoryResource<FreeListArena> other_arena{ second };
+
+    REQUIRE(resource == same_arena);
+    REQUIRE(resource != other_arena);
+    REQUIRE_FALSE(resource.is_equal(*std::pmr::new_delete_resource()));
+
+    // Equal resources, so the move takes the buffer instead of copying into the target's arena
+    std::pmr::vector<int> source{ { 1, 2, 3 }, &resource };
+    const int *const data{ source.data() };
+    std::pmr::vector<int> target{ &same_arena };
+    target = std::move(source);
+    REQUIRE(target.data() == data);
+
+    // Unequal, the elements are copied into the other arena
+    std::pmr::vector<int> copied{ &other_arena };
+    copied = std::move(target);
+    REQUIRE(copied.data() != data);
+    REQUIRE(copied.get_allocator().resource() == &other_arena);
+    REQUIRE(second.GetStatistics().allocation_count == 1U);
+}
+
+TEST_CASE("ArenaMemoryResource throws when the arena is out of memory", "[ArenaMemoryResource]") {
+    Area::HeapArea area{ 1024U };
+    FreeListArena arena{ area };
+    ArenaMemoryResource<FreeListArena> resource{ arena };
+    std::pmr::vector<std::uint64_t> values{ &resource };
+    REQUIRE_THROWS_AS(values.reserve(1024U), std::bad_alloc);
+    REQUIRE(values.capacity() == 0U);
+    values.push_back(1U);
+    REQUIRE(arena.GetStatistics().allocation_count == 1U);
+}
@@ -0,0 +1,83 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <vector>
+#include <Area/HeapArea.hpp>
+#include <Arena/ArenaRegistry.hpp>
+#include <Arena/ArenaStatistics.hpp>
+#include "MemoryTestUtility.hpp"
+
+using namespace Synapse::Memory;
+using namespace Synapse::Memory::Arena;
+using MemoryTest::EnsureLogger;
+using MemoryTest::FreeListArena;
+
+namespace {
+    constexpr std::size_t AREA_SIZE{ 4096U };
+}
+
+TEST_CASE("MemoryArena statistics track the use, the high-water mark and failures", "[ArenaStatistics]") {
+    Area::HeapArea area{ AREA_SIZE };
+    FreeListArena arena{ area };
+    ArenaStatistics statistics{ arena.GetStatistics() };
+    REQUIRE(statistics.capacity == AREA_SIZE);
+    REQUIRE(statistics.bytes_in_use == 0U);
+    REQUIRE(statistics.free_bytes == AREA_SIZE);
+    REQUIRE(statistics.GetFragmentation() == 0.0);
+
+    std::vector<std::byte *> blocks;
+    for (std::size_t i = 0U; i < 4U; ++i) {
+        blocks.push_back(arena.Allocate(256U, 8U));
+    }
+    REQUIRE(arena.Allocate(AREA_SIZE, 8U) == nullptr);
+    statistics = arena.GetStatistics();
+    const std::size_t peak{ statistics.bytes_in_use };
+    REQUIRE(peak >= 4U * 256U);
+    REQUIRE(statistics.peak_bytes_in_use == peak);
+    REQUIRE(statistics.allocation_count == 4U);
+    REQUIRE(statistics.total_allocations == 4U);
+    REQUIRE(statistics.failed_allocations == 1U);
+    REQUIRE((statistics.bytes_in_use + statistics.free_bytes) == AREA_SIZE);
+
+    // Two holes in front of the tail, the peak stays
+    arena.Deallocate(blocks[0]);
+    arena.Deallocate(blocks[2]);
+    statistics = arena.GetStatistics();
+    REQUIRE(statistics.bytes_in_use < peak);
+    REQUIRE(statistics.peak_bytes_in_use == peak);
+    REQUIRE(statistics.allocation_count == 2U);
+    REQUIRE(statistics.total_allocations == 4U);
+    REQUIRE(statistics.free_block_count == 3U);
+    REQUIRE(statistics.largest_free_block < statistics.free_bytes);
+    REQUIRE(statistics.GetFragmentation() > 0.0);
+    REQUIRE(statistics.GetFragmentation() < 1.0);
+}
+
+TEST_CASE("ArenaRegistry collects the statistics of the arenas registered right now", "[ArenaRegistry]") {
+    EnsureLogger();
+    Area::HeapArea first_area{ AREA_SIZE };
+    Area::HeapArea second_area{ 2U * AREA_SIZE };
+    FreeListArena first{ first_area };
+    FreeListArena second{ second_area };
+    ArenaRegistry registry{};
+    registry.Register("First", first);
+    {
+        const ArenaRegistration registration{ registry, "Second", second };
+        // Fills the second arena past the pressure threshold
+        REQUIRE(second.Allocate((2U * AREA_SIZE) - 256U, 8U) != nullptr);
+        REQUIRE(registry.GetCount() == 2U);
+
+        const std::vector<NamedArenaStatistics> collected{ registry.Collect() };
+        REQUIRE(collected.size() == 2U);
+        REQUIRE(collected[0].name == "First");
+        REQUIRE(collected[0].statistics.capacity == AREA_SIZE);
+        REQUIRE(collected[1].name == "Second");
+        REQUIRE(collected[1].statistics.allocation_count == 1U);
+        REQUIRE(collected[1].statistics.bytes_in_use > static_cast<std::size_t>(ArenaRegistry::PRESSURE_THRESHOLD * (2U * AREA_SIZE)));
+        registry.LogStatistics();
+    }
+
+    // Unregistered with its registration
+    REQUIRE(registry.GetCount() == 1U);
+    registry.Unregister(&first);
+    REQUIRE(registry.Collect().empty());
+}
@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <Area/HeapArea.hpp>
+#include <Arena/CompactingArena.hpp>
+
+using namespace Synapse::Memory;
+using Arena::CompactingArena;
+using Arena::RelocatableHandle;
+
+namespace {
+    constexpr std::size_t BLOCK_SIZE{ 100U };
+
+    auto Fill(CompactingArena &arena, const RelocatableHandle handle, const std::uint8_t value) -> void {
+        std::byte *data{ arena.Resolve(handle) };
+        for (std::size_t i = 0U; i < arena.GetAllocationSize(handle); ++i) {
+            data[i] = static_cast<std::byte>(value + i);
+        }
+    }
+
+    auto Holds(const CompactingArena &arena, const RelocatableHandle handle, const std::uint8_t value) -> bool {
+        const std::byte *data{ arena.Resolve(handle) };
+        for (std::size_t i = 0U; i < arena.GetAllocationSize(handle); ++i) {
+            if (data[i] != static_cast<std::byte>(value + i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Every other block freed, the live ones keep their pattern
+    auto AllocateAndFreeEveryOther(CompactingArena &arena, const std::uint8_t count) -> std::vector<RelocatableHandle> {
+        std::vector<RelocatableHandle> live;
+        for (std::uint8_t i = 0U; i < count; ++i) {
+            const RelocatableHandle handle{ arena.Allocate(BLOCK_SIZE, alignof(std::max_align_t)) };
+            REQUIRE_FALSE(handle.IsNull());
+            Fill(arena, handle, i);
+            if ((i % 2U) == 0U) {
+                REQUIRE(arena.Free(handle));
+            } else {
+                live.push_back(handle);
+            }
+        }
+        return live;
+    }
+}
+
+TEST_CASE("CompactingArena packs the live blocks and keeps their handles valid", "[CompactingArena]") {
+    Area::HeapArea area{ 64U * 1024U };
+    CompactingArena arena{ area };
+    const std::vector<RelocatableHandle> live{ AllocateAndFreeEveryOther(arena, 16U) };
+    REQUIRE(arena.GetLiveCount() == 8U);
+    REQUIRE(arena.GetFragmentation() > 0.4);
+
+    std::vector<std::byte *> before;
+    for (const RelocatableHandle handle : live) {
+        before.push_back(arena.Resolve(handle));
+    }
+    REQUIRE(arena.CompactStep(area.GetSize()));
+
+    const Arena::CompactionStatistics statistics{ arena.GetStatistics() };
+    REQUIRE(statistics.used_bytes == statistics.live_bytes);
+    REQUIRE(statistics.moved_bytes == statistics.live_bytes);
+    REQUIRE(statistics.completed_passes == 1U);
+    REQUIRE(arena.GetFragmentation() == 0.0);
+    for (std::size_t i = 0U; i < live.size(); ++i) {
+        // Each block slid down by the freed block before it
+        REQUIRE(arena.Resolve(live[i]) < before[i]);
+        REQUIRE(arena.GetAllocationSize(live[i]) == BLOCK_SIZE);
+        REQUIRE(Holds(arena, live[i], static_cast<std::uint8_t>((2U * i) + 1U)));
+    }
+}
+
+TEST_CASE("CompactingArena compacts in steps and keeps the data readable between them", "[CompactingArena]") {
+    Area::HeapArea area{ 64U * 1024U };
+    CompactingArena arena{ area };
+    const std::vector<RelocatableHandle> live{ AllocateAndFreeEveryOther(arena, 32U) };
+
+    std::uint32_t steps{ 0U };
+    bool complete{ false };
+    while (!complete) {
+        // One block per step
+        complete = arena.CompactStep(1U);
+        ++steps;
+        for (std::size_t i = 0U; i < live.size(); ++i) {
+            REQUIRE(Holds(arena, live[i], static_cast<std::uint8_t>((2U * i) + 1U)));
+        }
+    }
+    REQUIRE(steps > 1U);
+    REQUIRE(arena.GetFragmentation() == 0.0);
+}
+
+TEST_CASE("CompactingArena leaves a pinned block in place and packs the blocks after it", "[CompactingArena]") {
+    Area::HeapArea area{ 64U * 1024U };
+    CompactingArena arena{ area };
+    const RelocatableHandle first{ arena.Allocate(BLOCK_SIZE, 16U) };
+    const RelocatableHandle pinned{ arena.Allocate(BLOCK_SIZE, 16U) };
+    const RelocatableHandle hole{ arena.Allocate(BLOCK_SIZE, 16U) };
+    const RelocatableHandle last{ arena.Allocate(BLOCK_SIZE, 16U) };
+    Fill(arena, last, 7U);
+    REQUIRE(arena.Free(first));
+    REQUIRE(arena.Free(hole));
+
+    std::byte *const pinned_address{ arena.Pin(pinned) };
+    REQUIRE(pinned_address != nullptr);
+    const std::ptrdiff_t last_offset{ arena.Resolve(last) - pinned_address };
+    REQUIRE(arena.CompactStep(area.GetSize()));
+    REQUIRE(arena.Resolve(pinned) == pinned_address);
+    // Moved into the hole right behind the pinned block
+    REQUIRE((arena.Resolve(last) - pinned_address) == (last_offset / 2));
+    REQUIRE(Holds(arena, last, 7U));
+    arena.Unpin(pinned);
+
+    // Unpinned, the next pass closes the gap in front of it
+    REQUIRE(arena.CompactStep(area.GetSize()));
+    REQUIRE(arena.Resolve(pinned) < pinned_address);
+    REQUIRE(arena.GetFragmentation() == 0.0);
+    REQUIRE(Holds(arena, last, 7U));
+}
+
+TEST_CASE("CompactingArena keeps the alignment of a block it moves", "[CompactingArena]") {
+    constexpr std::size_t ALIGNMENT{ 256U };
+    Area::HeapArea area{ 64U * 1024U };
+    CompactingArena arena{ area };
+    const RelocatableHandle padding{ arena.Allocate(3U * BLOCK_SIZE, 16U) };
+    const RelocatableHandle aligned{ arena.Allocate(BLOCK_SIZE, ALIGNMENT) };
+    Fill(arena, aligned, 3U);
+    REQUIRE(arena.Free(padding));
+
+    REQUIRE(arena.CompactStep(area.GetSize()));
+    REQUIRE((std::bit_cast<std::uintptr_t>(arena.Resolve(aligned)) % ALIGNMENT) == 0U);
+    REQUIRE(Holds(arena, aligned, 3U));
+}
+
+TEST_CASE("CompactingArena rejects stale handles and makes room for allocations by compacting", "[CompactingArena]") {
+    Area::HeapArea area{ 4096U };
+    CompactingArena arena{ area };
+    std::vector<RelocatableHandle> handles;
+    for (RelocatableHandle handle{ arena.Allocate(BLOCK_SIZE, 16U) }; !handle.IsNull(); handle = arena.Allocate(BLOCK_SIZE, 16U)) {
+        handles.push_back(handle);
+    }
+    REQUIRE(handles.size() > 2U);
+
+    const RelocatableHandle freed{ handles.front() };
+    REQUIRE(arena.Free(freed));
+    REQUIRE_FALSE(arena.Free(freed));
+    REQUIRE(arena.Resolve(freed) == nullptr);
+    REQUIRE(arena.GetAllocationSize(freed) == 0U);
+    REQUIRE(arena.Resolve(RelocatableHandle{}) == nullptr);
+
+    // The freed space is only reclaimed by compaction, the handle entry is reused with a new generation
+    REQUIRE(arena.Allocate(BLOCK_SIZE, 16U).IsNull());
+    REQUIRE(arena.CompactStep(area.GetSize()));
+    const RelocatableHandle reused{ arena.Allocate(BLOCK_SIZE, 16U) };
+    REQUIRE_FALSE(reused.IsNull());
+    REQUIRE(reused.index == freed.index);
+    REQUIRE(reused != freed);
+    REQUIRE(arena.Resolve(freed) == nullptr);
+}
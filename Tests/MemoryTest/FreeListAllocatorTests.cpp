@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <Allocator/AllocationChecking.hpp>
+#include <Allocator/FreeListAllocator.hpp>
+#include <Area/HeapArea.hpp>
+
+using namespace Synapse::Memory;
+
+namespace {
+    constexpr std::size_t AREA_SIZE{ 4096U };
+
+    using BestFitAllocator = Allocator::FreeListAllocator<0U, true>;
+    using FirstFitAllocator = Allocator::FreeListAllocator<0U, false>;
+    using UnsizedAllocator = Allocator::FreeListAllocator<0U, true, Allocator::UncheckedAllocation>;
+
+    // Every byte of the area is either used or in a free block
+    template <typename TAllocator>
+    auto IsAccounted(const TAllocator &allocator) -> bool {
+        return (allocator.GetUsed() + allocator.GetFreeSpace().free_bytes) == allocator.GetSize();
+    }
+
+    // A large hole in front of a small one, both in front of the free tail of the area
+    template <typename TAllocator>
+    auto CarveHoles(TAllocator &allocator) -> std::pair<std::byte *, std::byte *> {
+        std::byte *const large{ allocator.Allocate(512U, 8U) };
+        (void)allocator.Allocate(32U, 8U);
+        std::byte *const small{ allocator.Allocate(64U, 8U) };
+        (void)allocator.Allocate(32U, 8U);
+        allocator.Deallocate(large);
+        allocator.Deallocate(small);
+        return { large, small };
+    }
+}
+
+TEST_CASE("FreeListAllocator splits a free block and keeps the rest free", "[FreeListAllocator]") {
+    Area::HeapArea area{ AREA_SIZE };
+    BestFitAllocator allocator{ area.GetStart(), area.GetEnd() };
+    REQUIRE(allocator.GetFreeSpace().free_block_count == 1U);
+
+    std::byte *const first{ allocator.Allocate(100U, 8U) };
+    REQUIRE(first != nullptr);
+    REQUIRE(allocator.GetAllocationSize(first) == 100U);
+    Allocator::FreeSpaceStatistics free_space{ allocator.GetFreeSpace() };
+    REQUIRE(free_space.free_block_count == 1U);
+    REQUIRE(free_space.largest_free_block == (AREA_SIZE - allocator.GetUsed()));
+    REQUIRE(IsAccounted(allocator));
+
+    // Carved out of the remainder, right after the first block
+    std::byte *const second{ allocator.Allocate(100U, 8U) };
+    REQUIRE(second > first);
+    REQUIRE(static_cast<std::size_t>(second - first) == (allocator.GetUsed() / 2U));
+    REQUIRE(allocator.GetFreeSpace().free_block_count == 1U);
+    REQUIRE(IsAccounted(allocator));
+}
+
+TEST_CASE("FreeListAllocator merges a freed block with its free neighbours", "[FreeListAllocator]") {
+    Area::HeapArea area{ AREA_SIZE };
+    BestFitAllocator allocator{ area.GetStart(), area.GetEnd() };
+    std::byte *const a{ allocator.Allocate(200U, 8U) };
+    std::byte *const b{ allocator.Allocate(200U, 8U) };
+    std::byte *const c{ allocator.Allocate(200U, 8U) };
+    std::byte *const d{ allocator.Allocate(200U, 8U) };
+    REQUIRE(allocator.GetFreeSpace().free_block_count == 1U);
+
+    // Not adjacent to any free block
+    allocator.Deallocate(b);
+    REQUIRE(allocator.GetFreeSpace().free_block_count == 2U);
+    // Merged with the free block behind it
+    allocator.Deallocate(a);
+    REQUIRE(allocator.GetFreeSpace().free_block_count == 2U);
+    // Merged with the tail of the area
+    allocator.Deallocate(d);
+    REQUIRE(allocator.GetFreeSpace().free_block_count == 2U);
+    REQUIRE(IsAccounted(allocator));
+
+    // Merged with both neighbours, the area is one block again
+    allocator.Deallocate(c);
+    const Allocator::FreeSpaceStatistics free_space{ allocator.GetFreeSpace() };
+    REQUIRE(free_space.free_block_count == 1U);
+    REQUIRE(free_space.free_bytes == AREA_SIZE);
+    REQUIRE(free_space.largest_free_block == AREA_SIZE);
+    REQUIRE(allocator.GetUsed() == 0U);
+}
+
+TEST_CASE("FreeListAllocator reuses a hole and splits off what the allocation does not need", "[FreeListAllocator]") {
+    Area::HeapArea area{ AREA_SIZE };
+    BestFitAllocator allocator{ area.GetStart(), area.GetEnd() };
+    (void)allocator.Allocate(100U, 8U);
+    std::byte *const hole{ allocator.Allocate(400U, 8U) };
+    (void)allocator.Allocate(100U, 8U);
+    allocator.Deallocate(hole);
+    REQUIRE(allocator.GetFreeSpace().free_block_count == 2U);
+
+    // The hole fits better than the tail of the area
+    std::byte *const small{ allocator.Allocate(64U, 8U) };
+    REQUIRE(small == hole);
+    REQUIRE(allocator.GetFreeSpace().free_block_count == 2U);
+    std::byte *const rest{ allocator.Allocate(64U, 8U) };
+    REQUIRE(rest > small);
+    REQUIRE(rest < (hole + 400U));
+    REQUIRE(IsAccounted(allocator));
+}
+
+TEST_CASE("FreeListAllocator picks the smallest fitting block or the first one", "[FreeListAllocator]") {
+    Area::HeapArea best_area{ AREA_SIZE };
+    Area::HeapArea first_area{ AREA_SIZE };
+    BestFitAllocator best_fit{ best_area.GetStart(), best_area.GetEnd() };
+    FirstFitAllocator first_fit{ first_area.GetStart(), first_area.GetEnd() };
+    const auto [best_large, best_small] = CarveHoles(best_fit);
+    const auto [first_large, first_small] = CarveHoles(first_fit);
+
+    REQUIRE(best_fit.Allocate(48U, 8U) == best_small);
+    REQUIRE(first_fit.Allocate(48U, 8U) == first_large);
+}
+
+TEST_CASE("FreeListAllocator returns null when no block fits", "[FreeListAllocator]") {
+    Area::HeapArea area{ AREA_SIZE };
+    BestFitAllocator allocator{ area.GetStart(), area.GetEnd() };
+    REQUIRE(allocator.Allocate(AREA_SIZE, 8U) == nullptr);
+    REQUIRE(allocator.Allocate(AREA_SIZE * 2U, 8U) == nullptr);
+
+    std::byte *const whole{ allocator.Allocate(AREA_SIZE / 2U, 8U) };
+    REQUIRE(whole != nullptr);
+    REQUIRE(allocator.Allocate(AREA_SIZE / 2U, 8U) == nullptr);
+    allocator.Deallocate(whole);
+    REQUIRE(allocator.GetUsed() == 0U);
+}
+
+TEST_CASE("FreeListAllocator without stored sizes merges blocks freed with their size", "[FreeListAllocator]") {
+    Area::HeapArea area{ AREA_SIZE };
+    UnsizedAllocator allocator{ area.GetStart(), area.GetEnd() };
+    std::byte *const a{ allocator.Allocate(300U, 16U) };
+    std::byte *const b{ allocator.Allocate(50U, 64U) };
+    std::byte *const c{ allocator.Allocate(300U, 16U) };
+    REQUIRE((std::bit_cast<std::uintptr_t>(b) % 64U) == 0U);
+
+    allocator.Deallocate(a, 300U, 16U);
+    allocator.Deallocate(c, 300U, 16U);
+    REQUIRE(allocator.GetFreeSpace().free_block_count == 2U);
+    allocator.Deallocate(b, 50U, 64U);
+    REQUIRE(allocator.GetFreeSpace().free_block_count == 1U);
+    REQUIRE(allocator.GetUsed() == 0U);
+}
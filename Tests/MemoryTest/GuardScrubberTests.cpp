@@ -0,0 +1,154 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <Allocator/FreeListAllocator.hpp>
+#include <Area/HeapArea.hpp>
+#include <Arena/BoundsCheckingPolicy.hpp>
+#include <Arena/GuardRegistry.hpp>
+#include <Arena/GuardScrubber.hpp>
+#include <Arena/MemoryArena.hpp>
+#include <Arena/MemoryTaggingPolicy.hpp>
+#include <Arena/MemoryTrackingPolicy.hpp>
+#include <Arena/ThreadPolicy.hpp>
+#include <PatternUtility.hpp>
+#include "MemoryTestUtility.hpp"
+
+using namespace Synapse::Memory;
+using namespace Synapse::Memory::Arena;
+using MemoryTest::EnsureLogger;
+
+namespace {
+    constexpr std::size_t GUARD_SIZE{ 16U };
+    constexpr std::uint8_t PATTERN{ 0xFD };
+
+    using ScrubbedArena = MemoryArena<Allocator::FreeListAllocator<ScrubbedBoundsChecking::SIZE_FRONT>, SingleThreadPolicy,
+            ScrubbedBoundsChecking, NoMemoryTracking, NoMemoryTagging>;
+
+    // Front guard, payload and back guard of one block
+    struct GuardedBuffer {
+        GuardedBuffer() {
+            Utility::FillPattern(GetFront(), GUARD_SIZE, PATTERN);
+            Utility::FillPattern(GetBack(), GUARD_SIZE, PATTERN);
+        }
+
+        auto GetFront() -> std::byte * { return bytes.data(); }
+        auto GetBack() -> std::byte * { return bytes.data() + GUARD_SIZE + 32U; }
+
+        alignas(16) std::array<std::byte, (2U * GUARD_SIZE) + 32U> bytes{};
+    };
+
+    auto Sweep(GuardRegistry &registry, const std::size_t batch_size) -> GuardScrubResult {
+        GuardScrubResult result{};
+        std::size_t cursor{ 0U };
+        while (!registry.ScrubBatch(cursor, batch_size, result)) {
+        }
+        return result;
+    }
+}
+
+TEST_CASE("GuardRegistry verifies every registered block in batches", "[GuardRegistry]") {
+    GuardRegistry registry{ GUARD_SIZE, GUARD_SIZE, PATTERN };
+    std::array<GuardedBuffer, 5U> buffers{};
+    for (GuardedBuffer &buffer : buffers) {
+        registry.Register(&registry, buffer.GetFront(), buffer.GetBack());
+    }
+    REQUIRE(registry.GetCount() == 5U);
+
+    const GuardScrubResult result{ Sweep(registry, 2U) };
+    REQUIRE(result.blocks == 5U);
+    REQUIRE(result.bytes == 5U * 2U * GUARD_SIZE);
+    REQUIRE(result.violations == 0U);
+
+    // Swapping the last block into the hole keeps the others reachable
+    registry.Unregister(buffers[1].GetFront());
+    // Already gone, ignored
+    registry.Unregister(buffers[1].GetFront());
+    REQUIRE(registry.GetCount() == 4U);
+    REQUIRE(Sweep(registry, 2U).blocks == 4U);
+    registry.Unregister(buffers[4].GetFront());
+    REQUIRE(registry.GetCount() == 3U);
+}
+
+TEST_CASE("GuardRegistry reports an overwritten guard on every sweep until the block is gone", "[GuardRegistry]") {
+    EnsureLogger();
+    GuardRegistry registry{ GUARD_SIZE, GUARD_SIZE, PATTERN };
+    std::array<GuardedBuffer, 3U> buffers{};
+    for (GuardedBuffer &buffer : buffers) {
+        registry.Register(&registry, buffer.GetFront(), buffer.GetBack());
+    }
+
+    // One byte past the end of the payload
+    buffers[2].GetBack()[0] = std::byte{ 0x00 };
+    REQUIRE(Sweep(registry, 8U).violations == 1U);
+    REQUIRE(Sweep(registry, 8U).violations == 1U);
+    buffers[0].GetFront()[GUARD_SIZE - 1U] = std::byte{ 0x00 };
+    REQUIRE(Sweep(registry, 8U).violations == 2U);
+
+    registry.Unregister(buffers[2].GetFront());
+    REQUIRE(Sweep(registry, 8U).violations == 1U);
+}
+
+TEST_CASE("GuardRegistry drops the blocks of an owner", "[GuardRegistry]") {
+    GuardRegistry registry{ GUARD_SIZE, GUARD_SIZE, PATTERN };
+    std::array<GuardedBuffer, 6U> buffers{};
+    int first_owner{ 0 };
+    int second_owner{ 0 };
+    for (std::size_t i = 0U; i < buffers.size(); ++i) {
+        const void *owner{ ((i % 2U) == 0U) ? &first_owner : &second_owner };
+        registry.Register(owner, buffers[i].GetFront(), buffers[i].GetBack());
+    }
+
+    registry.UnregisterOwner(&first_owner);
+    REQUIRE(registry.GetCount() == 3U);
+    registry.Unregister(buffers[1].GetFront());
+    REQUIRE(registry.GetCount() == 2U);
+    registry.UnregisterOwner(&second_owner);
+    REQUIRE(registry.GetCount() == 0U);
+}
+
+TEST_CASE("GuardScrubber finds a stomp in a live block of a scrubbed arena", "[GuardScrubber]") {
+    EnsureLogger();
+    GuardRegistry &registry{ ScrubbedBoundsChecking::GetRegistry() };
+    const std::size_t registered{ registry.GetCount() };
+    Area::HeapArea area{ 4096U };
+    GuardScrubber scrubber{ registry, std::chrono::milliseconds(1), 4U };
+    {
+        ScrubbedArena arena{ area };
+        // Still live when the arena goes away
+        REQUIRE(arena.Allocate(40U, 8U) != nullptr);
+        std::byte *const stomped{ arena.Allocate(40U, 8U) };
+        REQUIRE(registry.GetCount() == registered + 2U);
+
+        const GuardScrubResult result{ scrubber.Sweep() };
+        REQUIRE(result.violations == 0U);
+        REQUIRE(result.bytes >= 2U * (ScrubbedBoundsChecking::SIZE_FRONT + ScrubbedBoundsChecking::SIZE_BACK));
+
+        stomped[40] = std::byte{ 0x00 };
+        REQUIRE(scrubber.Sweep().violations == 1U);
+        REQUIRE(scrubber.GetViolationCount() == 1U);
+
+        // The background thread finds it again without the block being freed
+        REQUIRE(scrubber.Start());
+        REQUIRE_FALSE(scrubber.Start());
+        const std::chrono::steady_clock::time_point end{ std::chrono::steady_clock::now() + std::chrono::seconds(5) };
+        while ((scrubber.GetViolationCount() < 2U) && (std::chrono::steady_clock::now() < end)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        scrubber.Stop();
+        REQUIRE_FALSE(scrubber.IsRunning());
+        REQUIRE(scrubber.GetViolationCount() >= 2U);
+        REQUIRE(scrubber.GetSweepCount() >= 3U);
+        REQUIRE(scrubber.GetBusyTime() > std::chrono::nanoseconds::zero());
+
+        // Repaired, so the free does not assert
+        stomped[40] = std::byte{ ScrubbedBoundsChecking::GUARD_PATTERN };
+        arena.Deallocate(stomped);
+        REQUIRE(registry.GetCount() == registered + 1U);
+    }
+
+    // The arena dropped the block it still held
+    REQUIRE(registry.GetCount() == registered);
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <Allocator/FreeListAllocator.hpp>
+#include <Arena/BoundsCheckingPolicy.hpp>
+#include <Arena/MemoryArena.hpp>
+#include <Arena/MemoryTaggingPolicy.hpp>
+#include <Arena/MemoryTrackingPolicy.hpp>
+#include <Arena/ThreadPolicy.hpp>
+#include <Log.hpp>
+
+namespace MemoryTest {
+    /// Arena without any policy, for the tests that only need memory from somewhere
+    using FreeListArena = Synapse::Memory::Arena::MemoryArena<Synapse::Memory::Allocator::FreeListAllocator<0U>,
+            Synapse::Memory::Arena::SingleThreadPolicy, Synapse::Memory::Arena::NoBoundsChecking,
+            Synapse::Memory::Arena::NoMemoryTracking, Synapse::Memory::Arena::NoMemoryTagging>;
+
+    /// Before anything that logs, the core logger does not exist until it is initialised
+    inline auto EnsureLogger() -> void {
+        if (!Synapse::Log::Log::GetCoreLogger()) {
+            Synapse::Log::Log::Initialise(false);
+        }
+    }
+}
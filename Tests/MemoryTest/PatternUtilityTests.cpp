@@ -0,0 +1,44 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <PatternUtility.hpp>
+
+using namespace Synapse::Memory;
+
+namespace {
+    constexpr std::uint8_t PATTERN{ 0xFD };
+    constexpr std::size_t MAX_SIZE{ 80U };
+}
+
+TEST_CASE("FillPattern writes exactly the range at every size and offset", "[PatternUtility]") {
+    // Covers the 256-bit loop, the 128-bit step and the byte tail
+    for (std::size_t offset = 0U; offset < 4U; ++offset) {
+        for (std::size_t size = 0U; size <= MAX_SIZE; ++size) {
+            std::array<std::byte, MAX_SIZE + 8U> buffer{};
+            Utility::FillPattern(buffer.data() + offset, size, PATTERN);
+            for (std::size_t i = 0U; i < buffer.size(); ++i) {
+                const bool inside{ (i >= offset) && (i < (offset + size)) };
+                REQUIRE(buffer[i] == (inside ? std::byte{ PATTERN } : std::byte{ 0x00 }));
+            }
+        }
+    }
+}
+
+TEST_CASE("FindPatternMismatch finds the first overwritten byte wherever it is", "[PatternUtility]") {
+    for (const std::size_t size : { 15U, 16U, 17U, 31U, 32U, 48U, 63U, 64U }) {
+        std::array<std::byte, MAX_SIZE> buffer{};
+        Utility::FillPattern(buffer.data(), size, PATTERN);
+        REQUIRE(Utility::FindPatternMismatch(buffer.data(), size, PATTERN) == nullptr);
+
+        for (std::size_t stomp = 0U; stomp < size; ++stomp) {
+            buffer[stomp] = std::byte{ 0x00 };
+            // A later second stomp does not hide the first
+            buffer[size - 1U] = std::byte{ 0x01 };
+            REQUIRE(Utility::FindPatternMismatch(buffer.data(), size, PATTERN) == (buffer.data() + stomp));
+            Utility::FillPattern(buffer.data(), size, PATTERN);
+        }
+        // Past the end of the range is not checked
+        REQUIRE(Utility::FindPatternMismatch(buffer.data(), size, PATTERN) == nullptr);
+    }
+}
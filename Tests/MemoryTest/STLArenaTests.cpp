@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <Area/HeapArea.hpp>
+#include <Arena/STLArena.hpp>
+#include "MemoryTestUtility.hpp"
+
+using namespace Synapse::Memory;
+using namespace Synapse::Memory::Arena;
+using MemoryTest::FreeListArena;
+
+namespace {
+    constexpr std::size_t AREA_SIZE{ 64U * 1024U };
+
+    template <typename TType>
+    using ArenaAllocator = STLArena<TType, FreeListArena>;
+
+    struct alignas(64) Wide {
+        std::uint8_t value;
+    };
+}
+
+TEST_CASE("STLArena rebinds to other types on the same arena and compares by arena", "[STLArena]") {
+    Area::HeapArea first_area{ AREA_SIZE };
+    Area::HeapArea second_area{ AREA_SIZE };
+    FreeListArena first{ first_area };
+    FreeListArena second{ second_area };
+    const ArenaAllocator<int> allocator{ first };
+
+    using Rebound = std::allocator_traits<ArenaAllocator<int>>::rebind_alloc<Wide>;
+    static_assert(std::is_same_v<Rebound, ArenaAllocator<Wide>>);
+    Rebound rebound{ allocator };
+    REQUIRE(&rebound.GetArena() == &first);
+    REQUIRE(rebound == allocator);
+    REQUIRE(allocator == rebound);
+    REQUIRE(allocator == ArenaAllocator<int>{ first });
+    REQUIRE(allocator != ArenaAllocator<int>{ second });
+    REQUIRE(rebound != ArenaAllocator<int>{ second });
+
+    // The rebound type keeps its own alignment
+    Wide *const wide{ rebound.allocate(3U) };
+    REQUIRE((std::bit_cast<std::uintptr_t>(wide) % alignof(Wide)) == 0U);
+    REQUIRE(first.GetStatistics().allocation_count == 1U);
+    // Equal adapters free each other's memory
+    ArenaAllocator<Wide>{ allocator }.deallocate(wide, 3U);
+    REQUIRE(first.GetStatistics().bytes_in_use == 0U);
+}
+
+TEST_CASE("STLArena backs containers that allocate node types", "[STLArena]") {
+    Area::HeapArea area{ AREA_SIZE };
+    FreeListArena arena{ area };
+    {
+        std::vector<int, ArenaAllocator<int>> values{ ArenaAllocator<int>{ arena } };
+        std::list<int, ArenaAllocator<int>> nodes{ ArenaAllocator<int>{ arena } };
+        std::deque<int, ArenaAllocator<int>> blocks{ ArenaAllocator<int>{ arena } };
+        std::map<int, int, std::less<>, ArenaAllocator<std::pair<const int, int>>> tree{ ArenaAllocator<std::pair<const int, int>>{ arena } };
+        for (int i = 0; i < 200; ++i) {
+            values.push_back(i);
+            nodes.push_back(i);
+            blocks.push_front(i);
+            tree.emplace(i, i * 2);
+        }
+        REQUIRE(values.back() == 199);
+        REQUIRE(nodes.size() == 200U);
+        REQUIRE(blocks.front() == 199);
+        REQUIRE(tree.at(100) == 200);
+        REQUIRE(arena.GetStatistics().allocation_count > 400U);
+    }
+    // Every node was returned to the arena with its size
+    REQUIRE(arena.GetStatistics().bytes_in_use == 0U);
+    REQUIRE(arena.GetStatistics().allocation_count == 0U);
+}
+
+TEST_CASE("STLArena follows the container on move assignment and swap", "[STLArena]") {
+    Area::HeapArea first_area{ AREA_SIZE };
+    Area::HeapArea second_area{ AREA_SIZE };
+    FreeListArena first{ first_area };
+    FreeListArena second{ second_area };
+    {
+        std::vector<int, ArenaAllocator<int>> on_first{ { 1, 2, 3 }, ArenaAllocator<int>{ first } };
+        std::vector<int, ArenaAllocator<int>> on_second{ { 4, 5 }, ArenaAllocator<int>{ second } };
+        on_first.swap(on_second);
+        REQUIRE(&on_first.get_allocator().GetArena() == &second);
+        REQUIRE(on_first.size() == 2U);
+
+        on_second = std::move(on_first);
+        REQUIRE(&on_second.get_allocator().GetArena() == &second);
+        REQUIRE(first.GetStatistics().bytes_in_use == 0U);
+    }
+    REQUIRE(first.GetStatistics().bytes_in_use == 0U);
+    REQUIRE(second.GetStatistics().bytes_in_use == 0U);
+}
+
+TEST_CASE("STLArena throws when the arena is out of memory", "[STLArena]") {
+    Area::HeapArea area{ 1024U };
+    FreeListArena arena{ area };
+    std::vector<int, ArenaAllocator<int>> values{ ArenaAllocator<int>{ arena } };
+    REQUIRE_THROWS_AS(values.reserve(1024U), std::bad_alloc);
+    REQUIRE(values.capacity() == 0U);
+    ArenaAllocator<std::uint64_t> allocator{ arena };
+    REQUIRE_THROWS_AS(allocator.allocate(std::numeric_limits<std::size_t>::max()), std::bad_array_new_length);
+}
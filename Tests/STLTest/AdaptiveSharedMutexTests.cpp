@@ -0,0 +1,100 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <Concurrent/AdaptiveSharedMutex.hpp>
+
+using namespace Synapse::STL::Concurrent;
+
+TEST_CASE("AdaptiveSharedMutex keeps writers exclusive and readers consistent", "[AdaptiveSharedMutex]") {
+    constexpr std::uint32_t WRITER_COUNT{ 4U };
+    constexpr std::uint32_t READER_COUNT{ 4U };
+    constexpr std::uint64_t ITERATIONS{ 20000U };
+    AdaptiveSharedMutex mutex{};
+    std::uint64_t first{ 0U };
+    std::uint64_t second{ 0U };
+    std::atomic<std::uint32_t> torn_reads{ 0U };
+
+    {
+        std::vector<std::jthread> threads{};
+        for (std::uint32_t i = 0U; i < WRITER_COUNT; ++i) {
+            threads.emplace_back([&] {
+                for (std::uint64_t j = 0U; j < ITERATIONS; ++j) {
+                    mutex.Lock();
+                    ++first;
+                    ++second;
+                    mutex.Unlock();
+                }
+            });
+        }
+        for (std::uint32_t i = 0U; i < READER_COUNT; ++i) {
+            threads.emplace_back([&] {
+                for (std::uint64_t j = 0U; j < ITERATIONS; ++j) {
+                    mutex.LockShared();
+                    if (first != second) {
+                        torn_reads.fetch_add(1U, std::memory_order_relaxed);
+                    }
+                    mutex.UnlockShared();
+                }
+            });
+        }
+    }
+
+    REQUIRE(torn_reads.load() == 0U);
+    REQUIRE(first == (WRITER_COUNT * ITERATIONS));
+}
+
+TEST_CASE("AdaptiveSharedMutex holds new readers back while a writer waits", "[AdaptiveSharedMutex]") {
+    AdaptiveSharedMutex mutex{};
+    mutex.LockShared();
+
+    std::atomic<bool> written{ false };
+    std::jthread writer{ [&] {
+        mutex.Lock();
+        written.store(true);
+        mutex.Unlock();
+    } };
+
+    // Once the writer stops spinning and waits, readers queue behind it
+    const auto deadline{ std::chrono::steady_clock::now() + std::chrono::seconds(10) };
+    bool held_back{ false };
+    while (!held_back && (std::chrono::steady_clock::now() < deadline)) {
+        if (mutex.TryLockShared()) {
+            mutex.UnlockShared();
+            std::this_thread::yield();
+        } else {
+            held_back = true;
+        }
+    }
+    REQUIRE(held_back);
+
+    // A reader already inside is not held back
+    mutex.LockSharedRecursive();
+    mutex.UnlockShared();
+    REQUIRE_FALSE(written.load());
+
+    mutex.UnlockShared();
+    writer.join();
+    REQUIRE(written.load());
+    REQUIRE(mutex.TryLock());
+    mutex.Unlock();
+}
+
+TEST_CASE("AdaptiveSharedMutex timed lock gives up and lets readers in again", "[AdaptiveSharedMutex]") {
+    AdaptiveSharedMutex mutex{};
+    mutex.LockShared();
+
+    bool acquired{ true };
+    std::jthread writer{ [&] { acquired = mutex.TryLockUntil(std::chrono::steady_clock::now() + std::chrono::milliseconds(50)); } };
+    writer.join();
+    REQUIRE_FALSE(acquired);
+
+    REQUIRE(mutex.TryLockShared());
+    mutex.UnlockShared();
+    mutex.UnlockShared();
+    REQUIRE(mutex.TryLockUntil(std::chrono::steady_clock::now()));
+    REQUIRE_FALSE(mutex.TryLockSharedUntil(std::chrono::steady_clock::now() + std::chrono::milliseconds(10)));
+    mutex.Unlock();
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <InplaceFunction.hpp>
+
+using namespace Synapse::STL;
+
+namespace {
+    struct Tracked {
+        explicit Tracked(std::int32_t &live) noexcept : live(&live) { ++live; }
+        Tracked(Tracked &&other) noexcept : live(other.live) { ++*live; }
+        Tracked(const Tracked &) = delete;
+        ~Tracked() { --*live; }
+        auto operator=(const Tracked &) -> Tracked & = delete;
+        auto operator=(Tracked &&) -> Tracked & = delete;
+
+        std::int32_t *live;
+    };
+}
+
+TEST_CASE("InplaceFunction stores small move-only callables inline", "[InplaceFunction]") {
+    auto value{ std::make_unique<std::int32_t>(20) };
+    auto callable{ [value = std::move(value)](const std::int32_t add) { return *value + add; } };
+    STATIC_REQUIRE(InplaceFunction<std::int32_t(std::int32_t)>::IS_INLINE<decltype(callable)>);
+
+    InplaceFunction<std::int32_t(std::int32_t)> function{ std::move(callable) };
+    REQUIRE(static_cast<bool>(function));
+    REQUIRE(function(22) == 42);
+
+    InplaceFunction<std::int32_t(std::int32_t)> moved{ std::move(function) };
+    REQUIRE_FALSE(static_cast<bool>(function));
+    REQUIRE(moved(1) == 21);
+}
+
+TEST_CASE("InplaceFunction falls back to the heap for large callables", "[InplaceFunction]") {
+    std::array<std::int64_t, 16> values{};
+    values[15] = 7;
+    auto callable{ [values] { return values[15]; } };
+    STATIC_REQUIRE_FALSE(InplaceFunction<std::int64_t()>::IS_INLINE<decltype(callable)>);
+
+    InplaceFunction<std::int64_t()> function{ callable };
+    InplaceFunction<std::int64_t()> assigned{};
+    assigned = std::move(function);
+    REQUIRE(assigned() == 7);
+}
+
+TEST_CASE("InplaceFunction destroys the callable exactly once", "[InplaceFunction]") {
+    std::int32_t live{ 0 };
+    {
+        InplaceFunction<void()> function{ [tracked = Tracked{ live }] {} };
+        REQUIRE(live == 1);
+        InplaceFunction<void()> moved{ std::move(function) };
+        REQUIRE(live == 1);
+        moved.Reset();
+        REQUIRE(live == 0);
+        moved = [tracked = Tracked{ live }] {};
+        REQUIRE(live == 1);
+    }
+    REQUIRE(live == 0);
+}
@@ -0,0 +1,73 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <Concurrent/IntrusiveMpscQueue.hpp>
+
+using namespace Synapse::STL::Concurrent;
+
+namespace {
+    struct Item : IntrusiveMpscNode {
+        std::uint32_t producer{ 0U };
+        std::uint32_t sequence{ 0U };
+    };
+}
+
+TEST_CASE("IntrusiveMpscQueue pops in push order and can be reused once empty", "[IntrusiveMpscQueue]") {
+    IntrusiveMpscQueue<Item> queue{};
+    std::vector<Item> items(4U);
+    REQUIRE(queue.IsEmpty());
+    REQUIRE(queue.Pop() == nullptr);
+
+    for (std::uint32_t round = 0U; round < 2U; ++round) {
+        for (std::uint32_t i = 0U; i < items.size(); ++i) {
+            items[i].sequence = i;
+            queue.Push(&items[i]);
+        }
+        REQUIRE_FALSE(queue.IsEmpty());
+        for (std::uint32_t i = 0U; i < items.size(); ++i) {
+            const Item *item{ queue.Pop() };
+            REQUIRE(item == &items[i]);
+        }
+        REQUIRE(queue.Pop() == nullptr);
+        REQUIRE(queue.IsEmpty());
+    }
+}
+
+TEST_CASE("IntrusiveMpscQueue keeps the order of every producer under contention", "[IntrusiveMpscQueue]") {
+    constexpr std::uint32_t PRODUCER_COUNT{ 4U };
+    constexpr std::uint32_t ITEMS_PER_PRODUCER{ 50000U };
+    IntrusiveMpscQueue<Item> queue{};
+    std::vector<std::vector<Item>> items(PRODUCER_COUNT);
+    for (std::vector<Item> &producer_items : items) {
+        producer_items = std::vector<Item>(ITEMS_PER_PRODUCER);
+    }
+
+    std::vector<std::jthread> producers{};
+    for (std::uint32_t producer = 0U; producer < PRODUCER_COUNT; ++producer) {
+        (void)producers.emplace_back([&queue, &items, producer] {
+            for (std::uint32_t i = 0U; i < ITEMS_PER_PRODUCER; ++i) {
+                items[producer][i].producer = producer;
+                items[producer][i].sequence = i;
+                queue.Push(&items[producer][i]);
+            }
+        });
+    }
+
+    std::vector<std::uint32_t> next_sequence(PRODUCER_COUNT, 0U);
+    bool in_order{ true };
+    std::uint32_t popped{ 0U };
+    while (popped < (PRODUCER_COUNT * ITEMS_PER_PRODUCER)) {
+        if (const Item *item{ queue.Pop() }) {
+            in_order = in_order && (item->sequence == next_sequence[item->producer]);
+            ++next_sequence[item->producer];
+            ++popped;
+        }
+    }
+    producers.clear();
+
+    REQUIRE(in_order);
+    REQUIRE(queue.Pop() == nullptr);
+    REQUIRE(queue.IsEmpty());
+}
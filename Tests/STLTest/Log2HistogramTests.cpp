@@ -0,0 +1,42 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <Log2Histogram.hpp>
+
+using namespace Synapse::STL;
+
+TEST_CASE("Log2Histogram buckets values by their highest set bit", "[Log2Histogram]") {
+    STATIC_REQUIRE(Log2Histogram::GetBucket(0U) == 0U);
+    STATIC_REQUIRE(Log2Histogram::GetBucket(1U) == 0U);
+    STATIC_REQUIRE(Log2Histogram::GetBucket(2U) == 1U);
+    STATIC_REQUIRE(Log2Histogram::GetBucket(3U) == 1U);
+    STATIC_REQUIRE(Log2Histogram::GetBucket(1024U) == 10U);
+    STATIC_REQUIRE(Log2Histogram::GetBucket(UINT64_MAX) == Log2Histogram::BUCKET_COUNT - 1U);
+}
+
+TEST_CASE("Log2Histogram quantiles are the upper bound of their bucket", "[Log2Histogram]") {
+    Log2Histogram histogram{};
+    REQUIRE(histogram.GetQuantile(0.5) == 0U);
+
+    for (std::uint32_t i = 0U; i < 90U; ++i) {
+        histogram.Record(100U);
+    }
+    for (std::uint32_t i = 0U; i < 10U; ++i) {
+        histogram.Record(5000U);
+    }
+    REQUIRE(histogram.GetCount() == 100U);
+    REQUIRE(histogram.GetQuantile(0.5) == 128U);
+    REQUIRE(histogram.GetQuantile(0.9) == 128U);
+    REQUIRE(histogram.GetQuantile(0.99) == 8192U);
+}
+
+TEST_CASE("Log2Histogram merges bucket by bucket", "[Log2Histogram]") {
+    Log2Histogram first{};
+    Log2Histogram second{};
+    first.Record(1U);
+    second.Record(1U);
+    second.Record(1U << 20U);
+    first.Merge(second);
+    REQUIRE(first.counts[0U] == 2U);
+    REQUIRE(first.counts[20U] == 1U);
+    REQUIRE(first.GetCount() == 3U);
+}
\ No newline at end of file
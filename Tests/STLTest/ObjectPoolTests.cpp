@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <Allocator/FreeListAllocator.hpp>
+#include <Allocator/AllocationChecking.hpp>
+#include <Area/HeapArea.hpp>
+#include <Arena/MemoryArena.hpp>
+#include <ObjectPool.hpp>
+
+using namespace Synapse;
+using namespace Synapse::Memory;
+
+namespace {
+    using TestArena = Arena::MemoryArena<Allocator::FreeListAllocator<0, true, Allocator::UncheckedAllocation>,
+            Arena::SingleThreadPolicy, Arena::NoBoundsChecking, Arena::NoMemoryTracking, Arena::NoMemoryTagging>;
+
+    struct Counted {
+        static inline int s_live{ 0 };
+        int value;
+
+        explicit Counted(const int init) : value(init) {
+            if (init < 0) {
+                throw std::invalid_argument("negative");
+            }
+            ++s_live;
+        }
+        ~Counted() { --s_live; }
+        Counted(const Counted&) = delete;
+        auto operator=(const Counted &) -> Counted & = delete;
+    };
+}
+
+TEST_CASE("ObjectPool constructs on Pop and destroys on Push", "[ObjectPool]") {
+    Counted::s_live = 0;
+    STL::ObjectPool<Counted, 4> pool{};
+    REQUIRE(Counted::s_live == 0);
+    REQUIRE(pool.GetNumberOfAvailableObjects() == 4);
+
+    Counted *a = pool.Pop(1);
+    Counted *b = pool.Pop(2);
+    REQUIRE(a->value == 1);
+    REQUIRE(b->value == 2);
+    REQUIRE(Counted::s_live == 2);
+    REQUIRE(pool.GetNumberOfAvailableObjects() == 2);
+
+    pool.Push(a);
+    REQUIRE(Counted::s_live == 1);
+    // The freed slot is reused first
+    Counted *c = pool.Pop(3);
+    REQUIRE(c == a);
+    REQUIRE(c->value == 3);
+
+    pool.Push(b);
+    pool.Push(c);
+    REQUIRE(Counted::s_live == 0);
+}
+
+TEST_CASE("ObjectPool returns nullptr when exhausted", "[ObjectPool]") {
+    STL::ObjectPool<int, 3> pool{};
+    std::vector<int *> objects{};
+    for (int i = 0; i < 3; ++i) {
+        objects.push_back(pool.Pop(i));
+        REQUIRE(objects.back() != nullptr);
+    }
+    REQUIRE(pool.Pop(3) == nullptr);
+    for (int *object : objects) {
+        pool.Push(object);
+    }
+    REQUIRE(pool.GetNumberOfAvailableObjects() == 3);
+}
+
+TEST_CASE("ObjectPool hands the slot back when the constructor throws", "[ObjectPool]") {
+    Counted::s_live = 0;
+    STL::ObjectPool<Counted, 1> pool{};
+    REQUIRE_THROWS_AS(pool.Pop(-1), std::invalid_argument);
+    REQUIRE(pool.GetNumberOfAvailableObjects() == 1);
+    Counted *object = pool.Pop(5);
+    REQUIRE(object != nullptr);
+    pool.Push(object);
+}
+
+TEST_CASE("Runtime ObjectPool takes its storage from an arena", "[ObjectPool]") {
+    Area::HeapArea area{ 64U * 1024U };
+    TestArena arena{ area };
+    {
+        Runtime::ObjectPool<Counted, TestArena> pool{ arena, 100U };
+        REQUIRE(pool.GetCapacity() == 100);
+        REQUIRE(arena.GetStatistics().allocation_count == 1);
+
+        std::vector<Counted *> objects{};
+        for (int i = 0; i < 100; ++i) {
+            objects.push_back(pool.Pop(i));
+        }
+        REQUIRE(pool.Pop(100) == nullptr);
+        REQUIRE(Counted::s_live == 100);
+        for (Counted *object : objects) {
+            pool.Push(object);
+        }
+        REQUIRE(pool.IsEmpty());
+    }
+    REQUIRE(arena.GetStatistics().allocation_count == 0);
+}
@@ -0,0 +1,33 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <Concurrent/SizeClassPool.hpp>
+
+using namespace Synapse::STL::Concurrent;
+
+TEST_CASE("SizeClassPool serves every size aligned and reuses blocks of the same class", "[SizeClassPool]") {
+    std::vector<std::size_t> sizes{};
+    for (std::size_t size = 1U; size <= (SizeClassPool::MAX_SIZE + 100U); size += 37U) {
+        sizes.push_back(size);
+    }
+    std::vector<void *> blocks{};
+    for (const std::size_t size : sizes) {
+        void *block{ SizeClassPool::Allocate(size) };
+        REQUIRE((std::bit_cast<std::uintptr_t>(block) % alignof(std::max_align_t)) == 0U);
+        std::memset(block, 0xAB, size);
+        blocks.push_back(block);
+    }
+    for (std::size_t i = 0U; i < blocks.size(); ++i) {
+        SizeClassPool::Deallocate(blocks[i], sizes[i]);
+    }
+
+    // 100 and 128 round up to the same class, the block just released comes back
+    void *first{ SizeClassPool::Allocate(100U) };
+    SizeClassPool::Deallocate(first, 100U);
+    void *second{ SizeClassPool::Allocate(128U) };
+    REQUIRE(second == first);
+    SizeClassPool::Deallocate(second, 128U);
+}
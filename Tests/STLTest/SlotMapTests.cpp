@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <Allocator/FreeListAllocator.hpp>
+#include <Allocator/AllocationChecking.hpp>
+#include <Area/HeapArea.hpp>
+#include <Arena/MemoryArena.hpp>
+#include <SlotMap.hpp>
+
+using namespace Synapse::STL;
+using namespace Synapse::Memory;
+
+namespace {
+    using TestArena = Arena::MemoryArena<Allocator::FreeListAllocator<0, true, Allocator::UncheckedAllocation>,
+            Arena::SingleThreadPolicy, Arena::NoBoundsChecking, Arena::NoMemoryTracking, Arena::NoMemoryTagging>;
+
+    struct Connection {
+        std::uint32_t id;
+        std::unique_ptr<int> buffer;
+    };
+}
+
+TEST_CASE("SlotMap returns the inserted objects through their handles", "[SlotMap]") {
+    Area::HeapArea area{ 64U * 1024U };
+    TestArena arena{ area };
+    SlotMap<int, TestArena> map{ arena, 4U };
+
+    const SlotHandle a = map.Emplace(1);
+    const SlotHandle b = map.Emplace(2);
+    REQUIRE_FALSE(a.IsNull());
+    REQUIRE(a != b);
+    REQUIRE(map.GetSize() == 2);
+    REQUIRE(*map.Get(a) == 1);
+    REQUIRE(*map.Get(b) == 2);
+}
+
+TEST_CASE("SlotMap detects stale handles after erase and slot reuse", "[SlotMap]") {
+    Area::HeapArea area{ 64U * 1024U };
+    TestArena arena{ area };
+    SlotMap<int, TestArena> map{ arena, 4U };
+
+    const SlotHandle a = map.Emplace(1);
+    REQUIRE(map.Erase(a));
+    REQUIRE_FALSE(map.Contains(a));
+    REQUIRE(map.Get(a) == nullptr);
+    REQUIRE_FALSE(map.Erase(a));
+
+    // The freed slot is reused with a new generation
+    const SlotHandle b = map.Emplace(2);
+    REQUIRE(b.index == a.index);
+    REQUIRE(b.generation != a.generation);
+    REQUIRE(map.Get(a) == nullptr);
+    REQUIRE(*map.Get(b) == 2);
+    REQUIRE(map.Get(SlotHandle{}) == nullptr);
+}
+
+TEST_CASE("SlotMap keeps objects dense and handles valid across erase and growth", "[SlotMap]") {
+    Area::HeapArea area{ 1024U * 1024U };
+    TestArena arena{ area };
+    SlotMap<Connection, TestArena> map{ arena, 2U };
+
+    std::vector<SlotHandle> handles{};
+    for (std::uint32_t i = 0U; i < 100U; ++i) {
+        handles.push_back(map.Emplace(Connection{ i, std::make_unique<int>(static_cast<int>(i)) }));
+    }
+    REQUIRE(map.GetCapacity() >= 100);
+
+    for (std::uint32_t i = 0U; i < 100U; i += 2U) {
+        REQUIRE(map.Erase(handles[i]));
+    }
+    REQUIRE(map.GetSize() == 50);
+
+    for (std::uint32_t i = 1U; i < 100U; i += 2U) {
+        const Connection *connection = map.Get(handles[i]);
+        REQUIRE(connection != nullptr);
+        REQUIRE(connection->id == i);
+        REQUIRE(*connection->buffer == static_cast<int>(i));
+    }
+
+    std::size_t visited = 0;
+    for (const Connection &connection : map) {
+        REQUIRE((connection.id % 2U) == 1U);
+        ++visited;
+    }
+    REQUIRE(visited == 50);
+    REQUIRE(map.Get(map.GetHandleAt(0))->id == map.begin()->id);
+}
+
+TEST_CASE("SlotMap rejects forged and never issued handles", "[SlotMap]") {
+    Area::HeapArea area{ 64U * 1024U };
+    TestArena arena{ area };
+    SlotMap<int, TestArena> map{ arena, 8U };
+
+    const SlotHandle a = map.Emplace(1);
+    const SlotHandle b = map.Emplace(2);
+    const SlotHandle c = map.Emplace(3);
+    REQUIRE(map.Erase(b));
+
+    // Free slots that were never handed out still hold generation 1
+    for (std::uint32_t index = 3U; index < 8U; ++index) {
+        const SlotHandle forged{ .index = index, .generation = 1U };
+        REQUIRE_FALSE(map.Contains(forged));
+        REQUIRE(map.Get(forged) == nullptr);
+        REQUIRE_FALSE(map.Erase(forged));
+    }
+    // Same for an id that came off the wire for the freed slot, with its current generation
+    const SlotHandle unpacked = SlotHandle::Unpack(SlotHandle{ .index = b.index, .generation = b.generation + 1U }.Pack());
+    REQUIRE_FALSE(map.Contains(unpacked));
+    REQUIRE_FALSE(map.Erase(unpacked));
+    REQUIRE_FALSE(map.Contains(SlotHandle{ .index = 100U, .generation = 1U }));
+
+    // The rejected erases left the map intact
+    REQUIRE(map.GetSize() == 2U);
+    REQUIRE(*map.Get(a) == 1);
+    REQUIRE(*map.Get(c) == 3);
+}
+
+TEST_CASE("SlotMap Clear invalidates every handle", "[SlotMap]") {
+    Area::HeapArea area{ 64U * 1024U };
+    TestArena arena{ area };
+    SlotMap<int, TestArena> map{ arena };
+
+    const SlotHandle a = map.Emplace(1);
+    const SlotHandle b = map.Emplace(2);
+    map.Clear();
+    REQUIRE(map.IsEmpty());
+    REQUIRE_FALSE(map.Contains(a));
+    REQUIRE_FALSE(map.Contains(b));
+}
+
+TEST_CASE("SlotMap returns the null handle when the arena is exhausted", "[SlotMap]") {
+    Area::HeapArea area{ 4096U };
+    TestArena arena{ area };
+    SlotMap<std::uint64_t, TestArena> map{ arena, 8U };
+
+    SlotHandle last{};
+    do {
+        last = map.Emplace(std::uint64_t{ 7U });
+    } while (!last.IsNull());
+    REQUIRE(map.GetSize() == map.GetCapacity());
+}
+
+TEST_CASE("SlotHandle packs into 64 bits", "[SlotHandle]") {
+    const SlotHandle handle{ .index = 12U, .generation = 34U };
+    REQUIRE(SlotHandle::Unpack(handle.Pack()) == handle);
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bit>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+#include <Concurrent/ThreadCachedPool.hpp>
+
+using namespace Synapse::STL::Concurrent;
+
+namespace {
+    struct alignas(32) Payload {
+        std::uint64_t values[5]{};
+    };
+}
+
+TEST_CASE("ThreadCachedPool reuses slots and keeps them aligned", "[ThreadCachedPool]") {
+    using Pool = ThreadCachedPool<Payload>;
+    std::vector<Payload *> objects{};
+    for (std::size_t i = 0U; i < (3U * Pool::BATCH_SIZE); ++i) {
+        Payload *object{ Pool::Create() };
+        REQUIRE((std::bit_cast<std::uintptr_t>(object) % alignof(Payload)) == 0U);
+        object->values[0] = i;
+        objects.push_back(object);
+    }
+    REQUIRE(std::set<Payload *>(objects.begin(), objects.end()).size() == objects.size());
+
+    const std::set<Payload *> released(objects.begin(), objects.end());
+    for (Payload *object : objects) {
+        Pool::Destroy(object);
+    }
+    Payload *reused{ Pool::Create() };
+    REQUIRE(released.contains(reused));
+    Pool::Destroy(reused);
+}
+
+TEST_CASE("ThreadCachedPool takes back slots released on another thread", "[ThreadCachedPool]") {
+    using Pool = ThreadCachedPool<std::uint64_t>;
+    constexpr std::size_t OBJECT_COUNT{ 10U * Pool::BATCH_SIZE };
+    std::vector<std::uint64_t *> objects{};
+    for (std::size_t i = 0U; i < OBJECT_COUNT; ++i) {
+        objects.push_back(Pool::Create(i));
+    }
+
+    std::uint64_t sum{ 0U };
+    std::jthread consumer{ [&objects, &sum] {
+        for (std::uint64_t *object : objects) {
+            sum += *object;
+            Pool::Destroy(object);
+        }
+    } };
+    consumer.join();
+
+    REQUIRE(sum == ((OBJECT_COUNT * (OBJECT_COUNT - 1U)) / 2U));
+    // The consumer handed full batches back, they are served again here
+    for (std::size_t i = 0U; i < OBJECT_COUNT; ++i) {
+        objects[i] = Pool::Create(i);
+    }
+    for (std::uint64_t *object : objects) {
+        Pool::Destroy(object);
+    }
+}
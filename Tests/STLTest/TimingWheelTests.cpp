@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <TimingWheel.hpp>
+
+using namespace Synapse::STL;
+
+TEST_CASE("TimingWheel expires items at their tick in insertion order", "[TimingWheel]") {
+    TimingWheel<std::uint32_t> wheel{ 100U };
+    wheel.Insert(105U, 1U);
+    wheel.Insert(105U, 2U);
+    wheel.Insert(90U, 3U);
+    wheel.Insert(100U + 5000U, 4U);
+
+    std::vector<std::uint32_t> expired{};
+    wheel.Advance(104U, [&](const std::uint32_t item) { expired.push_back(item); });
+    REQUIRE(expired == std::vector<std::uint32_t>{ 3U });
+    wheel.Advance(105U, [&](const std::uint32_t item) { expired.push_back(item); });
+    REQUIRE(expired == std::vector<std::uint32_t>{ 3U, 1U, 2U });
+    wheel.Advance(5099U, [&](const std::uint32_t item) { expired.push_back(item); });
+    REQUIRE(wheel.GetCount() == 1U);
+    wheel.Advance(5100U, [&](const std::uint32_t item) { expired.push_back(item); });
+    REQUIRE(expired.back() == 4U);
+    REQUIRE(wheel.GetCount() == 0U);
+}
+
+TEST_CASE("TimingWheel expires every item exactly at its tick across all levels", "[TimingWheel]") {
+    constexpr std::uint64_t START_TICK{ 12345U };
+    TimingWheel<std::uint32_t> wheel{ START_TICK };
+    std::mt19937_64 random{ 42U };
+    std::vector<std::uint64_t> due_ticks{};
+    for (std::uint32_t i = 0U; i < 20000U; ++i) {
+        // Spread over every level and the overflow list
+        const std::uint32_t shift{ static_cast<std::uint32_t>(random() % 26U) };
+        const std::uint64_t due_tick{ START_TICK + (random() % (std::uint64_t{ 1U } << shift)) + 1U };
+        due_ticks.push_back(due_tick);
+        wheel.Insert(due_tick, i);
+    }
+
+    std::uint64_t tick{ START_TICK };
+    bool on_time{ true };
+    std::size_t expired_count{ 0U };
+    const auto expire = [&](const std::uint32_t item) {
+        on_time = on_time && (due_ticks[item] == tick);
+        ++expired_count;
+    };
+    while (wheel.GetCount() > 0U) {
+        ++tick;
+        wheel.Advance(tick, expire);
+        // Re-arm some timers from inside the loop, like a repeating job would
+        if (((tick % 4099U) == 0U) && (tick < (START_TICK + (1U << 20U)))) {
+            due_ticks.push_back(tick + 70000U);
+            wheel.Insert(tick + 70000U, static_cast<std::uint32_t>(due_ticks.size() - 1U));
+        }
+    }
+    REQUIRE(on_time);
+    REQUIRE(expired_count == due_ticks.size());
+}
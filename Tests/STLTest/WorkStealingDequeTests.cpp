@@ -0,0 +1,193 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <vector>
+#include <Concurrent/WorkStealingDeque.hpp>
+#include <Concurrent/WorkStealingScheduler.hpp>
+
+using namespace Synapse::STL::Concurrent;
+
+TEST_CASE("WorkStealingDeque pops LIFO and steals FIFO", "[WorkStealingDeque]") {
+    WorkStealingDeque<std::uint32_t> deque{ 2U };
+    for (std::uint32_t i = 0U; i < 10U; ++i) {
+        deque.Push(i);
+    }
+    REQUIRE(deque.WasSize() == 10);
+    REQUIRE(deque.Pop() == 9U);
+    REQUIRE(deque.Steal() == 0U);
+    REQUIRE(deque.Steal() == 1U);
+    REQUIRE(deque.Pop() == 8U);
+    REQUIRE(deque.WasSize() == 6);
+}
+
+TEST_CASE("WorkStealingDeque hands every item out exactly once under concurrent stealing", "[WorkStealingDeque]") {
+    constexpr std::uint32_t ITEM_COUNT{ 200000U };
+    constexpr std::uint32_t THIEF_COUNT{ 3U };
+    WorkStealingDeque<std::uint32_t> deque{ 16U };
+    std::vector<std::atomic<std::uint32_t>> taken(ITEM_COUNT);
+    std::atomic<bool> done{ false };
+
+    std::vector<std::jthread> thieves{};
+    for (std::uint32_t i = 0U; i < THIEF_COUNT; ++i) {
+        (void)thieves.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire) || (deque.WasSize() > 0U)) {
+                if (const std::optional<std::uint32_t> item{ deque.Steal() }) {
+                    (void)taken[*item].fetch_add(1U, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (std::uint32_t i = 0U; i < ITEM_COUNT; ++i) {
+        deque.Push(i);
+        if ((i % 3U) == 0U) {
+            if (const std::optional<std::uint32_t> item{ deque.Pop() }) {
+                (void)taken[*item].fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+    }
+    while (const std::optional<std::uint32_t> item{ deque.Pop() }) {
+        (void)taken[*item].fetch_add(1U, std::memory_order_relaxed);
+    }
+    done.store(true, std::memory_order_release);
+    thieves.clear();
+
+    for (const std::atomic<std::uint32_t> &count : taken) {
+        REQUIRE(count.load() == 1U);
+    }
+}
+
+TEST_CASE("WorkStealingScheduler lets idle workers steal and wakes parked workers", "[WorkStealingScheduler]") {
+    constexpr std::uint32_t WORKER_COUNT{ 4U };
+    constexpr std::uint64_t ITEM_COUNT{ 10000U };
+    WorkStealingScheduler<std::uint32_t> scheduler{ WORKER_COUNT };
+    std::atomic<std::uint64_t> completed{ 0U };
+    std::atomic<std::uint32_t> unregistered{ 0U };
+
+    // Catch assertions are not thread safe, the workers only count
+    std::vector<std::jthread> workers{};
+    for (std::uint32_t i = 0U; i < WORKER_COUNT; ++i) {
+        (void)workers.emplace_back([&] {
+            const std::uint32_t worker{ scheduler.RegisterWorker() };
+            if (worker == WorkStealingScheduler<std::uint32_t>::NO_WORKER) {
+                (void)unregistered.fetch_add(1U);
+            }
+            while (completed.load() < ITEM_COUNT) {
+                if (scheduler.Pop(worker)) {
+                    (void)completed.fetch_add(1U);
+                } else {
+                    scheduler.Park(std::chrono::steady_clock::now() + std::chrono::milliseconds(10));
+                }
+            }
+        });
+    }
+    for (std::uint64_t i = 0U; i < ITEM_COUNT; ++i) {
+        scheduler.Push(static_cast<std::uint32_t>(i), WorkStealingScheduler<std::uint32_t>::NO_WORKER);
+    }
+    workers.clear();
+    REQUIRE(unregistered.load() == 0U);
+    REQUIRE(completed.load() == ITEM_COUNT);
+    REQUIRE_FALSE(scheduler.HasWork());
+    REQUIRE(scheduler.RegisterWorker() == WorkStealingScheduler<std::uint32_t>::NO_WORKER);
+}
+
+TEST_CASE("WorkStealingScheduler keeps items pushed to a worker from thieves until the steal delay passed", "[WorkStealingScheduler]") {
+    constexpr std::uint32_t NO_WORKER{ WorkStealingScheduler<std::uint32_t>::NO_WORKER };
+    WorkStealingScheduler<std::uint32_t> scheduler{ 2U, std::chrono::hours(1) };
+    const std::uint32_t first{ scheduler.RegisterWorker() };
+    const std::uint32_t second{ scheduler.RegisterWorker() };
+
+    scheduler.PushTo(1U, second, first);
+    scheduler.PushTo(2U, second, NO_WORKER);
+    REQUIRE(scheduler.HasWork());
+    REQUIRE_FALSE(scheduler.Pop(first).has_value());
+    REQUIRE_FALSE(scheduler.Pop(NO_WORKER).has_value());
+    REQUIRE(scheduler.Pop(second) == std::optional<std::uint32_t>{ 1U });
+    REQUIRE(scheduler.Pop(second) == std::optional<std::uint32_t>{ 2U });
+
+    // To itself, or without a target, it is a plain push
+    scheduler.PushTo(3U, first, first);
+    scheduler.PushTo(4U, NO_WORKER, first);
+    REQUIRE(scheduler.Pop(second) == std::optional<std::uint32_t>{ 3U });
+    REQUIRE(scheduler.Pop(second) == std::optional<std::uint32_t>{ 4U });
+
+    scheduler.SetStealDelay(std::chrono::nanoseconds{ 0 });
+    scheduler.PushTo(5U, second, first);
+    REQUIRE(scheduler.Pop(first) == std::optional<std::uint32_t>{ 5U });
+    REQUIRE_FALSE(scheduler.HasWork());
+}
+TEST_CASE("WorkStealingScheduler PushTo wakes only the parked target worker", "[WorkStealingScheduler]") {
+    WorkStealingScheduler<std::uint32_t> scheduler{ 3U, std::chrono::hours(1) };
+    const std::uint32_t pusher{ scheduler.RegisterWorker() };
+    const std::uint32_t target{ scheduler.RegisterWorker() };
+    const std::uint32_t bystander{ scheduler.RegisterWorker() };
+    std::chrono::steady_clock::duration target_parked{};
+    std::chrono::steady_clock::duration bystander_parked{};
+    std::optional<std::uint32_t> taken{};
+
+    std::jthread target_thread{ [&] {
+        const std::chrono::steady_clock::time_point start{ std::chrono::steady_clock::now() };
+        scheduler.Park(start + std::chrono::seconds(10), target);
+        target_parked = std::chrono::steady_clock::now() - start;
+        taken = scheduler.Pop(target);
+    } };
+    std::jthread bystander_thread{ [&] {
+        const std::chrono::steady_clock::time_point start{ std::chrono::steady_clock::now() };
+        scheduler.Park(start + std::chrono::milliseconds(300), bystander);
+        bystander_parked = std::chrono::steady_clock::now() - start;
+    } };
+    // Let both park first
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    scheduler.PushTo(7U, target, pusher);
+    target_thread.join();
+    bystander_thread.join();
+
+    REQUIRE(taken == std::optional<std::uint32_t>{ 7U });
+    REQUIRE(target_parked < std::chrono::seconds(5));
+    REQUIRE(bystander_parked >= std::chrono::milliseconds(250));
+}
+
+TEST_CASE("WorkStealingScheduler PushTo to a busy worker lets a parked worker steal after the delay", "[WorkStealingScheduler]") {
+    WorkStealingScheduler<std::uint32_t> scheduler{ 2U, std::chrono::milliseconds(20) };
+    const std::uint32_t thief{ scheduler.RegisterWorker() };
+    const std::uint32_t busy{ scheduler.RegisterWorker() };
+    std::optional<std::uint32_t> taken{};
+    std::chrono::steady_clock::duration waited{};
+
+    std::jthread thief_thread{ [&] {
+        const std::chrono::steady_clock::time_point start{ std::chrono::steady_clock::now() };
+        while (!taken && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(5))) {
+            taken = scheduler.Pop(thief);
+            if (!taken) {
+                scheduler.Park(std::chrono::steady_clock::now() + std::chrono::seconds(10), thief);
+            }
+        }
+        waited = std::chrono::steady_clock::now() - start;
+    } };
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    scheduler.PushTo(9U, busy, WorkStealingScheduler<std::uint32_t>::NO_WORKER);
+    thief_thread.join();
+
+    REQUIRE(taken == std::optional<std::uint32_t>{ 9U });
+    REQUIRE(waited < std::chrono::seconds(2));
+}
+
+TEST_CASE("WorkStealingScheduler Drain takes every item regardless of the steal delay", "[WorkStealingScheduler]") {
+    constexpr std::uint32_t NO_WORKER{ WorkStealingScheduler<std::uint32_t>::NO_WORKER };
+    WorkStealingScheduler<std::uint32_t> scheduler{ 2U, std::chrono::hours(1) };
+    const std::uint32_t first{ scheduler.RegisterWorker() };
+    const std::uint32_t second{ scheduler.RegisterWorker() };
+    scheduler.Push(1U, first);
+    scheduler.PushTo(2U, second, first);
+    scheduler.PushTo(3U, first, NO_WORKER);
+    scheduler.Push(4U, NO_WORKER);
+
+    std::vector<std::uint32_t> drained{};
+    scheduler.Drain([&](const std::uint32_t item) { drained.push_back(item); });
+    std::ranges::sort(drained);
+    REQUIRE(drained == std::vector<std::uint32_t>{ 1U, 2U, 3U, 4U });
+    REQUIRE_FALSE(scheduler.HasWork());
+}
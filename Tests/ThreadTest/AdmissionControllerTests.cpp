@@ -0,0 +1,67 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <Job/AdmissionController.hpp>
+
+using namespace CoreThread::Job;
+using namespace std::chrono_literals;
+
+namespace {
+    auto CountAdmitted(AdmissionController& controller, const std::uint32_t calls) -> std::uint32_t {
+        std::uint32_t admitted = 0U;
+        for (std::uint32_t call = 0U; call < calls; ++call) {
+            admitted += controller.Admit() ? 1U : 0U;
+        }
+        return admitted;
+    }
+}
+
+TEST_CASE("AdmissionController admits everything while the queue delay stays below the target", "[AdmissionController]") {
+    AdmissionController controller{ AdmissionOptions{ .target_delay = 5ms, .interval = 100ms } };
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    controller.RecordDelay(1ms, start + 150ms);
+    controller.RecordDelay(2ms, start + 300ms);
+
+    REQUIRE_FALSE(controller.IsOverloaded());
+    REQUIRE(controller.GetAdmitPermille() == 1000U);
+    REQUIRE(CountAdmitted(controller, 1000U) == 1000U);
+    REQUIRE(controller.GetRejectedCount() == 0U);
+}
+
+TEST_CASE("AdmissionController absorbs a burst that drains within the interval", "[AdmissionController]") {
+    AdmissionController controller{ AdmissionOptions{ .target_delay = 5ms, .interval = 100ms } };
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    controller.RecordDelay(50ms, start + 10ms);
+    controller.RecordDelay(1ms, start + 20ms);
+    controller.RecordDelay(50ms, start + 150ms);
+
+    REQUIRE_FALSE(controller.IsOverloaded());
+}
+
+TEST_CASE("AdmissionController sheds a quarter per overloaded interval and recovers additively", "[AdmissionController]") {
+    AdmissionController controller{ AdmissionOptions{ .target_delay = 5ms, .interval = 100ms, .min_admit_permille = 50, .admit_increase_permille = 50 } };
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    controller.RecordDelay(20ms, start + 150ms);
+    REQUIRE(controller.IsOverloaded());
+    REQUIRE(controller.GetAdmitPermille() == 750U);
+    controller.RecordDelay(20ms, start + 300ms);
+    REQUIRE(controller.GetAdmitPermille() == 563U);
+
+    // The admitted calls are spread evenly, every thousand calls admit exactly the share
+    REQUIRE(CountAdmitted(controller, 1000U) == 563U);
+    REQUIRE(controller.GetRejectedCount() == 437U);
+
+    controller.RecordDelay(1ms, start + 450ms);
+    REQUIRE(controller.GetAdmitPermille() == 613U);
+}
+
+TEST_CASE("AdmissionController never sheds below the minimum share", "[AdmissionController]") {
+    AdmissionController controller{ AdmissionOptions{ .target_delay = 5ms, .interval = 100ms, .min_admit_permille = 50 } };
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::int64_t interval = 1; interval <= 40; ++interval) {
+        controller.RecordDelay(1s, start + (interval * 150ms));
+    }
+    REQUIRE(controller.GetAdmitPermille() == 50U);
+    REQUIRE(CountAdmitted(controller, 1000U) == 50U);
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <CpuTopology.hpp>
+
+using namespace CoreThread;
+
+namespace {
+    // A sysfs tree in a temporary directory, removed again when the test ends
+    struct FakeSysfs {
+        explicit FakeSysfs(const std::string& name) : root(std::filesystem::temp_directory_path() / name) {
+            std::filesystem::remove_all(root);
+        }
+        ~FakeSysfs() {
+            std::error_code error;
+            std::filesystem::remove_all(root, error);
+        }
+
+        FakeSysfs(const FakeSysfs&) = delete;
+        FakeSysfs(FakeSysfs&&) = delete;
+        auto operator=(const FakeSysfs&) -> FakeSysfs& = delete;
+        auto operator=(FakeSysfs&&) -> FakeSysfs& = delete;
+
+        auto Write(const std::filesystem::path& relative, const std::string& content) const -> void {
+            const std::filesystem::path path = root / relative;
+            std::filesystem::create_directories(path.parent_path());
+            std::ofstream{ path } << content << '\n';
+        }
+
+        auto AddCpu(const std::uint32_t id, const std::uint32_t core, const std::uint32_t package) const -> void {
+            const std::filesystem::path topology = std::filesystem::path{ "devices/system/cpu" } / ("cpu" + std::to_string(id)) / "topology";
+            Write(topology / "core_id", std::to_string(core));
+            Write(topology / "physical_package_id", std::to_string(package));
+        }
+
+        std::filesystem::path root;
+    };
+}
+
+TEST_CASE("CpuTopology parses kernel cpu lists", "[CpuTopology]") {
+    REQUIRE(CpuTopology::ParseCpuList("0-3,8,10-11") == std::vector<std::uint32_t>{ 0, 1, 2, 3, 8, 10, 11 });
+    REQUIRE(CpuTopology::ParseCpuList("5") == std::vector<std::uint32_t>{ 5 });
+    REQUIRE(CpuTopology::ParseCpuList("2-2") == std::vector<std::uint32_t>{ 2 });
+    REQUIRE(CpuTopology::ParseCpuList("").empty());
+}
+
+TEST_CASE("CpuTopology skips malformed cpu list entries and keeps the rest", "[CpuTopology]") {
+    REQUIRE(CpuTopology::ParseCpuList("a,3") == std::vector<std::uint32_t>{ 3 });
+    REQUIRE(CpuTopology::ParseCpuList("1,,2") == std::vector<std::uint32_t>{ 1, 2 });
+    REQUIRE(CpuTopology::ParseCpuList("4-,6") == std::vector<std::uint32_t>{ 6 });
+    REQUIRE(CpuTopology::ParseCpuList("2-x,7") == std::vector<std::uint32_t>{ 7 });
+    REQUIRE(CpuTopology::ParseCpuList("3-1,0").size() == 1U);
+    REQUIRE(CpuTopology::ParseCpuList("-3").empty());
+    // A range up to the top of the id space is corrupt, not four billion CPUs
+    REQUIRE(CpuTopology::ParseCpuList("0-4294967295,9") == std::vector<std::uint32_t>{ 9 });
+}
+
+TEST_CASE("CpuTopology reads cores, siblings and NUMA nodes from sysfs", "[CpuTopology]") {
+    const FakeSysfs sysfs{ "SynapseCpuTopologyTest" };
+    // Two packages with two cores each, every core with two hyperthreads numbered like Linux does
+    sysfs.Write("devices/system/cpu/online", "0-7");
+    for (std::uint32_t cpu = 0; cpu < 8; cpu++) {
+        sysfs.AddCpu(cpu, cpu % 2, (cpu / 2) % 2);
+    }
+    sysfs.Write("devices/system/node/node0/cpulist", "0-1,4-5");
+    sysfs.Write("devices/system/node/node1/cpulist", "2-3,6-7");
+    // Not a node directory
+    sysfs.Write("devices/system/node/possible", "0-1");
+    sysfs.Write("class/net/eth0/device/local_cpulist", "2-3");
+
+    const CpuTopology topology = CpuTopology::Discover(sysfs.root);
+    REQUIRE(topology.GetCpus().size() == 8U);
+    REQUIRE(topology.GetNodeCount() == 2U);
+    REQUIRE(topology.GetNodeCpus(0) == std::vector<std::uint32_t>{ 0, 1, 4, 5 });
+    REQUIRE(topology.GetNodeCpus(1) == std::vector<std::uint32_t>{ 2, 3, 6, 7 });
+
+    // Same core id in another package is another core
+    REQUIRE(topology.GetSiblings(1) == std::vector<std::uint32_t>{ 1, 5 });
+    REQUIRE(topology.GetSiblings(6) == std::vector<std::uint32_t>{ 2, 6 });
+    REQUIRE(topology.GetPrimaryCpus() == std::vector<std::uint32_t>{ 0, 1, 2, 3 });
+    REQUIRE(topology.FindCpu(6)->package_id == 1U);
+    REQUIRE_FALSE(topology.FindCpu(8).has_value());
+    REQUIRE(topology.GetSiblings(8).empty());
+
+    REQUIRE(CpuTopology::GetNetworkDeviceCpus("eth0", sysfs.root) == std::vector<std::uint32_t>{ 2, 3 });
+    REQUIRE(CpuTopology::GetNetworkDeviceCpus("lo", sysfs.root).empty());
+}
+
+TEST_CASE("CpuTopology treats every CPU as its own core on node 0 without topology files", "[CpuTopology]") {
+    const FakeSysfs sysfs{ "SynapseCpuTopologyFlatTest" };
+    sysfs.Write("devices/system/cpu/online", "0-3");
+
+    const CpuTopology topology = CpuTopology::Discover(sysfs.root);
+    REQUIRE(topology.GetNodeCount() == 1U);
+    REQUIRE(topology.GetPrimaryCpus() == std::vector<std::uint32_t>{ 0, 1, 2, 3 });
+    REQUIRE(topology.GetNodeCpus(0).size() == 4U);
+
+    // Without an online list the topology falls back to the hardware concurrency
+    const CpuTopology fallback = CpuTopology::Discover(sysfs.root / "missing");
+    REQUIRE_FALSE(fallback.GetCpus().empty());
+    REQUIRE(fallback.GetNodeCount() == 1U);
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <initializer_list>
+#include <thread>
+#include <DeadlockProfiler.hpp>
+#include <LockId.hpp>
+#include <Log.hpp>
+#include <libassert/assert.hpp>
+
+using namespace CoreThread;
+
+namespace {
+    struct ProfiledOwner {};
+
+    auto Id(const std::uint32_t index) -> LockId {
+        return MakeLockId<ProfiledOwner>(index);
+    }
+
+    // Takes the locks in the given order and releases them in reverse
+    auto Nest(DeadLockProfiler& profiler, const std::initializer_list<std::uint32_t> indices) -> void {
+        for (const std::uint32_t index : indices) {
+            profiler.PushLock(Id(index));
+        }
+        for (auto index = std::rbegin(indices); index != std::rend(indices); ++index) {
+            profiler.PopLock(Id(*index));
+        }
+    }
+
+    // A detected cycle is reported and asserts, count it instead of stopping the test
+    auto IgnoreAssertion(const libassert::assertion_info&) -> void {}
+
+    struct AssertionsIgnored {
+        AssertionsIgnored() {
+            if (!Synapse::Log::Log::GetCoreLogger()) {
+                Synapse::Log::Log::Initialise(false);
+            }
+            libassert::set_failure_handler(&IgnoreAssertion);
+        }
+        ~AssertionsIgnored() {
+            libassert::set_failure_handler(&libassert::default_failure_handler);
+        }
+
+        AssertionsIgnored(const AssertionsIgnored&) = delete;
+        AssertionsIgnored(AssertionsIgnored&&) = delete;
+        auto operator=(const AssertionsIgnored&) -> AssertionsIgnored& = delete;
+        auto operator=(AssertionsIgnored&&) -> AssertionsIgnored& = delete;
+    };
+}
+
+TEST_CASE("DeadLockProfiler accepts locks taken in one order by every thread", "[DeadLockProfiler]") {
+    DeadLockProfiler profiler;
+    Nest(profiler, { 0U, 1U, 2U });
+    std::thread{ [&] { Nest(profiler, { 0U, 2U }); } }.join();
+    std::thread{ [&] { Nest(profiler, { 1U, 2U }); } }.join();
+    // Taking a lock again while holding it is not an edge
+    Nest(profiler, { 0U, 0U, 1U });
+    REQUIRE(profiler.GetCycleCount() == 0U);
+}
+
+TEST_CASE("DeadLockProfiler reorders locks first seen against their order without a false cycle", "[DeadLockProfiler]") {
+    DeadLockProfiler profiler;
+    // Seen last to first, so every edge below goes against the order the locks were added in
+    for (std::uint32_t index = 4U; index > 0U; --index) {
+        Nest(profiler, { index - 1U });
+    }
+    Nest(profiler, { 0U, 1U });
+    Nest(profiler, { 2U, 3U });
+    Nest(profiler, { 1U, 2U });
+    Nest(profiler, { 0U, 3U });
+    REQUIRE(profiler.GetCycleCount() == 0U);
+}
+
+TEST_CASE("DeadLockProfiler reports two locks taken in opposite orders", "[DeadLockProfiler]") {
+    const AssertionsIgnored ignored;
+    DeadLockProfiler profiler;
+    Nest(profiler, { 0U, 1U });
+    std::thread{ [&] { Nest(profiler, { 1U, 0U }); } }.join();
+    REQUIRE(profiler.GetCycleCount() == 1U);
+
+    // The inverted edge was left out, the original order is still accepted
+    Nest(profiler, { 0U, 1U });
+    REQUIRE(profiler.GetCycleCount() == 1U);
+}
+
+TEST_CASE("DeadLockProfiler reports a cycle through locks taken by different threads", "[DeadLockProfiler]") {
+    const AssertionsIgnored ignored;
+    DeadLockProfiler profiler;
+    Nest(profiler, { 0U, 1U });
+    std::thread{ [&] { Nest(profiler, { 1U, 2U }); } }.join();
+    std::thread{ [&] { Nest(profiler, { 2U, 3U }); } }.join();
+    REQUIRE(profiler.GetCycleCount() == 0U);
+
+    std::thread{ [&] { Nest(profiler, { 3U, 0U }); } }.join();
+    REQUIRE(profiler.GetCycleCount() == 1U);
+}
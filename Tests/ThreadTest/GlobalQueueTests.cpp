@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <Job/GlobalQueue.hpp>
+#include <Job/Job.hpp>
+#include <Job/JobQueue.hpp>
+#include <ThreadLocals.hpp>
+
+using namespace CoreThread::Job;
+
+TEST_CASE("GlobalQueue runs a job queue pushed by a thread that is not a worker", "[GlobalQueue]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::uint32_t runs = 0U;
+    // Push only, so the queue is handed to the GlobalQueue instead of running inline
+    REQUIRE(queue->Push(Job::Create([&] { ++runs; }), true));
+    REQUIRE(runs == 0U);
+
+    while (Global::GGlobalQueue->TryExecute()) {
+    }
+    REQUIRE(runs == 1U);
+    REQUIRE_FALSE(Global::GGlobalQueue->TryExecute());
+}
+
+TEST_CASE("GlobalQueue runs every standalone job exactly once across workers", "[GlobalQueue]") {
+    constexpr std::uint32_t WORKER_COUNT = 4U;
+    constexpr std::uint32_t JOB_COUNT = 20000U;
+    GlobalQueue global_queue{ WORKER_COUNT };
+    std::vector<std::atomic<std::uint32_t>> runs(JOB_COUNT);
+    std::atomic<std::uint32_t> done = 0U;
+
+    std::vector<std::thread> workers;
+    for (std::uint32_t worker = 0U; worker < WORKER_COUNT; ++worker) {
+        workers.emplace_back([&] {
+            global_queue.RegisterWorker();
+            while (done.load(std::memory_order_acquire) < JOB_COUNT) {
+                if (!global_queue.TryExecute()) {
+                    global_queue.Park(std::chrono::steady_clock::now() + std::chrono::milliseconds(1));
+                }
+            }
+        });
+    }
+    for (std::uint32_t i = 0U; i < JOB_COUNT; ++i) {
+        global_queue.Push(Job::Create([&runs, &done, i] {
+            runs[i].fetch_add(1U, std::memory_order_relaxed);
+            done.fetch_add(1U, std::memory_order_release);
+        }));
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (const std::atomic<std::uint32_t>& count : runs) {
+        REQUIRE(count.load() == 1U);
+    }
+}
+
+TEST_CASE("GlobalQueue hands a job queue back only to the worker that ran it from TryExecute", "[GlobalQueue]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::uint32_t worker = JobQueue::NO_WORKER;
+    std::uint32_t after_inline_run = 0U;
+    std::uint32_t after_scheduled_run = 0U;
+
+    std::thread{ [&] {
+        Global::GGlobalQueue->RegisterWorker();
+        worker = CoreThread::ThreadLocal::worker_index;
+        // Runs inline on the pushing thread, which says nothing about where the queue belongs
+        (void)queue->DoAsync([] {});
+        after_inline_run = queue->GetPreferredWorker();
+        (void)queue->Push(Job::Create([] {}), true);
+        while (Global::GGlobalQueue->TryExecute()) {
+        }
+        after_scheduled_run = queue->GetPreferredWorker();
+    } }.join();
+
+    REQUIRE(worker != JobQueue::NO_WORKER);
+    REQUIRE(after_inline_run == JobQueue::NO_WORKER);
+    REQUIRE(after_scheduled_run == worker);
+}
+
+TEST_CASE("GlobalQueue releases the job queues and jobs that never ran when destroyed", "[GlobalQueue]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    const std::shared_ptr<std::uint32_t> token = std::make_shared<std::uint32_t>(0U);
+    {
+        GlobalQueue global_queue{ 2U, std::chrono::hours(1) };
+        // Waits in the inbox of a worker that never runs, younger than the steal delay
+        queue->SetHomeWorker(1U);
+        global_queue.Push(queue);
+        global_queue.Push(Job::Create([token] {}));
+        REQUIRE(queue.use_count() == 2);
+        REQUIRE(token.use_count() == 2);
+    }
+    REQUIRE(queue.use_count() == 1);
+    REQUIRE(token.use_count() == 1);
+}
@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <Job/GlobalQueue.hpp>
+#include <Job/Job.hpp>
+#include <Job/JobQueue.hpp>
+
+using namespace CoreThread::Job;
+
+namespace {
+    auto RunScheduled() -> void {
+        while (Global::GGlobalQueue->TryExecute()) {
+        }
+    }
+
+    // Push only, the jobs pile up until the queue is run from the GlobalQueue
+    auto PushRecorded(JobQueue& queue, std::vector<std::uint32_t>& ran, const std::uint32_t id, const std::uint64_t key = 0U,
+            const bool sheddable = true) -> bool {
+        Job* job = Job::Create([&ran, id] { ran.push_back(id); });
+        job->SetCoalesceKey(key);
+        job->SetSheddable(sheddable);
+        return queue.Push(job, true);
+    }
+}
+
+TEST_CASE("JobQueue runs a job pushed into an idle queue on the pushing thread", "[JobQueue]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::vector<std::uint32_t> ran;
+    REQUIRE(queue->DoAsync([&ran] { ran.push_back(1U); }));
+    REQUIRE(ran == std::vector<std::uint32_t>{ 1U });
+}
+
+TEST_CASE("JobQueue with the Reject policy refuses sheddable jobs beyond its capacity", "[JobQueue]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>(JobQueueLimits{ 2, OverflowPolicy::Reject });
+    std::vector<std::uint32_t> ran;
+    REQUIRE(PushRecorded(*queue, ran, 0U));
+    REQUIRE(PushRecorded(*queue, ran, 1U));
+    REQUIRE_FALSE(PushRecorded(*queue, ran, 2U));
+    REQUIRE(PushRecorded(*queue, ran, 3U, 0U, false));
+    REQUIRE(queue->GetRejectedCount() == 1U);
+
+    RunScheduled();
+    REQUIRE(ran == std::vector<std::uint32_t>{ 0U, 1U, 3U });
+    REQUIRE(queue->GetShedCount() == 0U);
+}
+
+TEST_CASE("JobQueue with the DropOldest policy runs only the newest jobs of a flooded batch", "[JobQueue]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>(JobQueueLimits{ 3, OverflowPolicy::DropOldest });
+    std::vector<std::uint32_t> ran;
+    REQUIRE(PushRecorded(*queue, ran, 0U, 0U, false));
+    for (std::uint32_t id = 1U; id < 10U; ++id) {
+        REQUIRE(PushRecorded(*queue, ran, id));
+    }
+
+    RunScheduled();
+    // The non-sheddable job survives and takes one of the three places
+    REQUIRE(ran == std::vector<std::uint32_t>{ 0U, 8U, 9U });
+    REQUIRE(queue->GetShedCount() == 7U);
+    REQUIRE(queue->GetRejectedCount() == 0U);
+
+    // The counts were settled, the queue takes and runs jobs again
+    REQUIRE(queue->DoAsync([&ran] { ran.push_back(10U); }));
+    REQUIRE(ran.back() == 10U);
+}
+
+TEST_CASE("JobQueue with the Coalesce policy runs only the newest job per key", "[JobQueue]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>(JobQueueLimits{ 100, OverflowPolicy::Coalesce });
+    std::vector<std::uint32_t> ran;
+    REQUIRE(PushRecorded(*queue, ran, 0U, 1U));
+    REQUIRE(PushRecorded(*queue, ran, 1U, 2U));
+    REQUIRE(PushRecorded(*queue, ran, 2U));
+    REQUIRE(PushRecorded(*queue, ran, 3U, 1U));
+    REQUIRE(PushRecorded(*queue, ran, 4U));
+    REQUIRE(PushRecorded(*queue, ran, 5U, 2U));
+    REQUIRE(PushRecorded(*queue, ran, 6U, 1U, false));
+    REQUIRE(PushRecorded(*queue, ran, 7U, 1U));
+
+    RunScheduled();
+    // Key 0 is never coalesced, a non-sheddable job always runs
+    REQUIRE(ran == std::vector<std::uint32_t>{ 2U, 4U, 5U, 6U, 7U });
+    REQUIRE(queue->GetShedCount() == 3U);
+}
+
+TEST_CASE("JobQueue coalesces first and then drops the oldest down to the capacity", "[JobQueue]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>(JobQueueLimits{ 2, OverflowPolicy::Coalesce });
+    std::vector<std::uint32_t> ran;
+    REQUIRE(PushRecorded(*queue, ran, 0U));
+    REQUIRE(PushRecorded(*queue, ran, 1U, 7U));
+    REQUIRE(PushRecorded(*queue, ran, 2U));
+    REQUIRE(PushRecorded(*queue, ran, 3U, 7U));
+
+    RunScheduled();
+    REQUIRE(ran == std::vector<std::uint32_t>{ 2U, 3U });
+    REQUIRE(queue->GetShedCount() == 2U);
+}
+
+TEST_CASE("JobQueue records the queue delay of every job it ran", "[JobQueue]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::vector<std::uint32_t> ran;
+    for (std::uint32_t id = 0U; id < 5U; ++id) {
+        REQUIRE(PushRecorded(*queue, ran, id));
+    }
+    RunScheduled();
+
+    const Synapse::STL::Log2Histogram delays = queue->GetQueueDelay();
+    REQUIRE(delays.GetCount() == 5U);
+}
@@ -0,0 +1,137 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <Job/Job.hpp>
+#include <Job/JobQueue.hpp>
+#include <Job/JobTimer.hpp>
+
+using namespace CoreThread::Job;
+
+namespace {
+    auto Later(const std::chrono::milliseconds delay) -> std::chrono::steady_clock::time_point {
+        return std::chrono::steady_clock::now() + delay;
+    }
+}
+
+TEST_CASE("JobTimer pushes a job into its queue once the delay passed", "[JobTimer]") {
+    JobTimer timer{};
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::uint32_t runs = 0U;
+
+    const TimerHandle handle = timer.Reserve(50U, queue, Job::Create([&] { ++runs; }));
+    REQUIRE_FALSE(handle.IsNull());
+    timer.Distribute(std::chrono::steady_clock::now());
+    REQUIRE(runs == 0U);
+    timer.Distribute(Later(std::chrono::milliseconds(100)));
+    REQUIRE(runs == 1U);
+    timer.Distribute(Later(std::chrono::milliseconds(200)));
+    REQUIRE(runs == 1U);
+}
+
+TEST_CASE("JobTimer cancels a reserved job once and ignores stale handles", "[JobTimer]") {
+    JobTimer timer{};
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::uint32_t runs = 0U;
+
+    const TimerHandle cancelled = timer.Reserve(10U, queue, Job::Create([&] { ++runs; }));
+    REQUIRE(timer.Cancel(cancelled));
+    REQUIRE_FALSE(timer.Cancel(cancelled));
+    REQUIRE_FALSE(timer.Cancel(TimerHandle{}));
+    timer.Distribute(Later(std::chrono::milliseconds(100)));
+    REQUIRE(runs == 0U);
+
+    const TimerHandle fired = timer.Reserve(0U, queue, Job::Create([&] { ++runs; }));
+    // The wheel already advanced 100ms ahead, the job is due on the next tick after that
+    timer.Distribute(Later(std::chrono::milliseconds(200)));
+    REQUIRE(runs == 1U);
+    REQUIRE_FALSE(timer.Cancel(fired));
+
+    // The entries are reused with a new generation, the old handles do not reach the new job
+    const TimerHandle reused = timer.Reserve(10U, queue, Job::Create([&] { ++runs; }));
+    REQUIRE(reused != cancelled);
+    REQUIRE(reused != fired);
+    REQUIRE_FALSE(timer.Cancel(cancelled));
+    REQUIRE_FALSE(timer.Cancel(fired));
+    REQUIRE(timer.Cancel(reused));
+}
+
+TEST_CASE("JobTimer releases the job of a queue that no longer exists", "[JobTimer]") {
+    JobTimer timer{};
+    std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::uint32_t runs = 0U;
+
+    (void)timer.Reserve(0U, queue, Job::Create([&] { ++runs; }));
+    queue.reset();
+    timer.Distribute(Later(std::chrono::milliseconds(100)));
+    REQUIRE(runs == 0U);
+}
+
+TEST_CASE("JobTimer grows its table by chunks and hands out every entry once", "[JobTimer]") {
+    constexpr std::uint32_t TIMER_COUNT = 3000U;  // Spans three chunks
+    JobTimer timer{};
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::uint32_t runs = 0U;
+
+    std::set<std::uint32_t> indices;
+    for (std::uint32_t i = 0U; i < TIMER_COUNT; ++i) {
+        const TimerHandle handle = timer.Reserve(i % 50U, queue, Job::Create([&] { ++runs; }));
+        REQUIRE_FALSE(handle.IsNull());
+        REQUIRE(indices.insert(handle.index).second);
+    }
+    timer.Distribute(Later(std::chrono::milliseconds(100)));
+    REQUIRE(runs == TIMER_COUNT);
+
+    timer.Clear();
+    REQUIRE(runs == TIMER_COUNT);
+}
+
+TEST_CASE("JobTimer runs or cancels each job exactly once while Distribute races Reserve and Cancel", "[JobTimer]") {
+    constexpr std::uint32_t THREAD_COUNT = 4U;
+    constexpr std::uint32_t TIMERS_PER_THREAD = 20000U;
+    JobTimer timer{};
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::vector<std::atomic<std::uint32_t>> runs(THREAD_COUNT * TIMERS_PER_THREAD);
+    std::vector<std::uint8_t> cancelled(THREAD_COUNT * TIMERS_PER_THREAD, 0U);
+    std::atomic<std::uint32_t> reserving = THREAD_COUNT;
+    std::atomic<std::uint32_t> dropped = 0U;
+
+    // Fires while the other threads take entries from and return them to the free stack
+    std::thread distributor{ [&] {
+        while (reserving.load(std::memory_order_acquire) != 0U) {
+            timer.Distribute(Later(std::chrono::milliseconds(5)));
+        }
+    } };
+    std::vector<std::thread> threads;
+    for (std::uint32_t thread = 0U; thread < THREAD_COUNT; ++thread) {
+        threads.emplace_back([&, thread] {
+            for (std::uint32_t i = 0U; i < TIMERS_PER_THREAD; ++i) {
+                const std::uint32_t id = (thread * TIMERS_PER_THREAD) + i;
+                std::atomic<std::uint32_t>* run = &runs[id];
+                const TimerHandle handle = timer.Reserve(i % 3U, queue, Job::Create([run] { run->fetch_add(1U, std::memory_order_relaxed); }));
+                if (handle.IsNull()) {
+                    dropped.fetch_add(1U, std::memory_order_relaxed);
+                }
+                if ((i % 2U) == 0U) {
+                    cancelled[id] = timer.Cancel(handle) ? 1U : 0U;
+                }
+            }
+            reserving.fetch_sub(1U, std::memory_order_release);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    distributor.join();
+    timer.Distribute(Later(std::chrono::milliseconds(100)));
+
+    REQUIRE(dropped.load() == 0U);
+    for (std::size_t id = 0U; id < runs.size(); ++id) {
+        REQUIRE(runs[id].load() == (cancelled[id] != 0U ? 0U : 1U));
+    }
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <string_view>
+#include <LockId.hpp>
+
+using namespace CoreThread;
+
+// Named, the anonymous namespace is spelled differently by every compiler
+namespace LockIdTest {
+    class Inventory {
+    public:
+        [[nodiscard]] auto GetId(std::uint32_t index) const -> LockId { return LOCK_ID_OF(index); }
+    };
+
+    template <typename T>
+    class Pool {
+    public:
+        [[nodiscard]] auto GetId() -> LockId { return LOCK_ID_OF(0); }
+    };
+
+    class Session {
+    public:
+        [[nodiscard]] auto GetId() -> LockId { return LOCK_ID_OF(3); }
+    };
+}
+
+// Computed at compile time, reporting a cycle reads only static strings
+static_assert(MakeLockId<LockIdTest::Session>(1).GetIndex() == 1U);
+static_assert(!Detail::LOCK_OWNER_NAME<LockIdTest::Session>.empty());
+
+TEST_CASE("LOCK_ID_OF names the enclosing class and keeps the index", "[LockId]") {
+    const LockIdTest::Inventory inventory;
+    const LockId id = inventory.GetId(7);
+    // MSVC puts "class " in front of the name
+    REQUIRE(id.owner.ends_with("LockIdTest::Inventory"));
+    REQUIRE(id.owner.find("const") == std::string_view::npos);
+    REQUIRE(id.GetIndex() == 7U);
+    REQUIRE((id.value >> 32U) == Detail::LOCK_OWNER_HASH<LockIdTest::Inventory>);
+
+    LockIdTest::Pool<int> pool;
+    REQUIRE(pool.GetId().owner.ends_with("LockIdTest::Pool<int>"));
+}
+
+TEST_CASE("LockId tells the locks of different classes apart", "[LockId]") {
+    const LockIdTest::Inventory inventory;
+    LockIdTest::Session session;
+    // Same class, same owner and hash whichever index
+    REQUIRE(inventory.GetId(0).owner.data() == inventory.GetId(1).owner.data());
+    REQUIRE((inventory.GetId(0).value >> 32U) == (inventory.GetId(1).value >> 32U));
+    REQUIRE(inventory.GetId(0).value != inventory.GetId(1).value);
+
+    REQUIRE(session.GetId().owner != inventory.GetId(3).owner);
+    REQUIRE(Detail::LOCK_OWNER_HASH<LockIdTest::Inventory> != Detail::LOCK_OWNER_HASH<LockIdTest::Session>);
+    REQUIRE(Detail::LOCK_OWNER_HASH<LockIdTest::Pool<int>> != Detail::LOCK_OWNER_HASH<LockIdTest::Pool<float>>);
+    REQUIRE(session.GetId().value != inventory.GetId(3).value);
+    REQUIRE(session.GetId().value == MakeLockId<LockIdTest::Session>(3).value);
+}
@@ -0,0 +1,191 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <LockId.hpp>
+#include <LockProfiler.hpp>
+
+using namespace CoreThread;
+using namespace std::chrono_literals;
+
+namespace {
+    struct Inventory {};
+    struct Session {};
+    struct World {};
+
+    // Takes no time unless told to, so every count below is exact
+    struct FakePrimitive {
+        bool busy = false;
+        std::chrono::microseconds wait{};
+        std::uint32_t entered = 0;
+
+        auto TryEnter() -> bool { return !busy; }
+        auto Enter() -> void {
+            std::this_thread::sleep_for(wait);
+            ++entered;
+        }
+        auto Leave() -> void {}
+    };
+
+    struct UntriedPrimitive {
+        auto Enter() -> void { std::this_thread::sleep_for(1us); }
+        auto Leave() -> void {}
+    };
+
+    auto FindSite(const std::vector<LockSiteStatistics>& report, const LockId& id) -> const LockSiteStatistics* {
+        for (const LockSiteStatistics& site : report) {
+            if (site.id.value == id.value) {
+                return &site;
+            }
+        }
+        return nullptr;
+    }
+
+    // On a new thread, so it starts with its own hold sample counter and profiler buffer
+    template <typename TFunction>
+    auto RunOnNewThread(TFunction&& function) -> void {
+        std::thread thread{ std::forward<TFunction>(function) };
+        thread.join();
+    }
+}
+
+// Recording may allocate the entry of a lock, so the profiled calls must not claim noexcept
+static_assert(!noexcept(std::declval<ProfiledPrimitive<FakePrimitive>&>().Enter()));
+static_assert(!noexcept(std::declval<ProfiledPrimitive<FakePrimitive>&>().Leave()));
+
+TEST_CASE("LockProfiler merges the buffers of all threads into one report", "[LockProfiler]") {
+    constexpr std::uint32_t THREAD_COUNT = 4;
+    constexpr std::uint32_t ACQUISITIONS = 1000;
+    const LockId inventory = MakeLockId<Inventory>(0);
+    const LockId session = MakeLockId<Session>(1);
+    LockProfiler profiler;
+
+    std::vector<std::thread> threads;
+    for (std::uint32_t i = 0; i < THREAD_COUNT; i++) {
+        threads.emplace_back([&profiler, &inventory, &session, i] {
+            Synapse::STL::Concurrent::AcquireStatistics contended;
+            contended.contended = true;
+            contended.spin_rounds = 2;
+            contended.sleeps = 1;
+            for (std::uint32_t j = 0; j < ACQUISITIONS; j++) {
+                profiler.RecordAcquire(inventory, 1000ns * (i + 1), contended);
+                profiler.RecordAcquire(session, 0ns, Synapse::STL::Concurrent::AcquireStatistics{});
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    const std::vector<LockSiteStatistics> report = profiler.GetReport();
+    REQUIRE(report.size() == 2U);
+    // Waited on the longest first
+    REQUIRE(report[0].id.value == inventory.value);
+    REQUIRE(report[0].id.owner == inventory.owner);
+    REQUIRE(report[0].acquisitions == THREAD_COUNT * ACQUISITIONS);
+    REQUIRE(report[0].contended_acquisitions == THREAD_COUNT * ACQUISITIONS);
+    REQUIRE(report[0].spin_rounds == 2U * THREAD_COUNT * ACQUISITIONS);
+    REQUIRE(report[0].sleeps == THREAD_COUNT * ACQUISITIONS);
+    REQUIRE(report[0].total_wait == 1000ns * ACQUISITIONS * (1 + 2 + 3 + 4));
+    REQUIRE(report[0].max_wait == 4000ns);
+    REQUIRE(report[0].wait_histogram.GetCount() == THREAD_COUNT * ACQUISITIONS);
+
+    // Uncontended acquisitions are counted without a wait
+    REQUIRE(report[1].id.value == session.value);
+    REQUIRE(report[1].acquisitions == THREAD_COUNT * ACQUISITIONS);
+    REQUIRE(report[1].contended_acquisitions == 0U);
+    REQUIRE(report[1].total_wait == 0ns);
+    REQUIRE(report[1].wait_histogram.GetCount() == 0U);
+}
+
+TEST_CASE("LockProfiler samples one uncontended hold in HOLD_SAMPLE_PERIOD per thread", "[LockProfiler]") {
+    RunOnNewThread([] {
+        std::uint32_t sampled = 0;
+        for (std::uint32_t i = 0; i < 4 * LockProfiler::HOLD_SAMPLE_PERIOD; i++) {
+            sampled += LockProfiler::SampleHold() ? 1 : 0;
+        }
+        REQUIRE(sampled == 4U);
+    });
+
+    const LockId world = MakeLockId<World>(0);
+    Global::GLockProfiler->Reset();
+    RunOnNewThread([&world] {
+        FakePrimitive primitive;
+        ProfiledPrimitive<FakePrimitive> profiled{ primitive, world };
+        for (std::uint32_t i = 0; i < 2 * LockProfiler::HOLD_SAMPLE_PERIOD; i++) {
+            profiled.Enter();
+            profiled.Leave();
+        }
+        // Only the holds of the sampled acquisitions are timed, the primitive was never waited on
+        REQUIRE(primitive.entered == 0U);
+    });
+    const std::vector<LockSiteStatistics> report = Global::GLockProfiler->GetReport();
+    const LockSiteStatistics* site = FindSite(report, world);
+    REQUIRE(site != nullptr);
+    REQUIRE(site->acquisitions == 2U * LockProfiler::HOLD_SAMPLE_PERIOD);
+    REQUIRE(site->contended_acquisitions == 0U);
+    REQUIRE(site->hold_samples == 2U);
+    REQUIRE(site->hold_histogram.GetCount() == 2U);
+    Global::GLockProfiler->Reset();
+}
+
+TEST_CASE("ProfiledPrimitive times every contended wait and its hold", "[LockProfiler]") {
+    const LockId world = MakeLockId<World>(1);
+    Global::GLockProfiler->Reset();
+    RunOnNewThread([&world] {
+        FakePrimitive primitive{ .busy = true, .wait = 100us };
+        ProfiledPrimitive<FakePrimitive> profiled{ primitive, world };
+        for (std::uint32_t i = 0; i < 3; i++) {
+            profiled.Enter();
+            profiled.Leave();
+        }
+        REQUIRE(primitive.entered == 3U);
+
+        // Without TryEnter contention is unknown, the wait is still timed
+        UntriedPrimitive untried;
+        ProfiledPrimitive<UntriedPrimitive> profiled_untried{ untried, MakeLockId<World>(2) };
+        profiled_untried.Enter();
+        profiled_untried.Leave();
+    });
+
+    const std::vector<LockSiteStatistics> report = Global::GLockProfiler->GetReport();
+    const LockSiteStatistics* site = FindSite(report, world);
+    REQUIRE(site != nullptr);
+    REQUIRE(site->acquisitions == 3U);
+    REQUIRE(site->contended_acquisitions == 3U);
+    REQUIRE(site->total_wait >= 300us);
+    REQUIRE(site->hold_samples == 3U);
+
+    const LockSiteStatistics* untried_site = FindSite(report, MakeLockId<World>(2));
+    REQUIRE(untried_site != nullptr);
+    REQUIRE(untried_site->acquisitions == 1U);
+    REQUIRE(untried_site->contended_acquisitions == 0U);
+    REQUIRE(untried_site->total_wait >= 1us);
+    REQUIRE(untried_site->hold_samples == 1U);
+    Global::GLockProfiler->Reset();
+}
+
+TEST_CASE("LockProfiler Reset clears every thread and keeps recording afterwards", "[LockProfiler]") {
+    const LockId inventory = MakeLockId<Inventory>(0);
+    LockProfiler profiler;
+    RunOnNewThread([&profiler, &inventory] {
+        profiler.RecordAcquire(inventory, 10ns, Synapse::STL::Concurrent::AcquireStatistics{});
+        profiler.RecordHold(inventory, 20ns);
+    });
+    profiler.RecordAcquire(inventory, 10ns, Synapse::STL::Concurrent::AcquireStatistics{});
+    REQUIRE(profiler.GetReport().size() == 1U);
+    REQUIRE(profiler.GetReport()[0].acquisitions == 2U);
+
+    profiler.Reset();
+    REQUIRE(profiler.GetReport().empty());
+
+    // The thread keeps its buffer, only the sites were dropped
+    profiler.RecordHold(inventory, 30ns);
+    const std::vector<LockSiteStatistics> report = profiler.GetReport();
+    REQUIRE(report.size() == 1U);
+    REQUIRE(report[0].acquisitions == 0U);
+    REQUIRE(report[0].hold_samples == 1U);
+    REQUIRE(report[0].max_hold == 30ns);
+}
@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <Lock.hpp>
+#include <ThreadManager.hpp>
+
+using namespace CoreThread;
+
+namespace {
+    class Counter {
+    public:
+        // Takes the write lock again and then the read lock while writing
+        auto Add() -> void {
+            WRITE_LOCK;
+            AddNested();
+        }
+
+        auto Get() -> std::uint32_t {
+            READ_LOCK;
+            return GetNested();
+        }
+
+        auto WriteLock() -> void { _locks[0].WriteLock(LOCK_ID_OF(0)); }
+        auto WriteUnlock() -> void { _locks[0].WriteUnlock(LOCK_ID_OF(0)); }
+        auto ReadLock() -> void { _locks[0].ReadLock(LOCK_ID_OF(0)); }
+        auto ReadUnlock() -> void { _locks[0].ReadUnlock(LOCK_ID_OF(0)); }
+
+    private:
+        auto AddNested() -> void {
+            WRITE_LOCK;
+            m_value = GetNested() + 1U;
+        }
+
+        auto GetNested() -> std::uint32_t {
+            READ_LOCK;
+            return m_value;
+        }
+
+        USE_LOCK;
+        std::uint32_t m_value = 0U;
+    };
+}
+
+TEST_CASE("Lock lets the writing thread lock again for writing and reading", "[Lock]") {
+    ThreadManager::InitialiseTLS();
+    Counter counter;
+    counter.Add();
+    REQUIRE(counter.Get() == 1U);
+
+    counter.WriteLock();
+    counter.WriteLock();
+    counter.ReadLock();
+    std::atomic<bool> read = false;
+    std::thread reader{ [&] {
+        ThreadManager::InitialiseTLS();
+        counter.ReadLock();
+        read.store(true, std::memory_order_release);
+        counter.ReadUnlock();
+    } };
+
+    // Held until the outermost write lock is released
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE_FALSE(read.load(std::memory_order_acquire));
+    counter.ReadUnlock();
+    counter.WriteUnlock();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE_FALSE(read.load(std::memory_order_acquire));
+    counter.WriteUnlock();
+    reader.join();
+    REQUIRE(read.load());
+}
+
+TEST_CASE("Lock lets a reader read again while a writer waits", "[Lock]") {
+    ThreadManager::InitialiseTLS();
+    Counter counter;
+    std::atomic<bool> written = false;
+
+    counter.ReadLock();
+    std::thread writer{ [&] {
+        ThreadManager::InitialiseTLS();
+        counter.Add();
+        written.store(true, std::memory_order_release);
+    } };
+    // The writer is queued by now and holds new readers back, but not this one
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    counter.ReadLock();
+    REQUIRE_FALSE(written.load(std::memory_order_acquire));
+    counter.ReadUnlock();
+    counter.ReadUnlock();
+    writer.join();
+    REQUIRE(counter.Get() == 1U);
+}
+
+TEST_CASE("Lock keeps nested writes from several threads exclusive", "[Lock]") {
+    constexpr std::uint32_t THREAD_COUNT = 4U;
+    constexpr std::uint32_t ADDS_PER_THREAD = 10000U;
+    Counter counter;
+
+    std::vector<std::thread> threads;
+    for (std::uint32_t thread = 0U; thread < THREAD_COUNT; ++thread) {
+        threads.emplace_back([&] {
+            ThreadManager::InitialiseTLS();
+            for (std::uint32_t i = 0U; i < ADDS_PER_THREAD; ++i) {
+                counter.Add();
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    ThreadManager::InitialiseTLS();
+    REQUIRE(counter.Get() == THREAD_COUNT * ADDS_PER_THREAD);
+}
@@ -0,0 +1,129 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <Job/GlobalQueue.hpp>
+#include <Job/ParallelFor.hpp>
+
+using namespace CoreThread::Job;
+
+namespace {
+    struct Range {
+        std::size_t begin;
+        std::size_t end;
+        std::size_t grain;
+    };
+
+    // Uneven grains leave a short last chunk, a grain of 0 is taken as 1
+    constexpr std::array<Range, 6> RANGES{ {
+        { 0, 1000, 7 },
+        { 3, 100, 1 },
+        { 10, 523, 64 },
+        { 0, 17, 16 },
+        { 5, 40, 0 },
+        { 0, 4096, 1000 },
+    } };
+
+    // The helper jobs of a loop that found no chunk left to take
+    auto RunScheduled() -> void {
+        while (Global::GGlobalQueue->TryExecute()) {
+        }
+    }
+
+    // Counts the calls per index, so a skipped or repeated index shows
+    auto RequireEachIndexOnce(const Range& range) -> void {
+        std::vector<std::atomic<std::uint32_t>> visits(range.end);
+        ParallelFor(range.begin, range.end, range.grain, [&visits](std::size_t index) {
+            visits[index].fetch_add(1, std::memory_order_relaxed);
+        });
+        for (std::size_t index = 0; index < range.end; index++) {
+            REQUIRE(visits[index].load() == ((index < range.begin) ? 0U : 1U));
+        }
+    }
+}
+
+TEST_CASE("ParallelFor calls nothing for an empty or reversed range", "[ParallelFor]") {
+    std::uint32_t calls = 0;
+    ParallelFor(5, 5, 1, [&calls](std::size_t) { calls++; });
+    ParallelFor(7, 3, 1, [&calls](std::size_t) { calls++; });
+    ParallelFor(std::vector<int>{}, 4, [&calls](int) { calls++; });
+    REQUIRE(calls == 0U);
+    REQUIRE_FALSE(Global::GGlobalQueue->TryExecute());
+}
+
+TEST_CASE("ParallelFor runs a single chunk on the calling thread without helpers", "[ParallelFor]") {
+    const std::thread::id caller = std::this_thread::get_id();
+    std::vector<std::size_t> visited;
+    bool other_thread = false;
+    ParallelFor(4, 12, 8, [&](std::size_t index) {
+        visited.push_back(index);
+        other_thread = other_thread || (std::this_thread::get_id() != caller);
+    });
+    REQUIRE(visited == std::vector<std::size_t>{ 4, 5, 6, 7, 8, 9, 10, 11 });
+    REQUIRE_FALSE(other_thread);
+    REQUIRE_FALSE(Global::GGlobalQueue->TryExecute());
+}
+
+TEST_CASE("ParallelFor visits every index once on the calling thread alone", "[ParallelFor]") {
+    // No thread runs the queue, the caller takes every chunk and the helpers start too late
+    for (const Range& range : RANGES) {
+        RequireEachIndexOnce(range);
+        RunScheduled();
+    }
+}
+
+TEST_CASE("ParallelFor calls the function for every element of a range", "[ParallelFor]") {
+    std::vector<std::uint32_t> values(333);
+    for (std::uint32_t i = 0; i < values.size(); i++) {
+        values[i] = i;
+    }
+    ParallelFor(values, 10, [](std::uint32_t& value) { value *= 2; });
+    RunScheduled();
+    for (std::uint32_t i = 0; i < values.size(); i++) {
+        REQUIRE(values[i] == 2 * i);
+    }
+}
+
+TEST_CASE("ParallelFor visits every index once while registered workers help", "[ParallelFor]") {
+    constexpr std::uint32_t WORKER_COUNT = 3;
+    constexpr std::uint32_t RUN_COUNT = 20;
+    std::atomic<bool> stop = false;
+    std::atomic<std::uint32_t> worker_loops_done = 0;
+    std::vector<std::thread> workers;
+    for (std::uint32_t worker = 0; worker < WORKER_COUNT; worker++) {
+        workers.emplace_back([&stop, &worker_loops_done, worker] {
+            Global::GGlobalQueue->RegisterWorker();
+            // One worker runs loops itself, its helpers go onto its own deque for the others to steal
+            if (worker == 0) {
+                for (std::uint32_t run = 0; run < RUN_COUNT; run++) {
+                    std::vector<std::atomic<std::uint32_t>> visits(1000);
+                    ParallelFor(0, visits.size(), 3, [&visits](std::size_t index) {
+                        visits[index].fetch_add(1, std::memory_order_relaxed);
+                    });
+                    if (std::ranges::all_of(visits, [](const std::atomic<std::uint32_t>& count) { return count.load() == 1U; })) {
+                        worker_loops_done.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+            while (!stop.load(std::memory_order_acquire)) {
+                (void)Global::GGlobalQueue->TryExecute();
+            }
+        });
+    }
+
+    for (std::uint32_t run = 0; run < RUN_COUNT; run++) {
+        for (const Range& range : RANGES) {
+            RequireEachIndexOnce(range);
+        }
+    }
+    stop.store(true, std::memory_order_release);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    RunScheduled();
+    REQUIRE(worker_loops_done.load() == RUN_COUNT);
+}
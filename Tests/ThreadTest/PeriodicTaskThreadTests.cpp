@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <Job/GlobalQueue.hpp>
+#include <PeriodicTaskThread.hpp>
+
+using namespace CoreThread;
+
+namespace {
+    // The runs are pushed to the GlobalQueue as jobs, this thread works as the only worker
+    auto RunFor(const std::chrono::milliseconds duration) -> void {
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end) {
+            if (!Global::GGlobalQueue->TryExecute()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    auto RunUntil(const std::atomic<std::uint32_t>& runs, const std::uint32_t count) -> bool {
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (runs.load(std::memory_order_relaxed) < count) {
+            if (std::chrono::steady_clock::now() > end) {
+                return false;
+            }
+            RunFor(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+}
+
+TEST_CASE("PeriodicTaskThread refuses a second task under a registered id", "[PeriodicTaskThread]") {
+    PeriodicTaskThread thread;
+    REQUIRE(thread.Initialise());
+    REQUIRE(thread.RegisterPeriodicTask(1U, 1000U, [](std::uint32_t, std::chrono::steady_clock::time_point) {}));
+    REQUIRE_FALSE(thread.RegisterPeriodicTask(1U, 1000U, [](std::uint32_t, std::chrono::steady_clock::time_point) {}));
+    REQUIRE(thread.RegisterPeriodicTask(2U, 1000U, [](std::uint32_t, std::chrono::steady_clock::time_point) {}));
+
+    // Free again once killed
+    thread.KillPeriodicTask(1U);
+    REQUIRE(thread.RegisterPeriodicTask(1U, 1000U, [](std::uint32_t, std::chrono::steady_clock::time_point) {}));
+    thread.Release();
+}
+
+TEST_CASE("PeriodicTaskThread runs a fixed rate task on the grid of its registration", "[PeriodicTaskThread]") {
+    constexpr std::uint32_t PERIOD = 5U;
+    PeriodicTaskThread thread;
+    REQUIRE(thread.Initialise());
+    std::atomic<std::uint32_t> runs = 0U;
+    std::mutex due_mutex;
+    std::vector<std::chrono::steady_clock::time_point> due_times;
+
+    REQUIRE(thread.RegisterPeriodicTask(7U, PERIOD, [&](const std::uint32_t id, const std::chrono::steady_clock::time_point due) {
+        REQUIRE(id == 7U);
+        {
+            std::scoped_lock lock{ due_mutex };
+            due_times.push_back(due);
+        }
+        runs.fetch_add(1U, std::memory_order_relaxed);
+    }));
+    REQUIRE(RunUntil(runs, 5U));
+    thread.Release();
+    RunFor(std::chrono::milliseconds(10));
+
+    // Skipped runs leave gaps, but every due time stays a whole number of periods after the first
+    for (std::size_t run = 1U; run < due_times.size(); ++run) {
+        const std::chrono::nanoseconds since_first = due_times[run] - due_times.front();
+        REQUIRE(since_first > std::chrono::nanoseconds::zero());
+        REQUIRE((since_first % std::chrono::milliseconds(PERIOD)) == std::chrono::nanoseconds::zero());
+    }
+}
+
+TEST_CASE("PeriodicTaskThread stops running a killed task", "[PeriodicTaskThread]") {
+    PeriodicTaskThread thread;
+    REQUIRE(thread.Initialise());
+    std::atomic<std::uint32_t> runs = 0U;
+    REQUIRE(thread.RegisterPeriodicTask(3U, 2U, [&](std::uint32_t, std::chrono::steady_clock::time_point) {
+        runs.fetch_add(1U, std::memory_order_relaxed);
+    }, PeriodicTaskMode::FixedDelay));
+    REQUIRE(RunUntil(runs, 3U));
+
+    thread.KillPeriodicTask(3U);
+    // A run dispatched before the kill was picked up may still come
+    RunFor(std::chrono::milliseconds(20));
+    const std::uint32_t after_kill = runs.load(std::memory_order_relaxed);
+    RunFor(std::chrono::milliseconds(50));
+    REQUIRE(runs.load(std::memory_order_relaxed) == after_kill);
+    thread.Release();
+}
@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <Job/GlobalQueue.hpp>
+#include <Job/TaskGraph.hpp>
+
+using namespace CoreThread::Job;
+
+namespace {
+    // The helper jobs of a run that found no task left to take
+    auto RunScheduled() -> void {
+        while (Global::GGlobalQueue->TryExecute()) {
+        }
+    }
+}
+
+TEST_CASE("TaskGraph runs an empty graph", "[TaskGraph]") {
+    TaskGraph graph;
+    graph.Run();
+    REQUIRE(graph.GetTaskCount() == 0U);
+}
+
+TEST_CASE("TaskGraph runs every task after its dependencies on the calling thread alone", "[TaskGraph]") {
+    TaskGraph graph;
+    std::vector<TaskGraph::TaskId> ran;
+    const TaskGraph::TaskId first = graph.Add([&] { ran.push_back(0U); });
+    const TaskGraph::TaskId left = graph.Add([&] { ran.push_back(1U); });
+    const TaskGraph::TaskId right = graph.Add([&] { ran.push_back(2U); });
+    const TaskGraph::TaskId last = graph.Add([&] { ran.push_back(3U); });
+    graph.Precede(first, left);
+    graph.Precede(first, right);
+    graph.Precede(left, last);
+    graph.Precede(right, last);
+    REQUIRE(graph.GetTaskCount() == 4U);
+
+    graph.Run();
+    REQUIRE(ran.size() == 4U);
+    REQUIRE(ran.front() == first);
+    REQUIRE(ran.back() == last);
+    RunScheduled();
+
+    // Reused, the dependencies hold again
+    ran.clear();
+    graph.Run();
+    REQUIRE(ran.size() == 4U);
+    REQUIRE(ran.front() == first);
+    REQUIRE(ran.back() == last);
+    RunScheduled();
+}
+
+TEST_CASE("TaskGraph keeps the dependencies while workers run the tasks", "[TaskGraph]") {
+    constexpr std::uint32_t WORKER_COUNT = 3U;
+    constexpr std::uint32_t LAYER_COUNT = 8U;
+    constexpr std::uint32_t LAYER_WIDTH = 16U;
+    constexpr std::uint32_t RUN_COUNT = 50U;
+    TaskGraph graph;
+    std::vector<std::atomic<std::uint32_t>> runs(LAYER_COUNT * LAYER_WIDTH);
+    std::atomic<std::uint32_t> too_early = 0U;
+
+    // Every task of a layer waits for every task of the layer before it
+    for (std::uint32_t layer = 0U; layer < LAYER_COUNT; ++layer) {
+        for (std::uint32_t column = 0U; column < LAYER_WIDTH; ++column) {
+            const std::uint32_t id = (layer * LAYER_WIDTH) + column;
+            const TaskGraph::TaskId task = graph.Add([&runs, &too_early, layer, id] {
+                const std::uint32_t run = runs[id].load(std::memory_order_relaxed);
+                if (layer > 0U) {
+                    for (std::uint32_t before = (layer - 1U) * LAYER_WIDTH; before < layer * LAYER_WIDTH; ++before) {
+                        if (runs[before].load(std::memory_order_relaxed) != run + 1U) {
+                            too_early.fetch_add(1U, std::memory_order_relaxed);
+                        }
+                    }
+                }
+                runs[id].store(run + 1U, std::memory_order_relaxed);
+            });
+            REQUIRE(task == id);
+            if (layer > 0U) {
+                for (std::uint32_t before = (layer - 1U) * LAYER_WIDTH; before < layer * LAYER_WIDTH; ++before) {
+                    graph.Precede(before, task);
+                }
+            }
+        }
+    }
+
+    std::atomic<bool> stop = false;
+    std::vector<std::thread> workers;
+    for (std::uint32_t worker = 0U; worker < WORKER_COUNT; ++worker) {
+        workers.emplace_back([&] {
+            while (!stop.load(std::memory_order_acquire)) {
+                (void)Global::GGlobalQueue->TryExecute();
+            }
+        });
+    }
+    for (std::uint32_t run = 0U; run < RUN_COUNT; ++run) {
+        graph.Run();
+    }
+    stop.store(true, std::memory_order_release);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    RunScheduled();
+
+    REQUIRE(too_early.load() == 0U);
+    for (const std::atomic<std::uint32_t>& count : runs) {
+        REQUIRE(count.load() == RUN_COUNT);
+    }
+}
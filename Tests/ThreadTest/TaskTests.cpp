@@ -0,0 +1,211 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <Job/GlobalQueue.hpp>
+#include <Job/JobQueue.hpp>
+#include <Job/JobTimer.hpp>
+#include <Job/Task.hpp>
+#include <ThreadLocals.hpp>
+
+using namespace CoreThread;
+using namespace CoreThread::Job;
+
+namespace {
+    auto RunScheduled() -> void {
+        while (Global::GGlobalQueue->TryExecute()) {
+        }
+    }
+
+    // A coroutine parameter lives in the frame, it is destroyed only when the frame is
+    struct FrameProbe {
+        explicit FrameProbe(bool& destroyed) noexcept : destroyed(&destroyed) {}
+        FrameProbe(FrameProbe&& other) noexcept : destroyed(std::exchange(other.destroyed, nullptr)) {}
+        ~FrameProbe() {
+            if (destroyed != nullptr) {
+                *destroyed = true;
+            }
+        }
+
+        FrameProbe(const FrameProbe&) = delete;
+        auto operator=(const FrameProbe&) -> FrameProbe& = delete;
+        auto operator=(FrameProbe&&) -> FrameProbe& = delete;
+
+        bool* destroyed;
+    };
+
+    auto Count(std::uint32_t& runs, FrameProbe) -> Task<void> {
+        runs++;
+        co_return;
+    }
+
+    auto Receive(Completion<std::uint32_t>& completion, std::uint32_t& received, FrameProbe) -> Task<void> {
+        received = co_await completion;
+    }
+
+    auto Sleep(std::chrono::milliseconds delay, std::uint32_t& steps) -> Task<void> {
+        steps++;
+        co_await After(delay);
+        steps++;
+    }
+
+    // The queue each part of the coroutines ran on
+    struct QueueTrace {
+        JobQueue* before_move = nullptr;
+        JobQueue* after_move = nullptr;
+        JobQueue* continuation = nullptr;
+    };
+
+    auto MoveTo(std::shared_ptr<JobQueue> queue, QueueTrace& trace) -> Task<std::uint32_t> {
+        trace.before_move = ThreadLocal::CurrentJobQueue;
+        co_await ResumeOn(std::move(queue));
+        trace.after_move = ThreadLocal::CurrentJobQueue;
+        co_return 42;
+    }
+
+    auto AwaitMove(std::shared_ptr<JobQueue> queue, QueueTrace& trace, std::uint32_t& result) -> Task<void> {
+        result = co_await MoveTo(std::move(queue), trace);
+        trace.continuation = ThreadLocal::CurrentJobQueue;
+    }
+
+    auto Produce(Completion<std::uint32_t>& completion) -> Task<std::uint32_t> {
+        co_return co_await completion;
+    }
+
+    auto Double(std::uint32_t value) -> Task<std::uint32_t> {
+        co_return value * 2;
+    }
+
+    auto Collect(std::vector<Task<std::uint32_t>> tasks, std::vector<std::uint32_t>& results) -> Task<void> {
+        results = co_await WhenAll(std::move(tasks));
+    }
+
+    auto Fail(const char* message) -> Task<std::uint32_t> {
+        throw std::runtime_error(message);
+        co_return 0;
+    }
+
+    auto PassOn(const char* message) -> Task<std::uint32_t> {
+        co_return co_await Fail(message);
+    }
+
+    auto Recover(std::string& caught) -> Task<void> {
+        try {
+            (void)co_await PassOn("handshake failed");
+        }
+        catch (const std::runtime_error& error) {
+            caught = error.what();
+        }
+    }
+}
+
+TEST_CASE("Spawn runs a task on its queue and the finished task frees its frame", "[Task]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::uint32_t runs = 0;
+    bool destroyed = false;
+    // Pushed into an idle queue, so it runs on this thread before Spawn returns
+    Spawn(queue, Count(runs, FrameProbe{ destroyed }));
+    REQUIRE(runs == 1U);
+    REQUIRE(destroyed);
+
+    // A task that is not started is freed by its owner
+    destroyed = false;
+    {
+        const Task<void> unstarted = Count(runs, FrameProbe{ destroyed });
+        REQUIRE_FALSE(unstarted.IsDone());
+    }
+    REQUIRE(runs == 1U);
+    REQUIRE(destroyed);
+}
+
+TEST_CASE("After resumes the task on its queue once the JobTimer distributes it", "[Task]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::uint32_t steps = 0;
+    Spawn(queue, Sleep(std::chrono::milliseconds(200), steps));
+    REQUIRE(steps == 1U);
+
+    Global::GJobTimer->Distribute(std::chrono::steady_clock::now());
+    REQUIRE(steps == 1U);
+    Global::GJobTimer->Distribute(std::chrono::steady_clock::now() + std::chrono::milliseconds(500));
+    REQUIRE(steps == 2U);
+
+    // No delay, no suspension
+    Spawn(queue, Sleep(std::chrono::milliseconds(0), steps));
+    REQUIRE(steps == 4U);
+}
+
+TEST_CASE("ResumeOn moves the task and its awaiter continues back on its own queue", "[Task]") {
+    const std::shared_ptr<JobQueue> home = std::make_shared<JobQueue>();
+    const std::shared_ptr<JobQueue> other = std::make_shared<JobQueue>();
+    QueueTrace trace;
+    std::uint32_t result = 0;
+    Spawn(home, AwaitMove(other, trace, result));
+    REQUIRE(trace.before_move == home.get());
+    REQUIRE(trace.after_move == nullptr);
+
+    // Pushed from inside the home queue's run, both queues go through the GlobalQueue
+    RunScheduled();
+    REQUIRE(trace.after_move == other.get());
+    REQUIRE(trace.continuation == home.get());
+    REQUIRE(result == 42U);
+}
+
+TEST_CASE("Completion hands over a value completed before or after the await", "[Task]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    Completion<std::uint32_t> completion;
+    std::uint32_t received = 0;
+    bool destroyed = false;
+
+    completion.Complete(7);
+    Spawn(queue, Receive(completion, received, FrameProbe{ destroyed }));
+    REQUIRE(received == 7U);
+    REQUIRE(destroyed);
+
+    // Rearmed, the task waits without blocking and continues when another thread completes it
+    completion.Reset();
+    destroyed = false;
+    Spawn(queue, Receive(completion, received, FrameProbe{ destroyed }));
+    REQUIRE(received == 7U);
+    REQUIRE_FALSE(destroyed);
+    std::thread producer{ [&completion] { completion.Complete(9); } };
+    producer.join();
+    REQUIRE(received == 9U);
+    REQUIRE(destroyed);
+}
+
+TEST_CASE("WhenAll returns the results in the order of the tasks", "[Task]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::array<Completion<std::uint32_t>, 3> completions;
+    std::vector<Task<std::uint32_t>> tasks;
+    for (Completion<std::uint32_t>& completion : completions) {
+        tasks.push_back(Produce(completion));
+    }
+    tasks.push_back(Double(20));
+    std::vector<std::uint32_t> results;
+    Spawn(queue, Collect(std::move(tasks), results));
+    REQUIRE(results.empty());
+
+    // Finished in another order than awaited, the last one resumes the awaiting task
+    completions[2].Complete(3);
+    completions[0].Complete(1);
+    REQUIRE(results.empty());
+    completions[1].Complete(2);
+    REQUIRE(results == std::vector<std::uint32_t>{ 1, 2, 3, 40 });
+
+    Spawn(queue, Collect({}, results));
+    REQUIRE(results.empty());
+}
+
+TEST_CASE("An exception thrown in a task reaches the coroutine awaiting it", "[Task]") {
+    const std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::string caught;
+    // Through two awaits, the middle task passes it on without handling it
+    Spawn(queue, Recover(caught));
+    REQUIRE(caught == "handshake failed");
+}
@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <Job/GlobalQueue.hpp>
+#include <Job/Job.hpp>
+#include <TickLoop.hpp>
+
+using namespace CoreThread;
+
+TEST_CASE("TickLoop runs the phases in order and ends the job phase before the send reserve", "[TickLoop]") {
+    const TickLoopOptions options{ .period = std::chrono::milliseconds(50), .send_reserve = std::chrono::milliseconds(10) };
+    TickLoop loop{ options };
+    std::vector<TickPhase> ran;
+    std::uint32_t jobs = 0U;
+    TickContext job_context{};
+    std::chrono::steady_clock::time_point assembly_start{};
+
+    loop.SetPhase(TickPhase::NetworkReceive, [&](const TickContext&) { ran.push_back(TickPhase::NetworkReceive); });
+    loop.SetPhase(TickPhase::JobProcessing, [&](const TickContext& context) {
+        ran.push_back(TickPhase::JobProcessing);
+        job_context = context;
+        // Run by the loop thread in the rest of the job phase
+        Global::GGlobalQueue->Push(Job::Job::Create([&] { ++jobs; }));
+    });
+    loop.SetPhase(TickPhase::PacketAssembly, [&](const TickContext&) {
+        ran.push_back(TickPhase::PacketAssembly);
+        assembly_start = std::chrono::steady_clock::now();
+    });
+    loop.SetPhase(TickPhase::Send, [&](const TickContext&) { ran.push_back(TickPhase::Send); });
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const TickStatistics statistics = loop.RunTick(3U, start);
+
+    REQUIRE(ran == std::vector<TickPhase>{ TickPhase::NetworkReceive, TickPhase::JobProcessing, TickPhase::PacketAssembly, TickPhase::Send });
+    REQUIRE(jobs == 1U);
+    REQUIRE(job_context.tick == 3U);
+    REQUIRE(job_context.deadline == start + options.period);
+    REQUIRE(job_context.job_deadline <= job_context.deadline - options.send_reserve);
+    // The job phase works until its deadline
+    REQUIRE(assembly_start >= job_context.job_deadline);
+    REQUIRE(statistics.tick == 3U);
+    REQUIRE(statistics.overrun == std::chrono::nanoseconds::zero());
+    REQUIRE(loop.GetTickCount() == 1U);
+    REQUIRE(loop.GetOverrunCount() == 0U);
+}
+
+TEST_CASE("TickLoop counts a tick that finished past its deadline as an overrun", "[TickLoop]") {
+    TickLoop loop{ TickLoopOptions{ .period = std::chrono::milliseconds(10) } };
+    loop.SetPhase(TickPhase::Send, [](const TickContext& context) { std::this_thread::sleep_until(context.deadline + std::chrono::milliseconds(5)); });
+
+    const TickStatistics statistics = loop.RunTick(0U, std::chrono::steady_clock::now());
+    REQUIRE(statistics.overrun >= std::chrono::milliseconds(5));
+    REQUIRE(statistics.duration >= statistics.overrun);
+    REQUIRE(loop.GetOverrunCount() == 1U);
+}
+
+TEST_CASE("TickLoop runs ticks on a grid with a worker until stopped", "[TickLoop]") {
+    constexpr std::uint64_t TICK_COUNT = 5U;
+    constexpr std::uint32_t JOBS_PER_TICK = 100U;
+    const TickLoopOptions options{ .period = std::chrono::milliseconds(10), .send_reserve = std::chrono::milliseconds(2) };
+    TickLoop loop{ options };
+    std::atomic<std::uint32_t> jobs = 0U;
+    std::vector<TickStatistics> ticks;
+
+    loop.SetPhase(TickPhase::JobProcessing, [&](const TickContext&) {
+        for (std::uint32_t job = 0U; job < JOBS_PER_TICK; ++job) {
+            Global::GGlobalQueue->Push(Job::Job::Create([&] { jobs.fetch_add(1U, std::memory_order_relaxed); }));
+        }
+    });
+    loop.SetTickObserver([&](const TickStatistics& statistics) {
+        ticks.push_back(statistics);
+        if (ticks.size() == TICK_COUNT) {
+            loop.Stop();
+        }
+    });
+
+    std::thread worker{ [&] { loop.RunWorker(); } };
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    loop.Run();
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    worker.join();
+
+    REQUIRE(ticks.size() == TICK_COUNT);
+    for (std::uint64_t tick = 0U; tick < TICK_COUNT; ++tick) {
+        REQUIRE(ticks[tick].tick == tick);
+        REQUIRE(ticks[tick].skipped_ticks == 0U);
+    }
+    // Five ticks on the grid span at least four periods, and every job ran in the job phase of its tick
+    REQUIRE(end - start >= options.period * (TICK_COUNT - 1U));
+    REQUIRE(jobs.load() == TICK_COUNT * JOBS_PER_TICK);
+    REQUIRE(loop.GetTickCount() == TICK_COUNT);
+}
+
+TEST_CASE("TickLoop drops the ticks it fell too far behind on", "[TickLoop]") {
+    const TickLoopOptions options{ .period = std::chrono::milliseconds(10), .max_catch_up_ticks = 1U };
+    TickLoop loop{ options };
+    std::vector<TickStatistics> ticks;
+
+    loop.SetTickObserver([&](const TickStatistics& statistics) {
+        ticks.push_back(statistics);
+        if (ticks.size() == 1U) {
+            // Five periods behind, more than the one tick the loop may catch up on
+            std::this_thread::sleep_for(options.period * 5);
+        } else {
+            loop.Stop();
+        }
+    });
+    loop.Run();
+
+    REQUIRE(ticks.size() == 2U);
+    REQUIRE(ticks[1].skipped_ticks >= 3U);
+    REQUIRE(ticks[1].tick == 1U + ticks[1].skipped_ticks);
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace CoreThread {
+    struct LogicalCpu {
+        std::uint32_t id = 0;
+        std::uint32_t core_id = 0;     ///< Physical core within the package, hyperthread siblings share it.
+        std::uint32_t package_id = 0;
+        std::uint32_t numa_node = 0;
+    };
+
+    /**
+     * @brief Layout of the online CPUs: physical cores, hyperthread siblings and NUMA nodes.
+     *
+     * Read from `/sys/devices/system/cpu` and `/sys/devices/system/node` on Linux. Elsewhere,
+     * or when sysfs is not readable, every CPU counts as its own core on node 0.
+     */
+    class CpuTopology {
+    public:
+        [[nodiscard]] static auto Discover() -> CpuTopology;
+
+        /**
+         * @param sysfs_root Directory standing in for `/sys`, e.g. a copy taken from another machine.
+         */
+        [[nodiscard]] static auto Discover(const std::filesystem::path& sysfs_root) -> CpuTopology;
+
+        /**
+         * @brief CPUs close to a network interface, e.g. "eth0", for the IO threads serving its queues.
+         * @return Empty if the device reports no locality, e.g. a virtual interface.
+         */
+        [[nodiscard]] static auto GetNetworkDeviceCpus(std::string_view interface_name,
+                const std::filesystem::path& sysfs_root = "/sys") -> std::vector<std::uint32_t>;
+
+        /**
+         * @brief Parses a kernel cpu list such as "0-3,8,10-11".
+         */
+        [[nodiscard]] static auto ParseCpuList(std::string_view list) -> std::vector<std::uint32_t>;
+
+        [[nodiscard]] auto GetCpus() const noexcept -> const std::vector<LogicalCpu>& { return m_cpus; }
+        [[nodiscard]] auto GetNodeCount() const noexcept -> std::uint32_t { return m_node_count; }
+
+        /**
+         * @brief One CPU per physical core, the lowest numbered sibling, so workers do not share a core.
+         */
+        [[nodiscard]] auto GetPrimaryCpus() const -> std::vector<std::uint32_t>;
+        [[nodiscard]] auto GetNodeCpus(std::uint32_t node) const -> std::vector<std::uint32_t>;
+        [[nodiscard]] auto GetSiblings(std::uint32_t cpu) const -> std::vector<std::uint32_t>;
+        [[nodiscard]] auto FindCpu(std::uint32_t cpu) const -> std::optional<LogicalCpu>;
+
+    private:
+        std::vector<LogicalCpu> m_cpus;  ///< Sorted by id.
+        std::uint32_t m_node_count = 1;
+    };
+}
@@ -1,32 +1,65 @@
 #pragma once
-#include <map>
+#include <cstdint>
+#include <memory>
 #include <mutex>
-#include <set>
-#include <stack>
+#include <string>
 #include <vector>
 #include <ankerl/unordered_dense.h>
+#include "LockId.hpp"
 
 namespace CoreThread {
-
+    /**
+     * @brief Detects lock order inversions: taking B while holding A after some thread took A while holding B.
+     *
+     * Every lock taken while another is held adds the edge held -> taken to a graph over dense lock
+     * indices. The graph is kept in a topological order, maintained incrementally (Pearce-Kelly), so a
+     * new edge only searches the locks between its ends in that order instead of the whole graph.
+     * An edge that closes a cycle is reported with its path and asserts.
+     *
+     * Each thread caches the lock indices and edges it has seen; acquisitions that add nothing new
+     * never take the profiler's mutex. The thread's held locks live in a fixed array, see `ThreadLocal::lock_stack`.
+     */
     class DeadLockProfiler {
     public:
-        auto PushLock(const std::string &name) -> void;
-        auto PopLock(const std::string &name) -> void;
-        auto CheckCycle() -> void;
+        DeadLockProfiler();
+
+        auto PushLock(const LockId &id) -> void;
+        auto PopLock(const LockId &id) -> void;
+
+        /// Lock order inversions reported so far, their edges were left out of the graph
+        [[nodiscard]] auto GetCycleCount() -> std::uint32_t;
 
     private:
-        auto Dfs(std::int32_t index) -> void;
+        struct ThreadCache;
+
+        auto GetThreadCache() -> ThreadCache&;
+        auto GetIndex(ThreadCache &cache, const LockId &id) -> std::int32_t;
+        // Under m_lock
+        auto AddEdge(std::int32_t from, std::int32_t to) -> void;
+        auto SearchForward(std::int32_t from, std::int32_t upper_bound, std::int32_t target) -> bool;
+        auto SearchBackward(std::int32_t from, std::int32_t lower_bound) -> void;
+        auto Reorder() -> void;
+        auto ReportCycle(std::int32_t from, std::int32_t to) const -> void;
+
+        auto GetName(std::int32_t index) const -> std::string;
 
-        ankerl::unordered_dense::map<std::string, std::int32_t> m_name_to_id;
-        ankerl::unordered_dense::map<std::int32_t, std::string> m_id_to_name;
-        std::map<std::int32_t, std::set<std::int32_t>> m_lock_history;
+        const std::uint64_t m_generation; // Tells the thread caches of different profilers apart
 
         std::mutex m_lock;
+        ankerl::unordered_dense::map<std::uint64_t, std::int32_t> m_id_to_index; // LockId value to the dense index used by the graph
+        std::vector<LockId> m_index_to_id;
+        std::vector<std::vector<std::int32_t>> m_successors;
+        std::vector<std::vector<std::int32_t>> m_predecessors;
+        ankerl::unordered_dense::set<std::uint64_t> m_edges;      // Held index in the upper half, taken index in the lower
+        std::vector<std::int32_t> m_order;                         // Position of each lock in the topological order
+        std::uint32_t m_cycle_count = 0;
 
-        std::vector<std::int32_t> m_discovered_order; // Array recording the order in which nodes were found
-        std::int32_t m_discovered_count = 0;          // Order in which nodes are discovered
-        std::vector<bool> m_finished;                 // Whether Dfs(i) has terminated
-        std::vector<std::int32_t> m_parent;
+        // Scratch of AddEdge, kept to not allocate per edge
+        std::vector<bool> m_visited;
+        std::vector<std::int32_t> m_parent;   // Forward search tree, to print the cycle
+        std::vector<std::int32_t> m_forward;  // Reached from the new edge's head, ordered before its tail
+        std::vector<std::int32_t> m_backward; // Reaching the new edge's tail, ordered after its head
+        std::vector<std::int32_t> m_pending;  // Search stack, then the positions handed out by Reorder
     };
 }
 
@@ -0,0 +1,63 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace CoreThread::Job {
+    struct AdmissionOptions {
+        /// Queue delay the job queues may keep standing, above it the controller sheds load
+        std::chrono::nanoseconds target_delay = std::chrono::milliseconds(5);
+        /// How often the admitted share is adjusted, a burst shorter than this is absorbed
+        std::chrono::nanoseconds interval = std::chrono::milliseconds(100);
+        /// Never shed everything, the queue delay is only measured while some work still comes in
+        std::uint32_t min_admit_permille = 50;
+        std::uint32_t admit_increase_permille = 50;  ///< Added per interval below the target.
+    };
+
+    /**
+     * @brief Decides whether new work is let in, from the queue delay the job queues measure.
+     *
+     * Every `JobQueue` reports how long its oldest job of a batch waited. What counts is the smallest
+     * of these delays over an interval: a burst drains and gets a small delay back, only a queue
+     * that stays long keeps the minimum above the target. Then the admitted share is cut by a
+     * quarter per interval, and grows back additively once the minimum is below the target again.
+     *
+     * Callers ask `Admit` at the edges where work enters the server, e.g. before turning a request
+     * into jobs, and answer the rejected requests with an error instead of queueing them.
+     * Lock-free, any thread.
+     */
+    class AdmissionController {
+    public:
+        explicit AdmissionController(AdmissionOptions options = {});
+
+        AdmissionController(const AdmissionController&) = delete;
+        AdmissionController(AdmissionController&&) = delete;
+        auto operator=(const AdmissionController&) -> AdmissionController& = delete;
+        auto operator=(AdmissionController&&) -> AdmissionController& = delete;
+
+        auto RecordDelay(std::chrono::nanoseconds delay, std::chrono::steady_clock::time_point now) -> void;
+
+        /**
+         * @brief Whether to accept a unit of new work, true for the admitted share of the calls.
+         */
+        [[nodiscard]] auto Admit() -> bool;
+
+        [[nodiscard]] auto GetAdmitPermille() const -> std::uint32_t;
+        [[nodiscard]] auto IsOverloaded() const -> bool;
+        [[nodiscard]] auto GetRejectedCount() const -> std::uint64_t;
+
+    private:
+        auto Adjust(std::int64_t min_delay) -> void;
+
+        const AdmissionOptions m_options;
+        std::atomic<std::int64_t> m_interval_end;     ///< Steady clock nanoseconds, the thread that moves it adjusts.
+        std::atomic<std::int64_t> m_interval_min;     ///< Smallest delay of the interval in nanoseconds.
+        std::atomic<std::uint32_t> m_admit_permille = 1000;
+        std::atomic<std::uint64_t> m_rejected_count = 0;
+    };
+}
+
+namespace Global {
+    inline std::unique_ptr<CoreThread::Job::AdmissionController> GAdmissionController = std::make_unique<CoreThread::Job::AdmissionController>();
+}
\ No newline at end of file
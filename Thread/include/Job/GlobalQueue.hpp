@@ -1,19 +1,83 @@
 #pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <memory>
-#include "LockQueue.h"
+#include <thread>
+#include <Concurrent/WorkStealingScheduler.hpp>
 
 namespace CoreThread::Job {
+    class Job;
     class JobQueue;
+
+    /**
+     * @brief Hands job queues that are ready to run, and standalone jobs, to the worker threads.
+     *
+     * Backed by a `WorkStealingScheduler`: a worker pushes the job queues it makes ready onto
+     * its own deque, idle workers steal from the others and park when there is nothing to
+     * steal. Threads that did not register as workers push into the shared injection queue.
+     *
+     * A scheduled job queue is kept alive by a reference stored in the job queue itself, so
+     * the deques only move raw pointers. Standalone jobs, e.g. the shares of a `ParallelFor`,
+     * travel through the same deques with the low pointer bit set.
+     *
+     * Job queues have soft affinity: one that becomes ready goes to its preferred worker, see
+     * `JobQueue::GetPreferredWorker`, so it runs where its data is cache-hot. Other workers
+     * only take it after it waited `affinity_steal_delay`.
+     */
     class GlobalQueue {
     public:
-        GlobalQueue();
+        static constexpr std::chrono::nanoseconds DEFAULT_AFFINITY_STEAL_DELAY = std::chrono::microseconds(100);
+
+        explicit GlobalQueue(std::uint32_t worker_count = std::max(std::thread::hardware_concurrency(), 1U),
+                std::chrono::nanoseconds affinity_steal_delay = DEFAULT_AFFINITY_STEAL_DELAY);
         ~GlobalQueue();
 
-        void Push(std::shared_ptr<JobQueue> job_queue);
-        std::shared_ptr<JobQueue> Pop();
+        GlobalQueue(const GlobalQueue&) = delete;
+        GlobalQueue(GlobalQueue&&) = delete;
+        auto operator=(const GlobalQueue &) -> GlobalQueue & = delete;
+        auto operator=(GlobalQueue &&) -> GlobalQueue & = delete;
+
+        /**
+         * @brief Gives the calling thread a deque and an inbox of its own, see `ThreadLaunchOptions::global_queue_worker`.
+         *
+         * Only for threads that keep running `TryExecute`, e.g. in `ThreadManager::DoGlobalQueueWork`. Job
+         * queues are handed back to the worker that ran them, on any other thread they would wait out
+         * the steal delay.
+         */
+        auto RegisterWorker() -> void;
+
+        auto Push(std::shared_ptr<JobQueue> job_queue) -> void;
+
+        /**
+         * @brief Runs a job on whichever worker gets to it first, the worker releases it afterwards.
+         */
+        auto Push(Job* job) -> void;
+
+        /**
+         * @brief Runs one scheduled job queue or job on the calling thread.
+         * @return `false` if there was nothing to run.
+         */
+        auto TryExecute() -> bool;
+
+        /**
+         * @brief Blocks the calling worker until a job queue is pushed or the deadline passes.
+         */
+        auto Park(std::chrono::steady_clock::time_point deadline) -> void;
+
+        /**
+         * @brief Wakes every parked worker, e.g. on shutdown.
+         */
+        auto Stop() -> void;
+
+        [[nodiscard]] auto GetWorkerCount() const noexcept -> std::uint32_t;
+        auto SetAffinityStealDelay(std::chrono::nanoseconds delay) noexcept -> void;
 
     private:
-        LockQueue<std::shared_ptr<JobQueue>> m_job_queues;
+        // Set on standalone jobs, job queues and jobs are both at least 8 byte aligned
+        static constexpr std::uintptr_t JOB_TAG = 1;
+
+        Synapse::STL::Concurrent::WorkStealingScheduler<std::uintptr_t> m_scheduler;
     };
 }
 
@@ -1,26 +1,107 @@
 #pragma once
-#include <functional>
+#include <chrono>
+#include <cstdint>
 #include <memory>
-
+#include <utility>
+#include <Concurrent/IntrusiveMpscQueue.hpp>
+#include <Concurrent/ThreadCachedPool.hpp>
+#include <InplaceFunction.hpp>
 
 namespace CoreThread::Job {
-    class Job {
+    /**
+     * @brief Unit of work executed by a JobQueue, pooled and linked intrusively.
+     *
+     * The callable is stored inline, a lambda of up to `INLINE_SIZE` bytes is posted without
+     * touching the heap. Jobs are created with `Create` and handed back with `Release` after
+     * they ran, the storage comes from a pool cached per thread. A job with an owner runs
+     * only while the owner is alive and keeps it alive for the duration of the call.
+     */
+    class Job final : public Synapse::STL::Concurrent::IntrusiveMpscNode {
     public:
-        explicit Job(std::function<void()>&& callback) : m_callback(std::move(callback)) {
+        static constexpr std::size_t INLINE_SIZE = 48;
+        using Callback = Synapse::STL::InplaceFunction<void(), INLINE_SIZE>;
+        using Pool = Synapse::STL::Concurrent::ThreadCachedPool<Job>;
+
+        template <typename TCallable>
+        [[nodiscard]] static auto Create(TCallable&& callable) -> Job* {
+            return Pool::Create(Callback(std::forward<TCallable>(callable)));
         }
 
+        template <typename TCallable>
+        [[nodiscard]] static auto Create(std::weak_ptr<void> owner, TCallable&& callable) -> Job* {
+            Job* job = Pool::Create(Callback(std::forward<TCallable>(callable)));
+            job->m_owner = std::move(owner);
+            job->m_has_owner = true;
+            return job;
+        }
+
+        /**
+         * @brief Member function job, holds only a weak reference to the owner.
+         */
         template <typename T, typename Ret, typename... Args>
-        Job(std::shared_ptr<T> owner, Ret (T::*memFunc)(Args...), Args&&... args) {
-            m_callback = [owner, memFunc, args...]() {
-                (owner.get()->*memFunc)(args...);
-            };
+        [[nodiscard]] static auto Create(const std::shared_ptr<T>& owner, Ret (T::*memFunc)(Args...), Args&&... args) -> Job* {
+            T* raw = owner.get();
+            return Create(std::weak_ptr<void>(owner), [raw, memFunc, ... args = std::forward<Args>(args)]() mutable {
+                (raw->*memFunc)(std::move(args)...);
+            });
+        }
+
+        static auto Release(Job* job) -> void {
+            Pool::Destroy(job);
+        }
+
+        explicit Job(Callback&& callback) noexcept : m_callback(std::move(callback)) {
+        }
+        ~Job() = default;
+
+        Job(const Job&) = delete;
+        Job(Job&&) = delete;
+        auto operator=(const Job&) -> Job& = delete;
+        auto operator=(Job&&) -> Job& = delete;
+
+        /**
+         * @brief Jobs of one queue with the same non-zero key may be coalesced, see `OverflowPolicy::Coalesce`.
+         */
+        auto SetCoalesceKey(std::uint64_t key) noexcept -> void {
+            m_coalesce_key = key;
+        }
+        [[nodiscard]] auto GetCoalesceKey() const noexcept -> std::uint64_t {
+            return m_coalesce_key;
+        }
+
+        /**
+         * @brief A job that must run, e.g. a coroutine resume, is never rejected or dropped by a bounded JobQueue.
+         */
+        auto SetSheddable(bool sheddable) noexcept -> void {
+            m_sheddable = sheddable;
+        }
+        [[nodiscard]] auto IsSheddable() const noexcept -> bool {
+            return m_sheddable;
+        }
+
+        // Set by JobQueue::Push, for the queue delay
+        auto SetEnqueueTime(std::chrono::steady_clock::time_point time) noexcept -> void {
+            m_enqueue_time = time;
+        }
+        [[nodiscard]] auto GetEnqueueTime() const noexcept -> std::chrono::steady_clock::time_point {
+            return m_enqueue_time;
         }
 
-        auto Execute() const -> void {
-            m_callback();
+        auto Execute() -> void {
+            if (!m_has_owner) {
+                m_callback();
+            }
+            else if (const std::shared_ptr<void> owner = m_owner.lock()) {
+                m_callback();
+            }
         }
 
     private:
-        std::function<void()> m_callback;
+        Callback m_callback;
+        std::weak_ptr<void> m_owner;
+        std::chrono::steady_clock::time_point m_enqueue_time;
+        std::uint64_t m_coalesce_key = 0;
+        bool m_has_owner = false;
+        bool m_sheddable = true;
     };
 }
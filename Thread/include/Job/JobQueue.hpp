@@ -1,43 +1,133 @@
 #pragma once
-#include <RedoObjectPool.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <memory>
-#include "JobTimer.h"
-#include "LockQueue.h"
+#include <utility>
+#include <vector>
+#include <Concurrent/IntrusiveMpscQueue.hpp>
+#include <Concurrent/WorkStealingScheduler.hpp>
+#include <Log2Histogram.hpp>
+#include "Job.hpp"
+#include "JobTimer.hpp"
 
 namespace CoreThread::Job {
-    class Job;
+    class GlobalQueue;
+
+    /**
+     * @brief What a bounded JobQueue does with the jobs beyond its capacity.
+     */
+    enum class OverflowPolicy : std::uint8_t {
+        Reject,      ///< `Push` refuses the job and releases it.
+        DropOldest,  ///< The executing thread drops the oldest waiting jobs down to the capacity before running them.
+        Coalesce     ///< Of the waiting jobs with the same coalesce key only the newest runs, then as DropOldest.
+    };
+
+    struct JobQueueLimits {
+        std::int32_t capacity = std::numeric_limits<std::int32_t>::max();  ///< Jobs waiting or running, unbounded by default.
+        OverflowPolicy policy = OverflowPolicy::Reject;
+    };
+
+    /**
+     * @brief Runs its jobs one after another, on whichever thread pushed into the empty queue or on a GlobalQueue worker.
+     *
+     * Every job is timestamped when pushed. The executing thread records how long the jobs of a batch
+     * waited into the queue delay histogram and reports the oldest one to `Global::GAdmissionController`.
+     *
+     * A queue may be bounded with `JobQueueLimits`. The bound is soft: producers check the count
+     * without reserving a slot, and DropOldest and Coalesce shed when a batch is taken, since only
+     * the executing thread may pop. Shedding in batches keeps a flooded queue from running stale
+     * work, the latency of what does run stays near one batch.
+     *
+     * When handed to the GlobalQueue the queue goes back to the worker that ran it last, or to its
+     * home worker if one is set, e.g. the worker polling the connection a queue belongs to.
+     */
     class JobQueue : public std::enable_shared_from_this<JobQueue> {
     public:
-        void DoAsync(std::function<void()>&& callback) {
-            Push(CoreMemory::ObjectPool<Job>::MakeShared(std::move(callback)));
+        JobQueue() = default;
+        explicit JobQueue(JobQueueLimits limits);
+        ~JobQueue();
+
+        template <typename TCallable>
+        bool DoAsync(TCallable&& callback) {
+            return Push(Job::Create(std::forward<TCallable>(callback)));
         }
 
         template <typename T, typename Ret, typename... Args>
-        void DoAsync(Ret (T::*memFunc)(Args...), Args... args) {
+        bool DoAsync(Ret (T::*memFunc)(Args...), Args... args) {
             std::shared_ptr<T> owner = std::static_pointer_cast<T>(shared_from_this());
-            Push(CoreMemory::ObjectPool<Job>::MakeShared(owner, memFunc, std::forward<Args>(args)...));
+            return Push(Job::Create(owner, memFunc, std::move(args)...));
+        }
+
+        /**
+         * @brief Posts a job that supersedes the waiting jobs with the same `key` when the queue coalesces, e.g. the latest position of an entity.
+         */
+        template <typename TCallable>
+        bool DoAsyncCoalesced(std::uint64_t key, TCallable&& callback) {
+            Job* job = Job::Create(std::forward<TCallable>(callback));
+            job->SetCoalesceKey(key);
+            return Push(job);
         }
 
-        void DoTimer(std::uint64_t tick_after, std::function<void()>&& callback) {
-            std::shared_ptr<Job> job = CoreMemory::ObjectPool<Job>::MakeShared(std::move(callback));
-            Global::GJobTimer->Reserve(tick_after, shared_from_this(), job);
+        template <typename TCallable>
+        TimerHandle DoTimer(std::uint64_t tick_after, TCallable&& callback) {
+            return Global::GJobTimer->Reserve(tick_after, shared_from_this(), Job::Create(std::forward<TCallable>(callback)));
         }
 
         template <typename T, typename Ret, typename... Args>
-        void DoTimer(std::uint64_t tick_after, Ret (T::*memFunc)(Args...), Args... args) {
+        TimerHandle DoTimer(std::uint64_t tick_after, Ret (T::*memFunc)(Args...), Args... args) {
             std::shared_ptr<T> owner = std::static_pointer_cast<T>(shared_from_this());
-            std::shared_ptr<Job> job = CoreMemory::ObjectPool<Job>::MakeShared(owner, memFunc, std::forward<Args>(args)...);
-            Global::GJobTimer->Reserve(tick_after, shared_from_this(), job);
+            return Global::GJobTimer->Reserve(tick_after, shared_from_this(), Job::Create(owner, memFunc, std::move(args)...));
         }
 
-        void ClearJobs() { m_jobs.Clear(); }
+        /**
+         * @brief Drops the jobs that have not run yet, only from a job running on this queue.
+         */
+        void ClearJobs();
 
     public:
-        void Push(std::shared_ptr<Job> job, bool push_only = false);
+        /**
+         * @brief Queues a job, the queue releases it after it ran.
+         * @return `false` if the queue is full and rejects it, the job is released already.
+         */
+        bool Push(Job* job, bool push_only = false);
         void Execute();
 
+        /// How long the jobs waited before their batch started, in nanoseconds
+        [[nodiscard]] Synapse::STL::Log2Histogram GetQueueDelay() const;
+        [[nodiscard]] std::uint64_t GetRejectedCount() const;
+        /// Dropped or coalesced by the overflow policy, not counting ClearJobs
+        [[nodiscard]] std::uint64_t GetShedCount() const;
+
+        /**
+         * @brief Pins the preferred worker instead of following the last one, `NO_WORKER` to unpin. Any thread.
+         */
+        void SetHomeWorker(std::uint32_t worker);
+        /// Worker the GlobalQueue hands this queue to, `NO_WORKER` if it has none
+        [[nodiscard]] std::uint32_t GetPreferredWorker() const;
+
+        static constexpr std::uint32_t NO_WORKER = Synapse::STL::Concurrent::WorkStealingScheduler<std::uintptr_t>::NO_WORKER;
+
     protected:
-        LockQueue<std::shared_ptr<Job>> m_jobs;
+        // Drained only by the thread running Execute, the job count elects that thread
+        Synapse::STL::Concurrent::IntrusiveMpscQueue<Job> m_jobs;
         std::atomic<std::int32_t> m_job_count = 0;
+        std::int32_t m_dropped_count = 0; ///< Jobs dropped by ClearJobs or shed, executing thread only.
+
+    private:
+        void RecordDelay(const std::vector<Job*>& jobs);
+        void ShedOverflow(std::vector<Job*>& jobs);
+
+        const JobQueueLimits m_limits{};
+        std::array<std::atomic<std::uint64_t>, Synapse::STL::Log2Histogram::BUCKET_COUNT> m_queue_delay{};
+        std::atomic<std::uint64_t> m_rejected_count = 0;
+        std::atomic<std::uint64_t> m_shed_count = 0;
+        std::atomic<std::uint32_t> m_home_worker = NO_WORKER;
+        std::atomic<std::uint32_t> m_last_worker = NO_WORKER;  ///< Set by GlobalQueue::TryExecute, only workers drain the inbox it is handed to.
+
+        friend class GlobalQueue;
+        // Keeps the queue alive while it waits in the GlobalQueue, which only holds raw pointers
+        std::shared_ptr<JobQueue> m_scheduled_reference;
     };
 }
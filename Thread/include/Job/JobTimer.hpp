@@ -1,41 +1,123 @@
 #pragma once
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
-#include <queue>
+#include <mutex>
+#include <vector>
+#include <Concurrent/IntrusiveMpscQueue.hpp>
+#include <TimingWheel.hpp>
 
-#include "Job.h"
-#include "Lock.h"
+#include "Job.hpp"
 
 
 namespace CoreThread::Job {
     class JobQueue;
-    struct JobData {
-        JobData(std::weak_ptr<JobQueue> owner, std::shared_ptr<Job> job) : m_owner(owner), m_job(job) {
-        }
 
-        std::weak_ptr<JobQueue> m_owner;
-        std::shared_ptr<Job> m_job;
-    };
-
-    struct TimerItem {
-        bool operator<(const TimerItem& other) const {
-            return m_execute_tick > other.m_execute_tick;
-        }
+    /**
+     * @brief Reference to a reserved job, used to cancel it.
+     *
+     * Generation 0 is never issued, a default constructed handle is the null handle.
+     */
+    struct TimerHandle {
+        std::uint32_t index = 0;
+        std::uint32_t generation = 0;
 
-
-        std::chrono::time_point<std::chrono::steady_clock> m_execute_tick;
-        JobData* m_job_data = nullptr;
+        [[nodiscard]] constexpr auto IsNull() const noexcept -> bool { return generation == 0; }
+        constexpr auto operator==(const TimerHandle& other) const noexcept -> bool = default;
     };
 
+    /**
+     * @brief Runs jobs after a delay by pushing them into their JobQueue once they are due.
+     *
+     * Timers live in a table of entries that never moves. Reserving takes a free entry with
+     * one compare-exchange and links it into a lock-free insertion queue, so reserving
+     * threads never wait on each other or on `Distribute`. Cancelling is one
+     * compare-exchange on the entry, the cancelled job is released when the entry comes up.
+     *
+     * `Distribute` runs on one thread at a time. It moves the new entries into a hierarchical
+     * timing wheel with millisecond ticks, advances the wheel to the current time and pushes
+     * the due jobs as one batch.
+     */
     class JobTimer {
     public:
-        void Reserve(std::uint64_t tick_after, std::weak_ptr<JobQueue> owner, std::shared_ptr<Job> job);
-        void Distribute(std::chrono::time_point<std::chrono::steady_clock> now);
-        void Clear();
+        JobTimer();
+        ~JobTimer();
+
+        JobTimer(const JobTimer&) = delete;
+        JobTimer(JobTimer&&) = delete;
+        auto operator=(const JobTimer&) -> JobTimer& = delete;
+        auto operator=(JobTimer&&) -> JobTimer& = delete;
+
+        /**
+         * @brief Pushes the job into the owner after `tick_after` milliseconds, the timer owns the job until then.
+         * @return Handle to cancel the job, the null handle if the timer table is full and the job was dropped.
+         */
+        auto Reserve(std::uint64_t tick_after, std::weak_ptr<JobQueue> owner, Job* job) -> TimerHandle;
+
+        /**
+         * @brief Keeps a reserved job from running, any thread.
+         * @return `true` if the job had not been pushed yet and will not be.
+         */
+        auto Cancel(TimerHandle handle) -> bool;
+
+        auto Distribute(std::chrono::time_point<std::chrono::steady_clock> now) -> void;
+
+        /**
+         * @brief Drops every reserved job.
+         */
+        auto Clear() -> void;
 
     private:
-        USE_LOCK;
-        CoreMemory::PriorityQueue<TimerItem> m_items;
+        static constexpr std::uint32_t CHUNK_BITS = 10;
+        static constexpr std::uint32_t CHUNK_SIZE = 1U << CHUNK_BITS;
+        static constexpr std::uint32_t MAX_CHUNKS = 4096;
+        static constexpr std::uint32_t NO_ENTRY = 0xFFFFFFFF;
+
+        // Low bits of the entry state, the generation is stored above them
+        static constexpr std::uint64_t STATE_FREE = 0;
+        static constexpr std::uint64_t STATE_PENDING = 1;
+        static constexpr std::uint64_t STATE_CANCELLED = 2;
+        static constexpr std::uint64_t STATE_MASK = 3;
+
+        struct TimerEntry : Synapse::STL::Concurrent::IntrusiveMpscNode {
+            std::atomic<std::uint64_t> state = STATE_FREE;
+            std::atomic<std::uint32_t> next_free = NO_ENTRY;
+            std::uint32_t index = 0;
+            std::uint64_t due_tick = 0;
+            std::weak_ptr<JobQueue> owner;
+            Job* job = nullptr;
+        };
+
+        struct DueJob {
+            std::weak_ptr<JobQueue> owner;
+            Job* job;
+        };
+
+        [[nodiscard]] static auto ToTick(std::chrono::time_point<std::chrono::steady_clock> time) noexcept -> std::uint64_t;
+        [[nodiscard]] static auto MakeState(std::uint32_t generation, std::uint64_t status) noexcept -> std::uint64_t;
+
+        [[nodiscard]] auto GetEntry(std::uint32_t index) const noexcept -> TimerEntry&;
+        [[nodiscard]] auto AcquireEntry() -> TimerEntry*;
+        auto ReleaseEntry(TimerEntry& entry) noexcept -> void;
+        auto PushFree(std::uint32_t first, std::uint32_t last) noexcept -> void;
+        auto Grow() -> bool;
+        // Claims a due or drained entry for the distributing thread, releases it if it was cancelled
+        auto Collect(TimerEntry& entry, bool due) -> void;
+        auto DrainReserved() -> void;
+
+        std::array<std::atomic<TimerEntry*>, MAX_CHUNKS> m_chunks{};
+        std::vector<std::unique_ptr<TimerEntry[]>> m_chunk_storage;  ///< Guarded by the grow mutex.
+        std::uint32_t m_chunk_count = 0;                             ///< Guarded by the grow mutex.
+        std::mutex m_grow_mutex;
+        /// Index of the first free entry in the low half, a tag against ABA in the high half
+        std::atomic<std::uint64_t> m_free_head = NO_ENTRY;
+
+        Synapse::STL::Concurrent::IntrusiveMpscQueue<TimerEntry> m_reserved;
+        // Distributing thread only
+        Synapse::STL::TimingWheel<std::uint32_t> m_wheel;
+        std::vector<DueJob> m_due_jobs;
         std::atomic<bool> m_distributing = false;
     };
 }
@@ -0,0 +1,97 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+#include "GlobalQueue.hpp"
+#include "Job.hpp"
+
+namespace CoreThread::Job {
+    namespace Detail {
+        template <typename TFunction>
+        struct ParallelForState {
+            TFunction* function;
+            std::size_t begin;
+            std::size_t end;
+            std::size_t grain;
+            std::size_t chunk_count;
+            std::atomic<std::size_t> next_chunk = 0;
+            std::atomic<std::size_t> done_chunks = 0;
+
+            // Claims chunks until none are left, shared by the caller and the helper jobs
+            auto Work() -> void {
+                std::size_t finished = 0;
+                for (std::size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed); chunk < chunk_count;
+                        chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+                    const std::size_t first = begin + (chunk * grain);
+                    const std::size_t last = std::min(first + grain, end);
+                    for (std::size_t index = first; index < last; index++) {
+                        (*function)(index);
+                    }
+                    finished++;
+                }
+                if ((finished != 0) && (done_chunks.fetch_add(finished, std::memory_order_acq_rel) + finished == chunk_count)) {
+                    done_chunks.notify_one();
+                }
+            }
+        };
+    }
+
+    /**
+     * @brief Calls `function(index)` for every index in [begin, end) on the worker pool and returns when all calls finished.
+     *
+     * The range is cut into chunks of `grain` indices. The calling thread and up to one helper
+     * job per other worker claim chunks from a shared counter, the helpers are pushed onto the
+     * caller's deque so idle workers steal them. The caller works through the chunks itself
+     * if no worker is free, so it never waits on a helper that has not started. Chunks run
+     * concurrently, `function` must be safe to call from several threads at once.
+     *
+     * @code{.cpp}
+     * ParallelFor(0, connections.size(), 64, [&](std::size_t i) { connections[i]->CalculateNetworkStatistics(); });
+     * @endcode
+     */
+    template <std::invocable<std::size_t> TFunction>
+    auto ParallelFor(std::size_t begin, std::size_t end, std::size_t grain, TFunction&& function) -> void {
+        if (begin >= end) {
+            return;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        const std::size_t chunk_count = ((end - begin) + grain - 1) / grain;
+        if (chunk_count == 1) {
+            for (std::size_t index = begin; index < end; index++) {
+                function(index);
+            }
+            return;
+        }
+
+        using State = Detail::ParallelForState<std::remove_reference_t<TFunction>>;
+        // Shared with the helpers, one that starts after the loop finished only finds no chunk left
+        const std::shared_ptr<State> state = std::make_shared<State>(std::addressof(function), begin, end, grain, chunk_count);
+        const std::size_t helper_count = std::min<std::size_t>(Global::GGlobalQueue->GetWorkerCount(), chunk_count) - 1;
+        for (std::size_t i = 0; i < helper_count; i++) {
+            Global::GGlobalQueue->Push(Job::Create([state] { state->Work(); }));
+        }
+
+        state->Work();
+        for (std::size_t done = state->done_chunks.load(std::memory_order_acquire); done != chunk_count;
+                done = state->done_chunks.load(std::memory_order_acquire)) {
+            state->done_chunks.wait(done, std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Calls `function(element)` for every element of a random access range, see the index overload.
+     */
+    template <std::ranges::random_access_range TRange, typename TFunction>
+        requires std::invocable<TFunction&, std::ranges::range_reference_t<TRange>>
+    auto ParallelFor(TRange&& range, std::size_t grain, TFunction&& function) -> void {
+        const auto first = std::ranges::begin(range);
+        ParallelFor(0, static_cast<std::size_t>(std::ranges::distance(range)), grain,
+                [&first, &function](std::size_t index) { function(first[static_cast<std::ranges::range_difference_t<TRange>>(index)]); });
+    }
+}
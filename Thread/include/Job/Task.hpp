@@ -0,0 +1,395 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <Concurrent/SizeClassPool.hpp>
+#include <libassert/assert.hpp>
+
+#include "JobQueue.hpp"
+#include "JobTimer.hpp"
+
+namespace CoreThread::Job {
+    /**
+     * @brief State shared by every task promise: the queue the coroutine runs on and who waits for it.
+     *
+     * Frames come from size class pools cached per thread, so starting a task does not touch
+     * the heap once the pools are warm.
+     */
+    class TaskPromiseBase {
+    public:
+        static auto operator new(std::size_t size) -> void* {
+            return Synapse::STL::Concurrent::SizeClassPool::Allocate(size);
+        }
+        static auto operator delete(void* frame, std::size_t size) -> void {
+            Synapse::STL::Concurrent::SizeClassPool::Deallocate(frame, size);
+        }
+
+        struct FinalAwaiter {
+            [[nodiscard]] auto await_ready() const noexcept -> bool { return false; }
+            template <typename TPromise>
+            auto await_suspend(std::coroutine_handle<TPromise> handle) noexcept -> std::coroutine_handle<>;
+            auto await_resume() const noexcept -> void {}
+        };
+
+        [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always { return {}; }
+        [[nodiscard]] auto final_suspend() const noexcept -> FinalAwaiter { return {}; }
+        auto unhandled_exception() noexcept -> void { m_exception = std::current_exception(); }
+
+        [[nodiscard]] auto GetQueue() const noexcept -> const std::shared_ptr<JobQueue>& { return m_queue; }
+        auto SetQueue(std::shared_ptr<JobQueue> queue) noexcept -> void { m_queue = std::move(queue); }
+
+        /**
+         * @brief Makes `continuation` resume when this task finishes, on the queue it runs on now.
+         * @param fan_in Counter shared by tasks awaited together, the last one to finish resumes the continuation.
+         */
+        auto SetContinuation(std::coroutine_handle<> continuation, JobQueue* continuation_queue,
+                std::atomic<std::size_t>* fan_in = nullptr) noexcept -> void {
+            m_continuation = continuation;
+            m_continuation_queue = continuation_queue;
+            m_fan_in = fan_in;
+        }
+
+        auto Detach() noexcept -> void { m_detached = true; }
+
+    protected:
+        auto RethrowIfFailed() const -> void {
+            if (m_exception) {
+                std::rethrow_exception(m_exception);
+            }
+        }
+
+    private:
+        std::shared_ptr<JobQueue> m_queue;  ///< Keeps the queue alive while the coroutine may resume on it.
+        std::coroutine_handle<> m_continuation;
+        JobQueue* m_continuation_queue = nullptr;
+        std::atomic<std::size_t>* m_fan_in = nullptr;
+        std::exception_ptr m_exception;
+        bool m_detached = false;
+    };
+
+    /**
+     * @brief Resumes a coroutine as a job of `queue`, the job fits the inline buffer so this does not allocate.
+     *
+     * Exempt from the queue's overflow policy, a shed resume would leak the coroutine.
+     */
+    inline auto ResumeAsJob(JobQueue& queue, std::coroutine_handle<> handle) -> void {
+        Job* job = Job::Create([handle] { handle.resume(); });
+        job->SetSheddable(false);
+        queue.Push(job);
+    }
+
+    template <typename TPromise>
+    auto TaskPromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<TPromise> handle) noexcept -> std::coroutine_handle<> {
+        TaskPromiseBase& promise = handle.promise();
+        if (promise.m_detached) {
+            DEBUG_ASSERT(!promise.m_exception, "Unhandled exception in a spawned task");
+            handle.destroy();
+            return std::noop_coroutine();
+        }
+        if ((promise.m_fan_in != nullptr) && (promise.m_fan_in->fetch_sub(1, std::memory_order_acq_rel) != 1)) {
+            return std::noop_coroutine();
+        }
+        if ((promise.m_continuation_queue != nullptr) && (promise.m_continuation_queue != promise.m_queue.get())) {
+            // The task moved to another queue, go back to the one the awaiting coroutine runs on
+            ResumeAsJob(*promise.m_continuation_queue, promise.m_continuation);
+            return std::noop_coroutine();
+        }
+        return promise.m_continuation ? promise.m_continuation : std::noop_coroutine();
+    }
+
+    template <typename T>
+    class TaskPromise;
+
+    template <typename T>
+    class WhenAllAwaiter;
+
+    /**
+     * @brief Lazily started coroutine producing a `T`, resumed as jobs of a JobQueue.
+     *
+     * A task starts when it is awaited and runs on the queue of the awaiting coroutine, or is
+     * started on a queue with `Spawn`. Awaiting `After`, `ResumeOn` or a `Completion` suspends
+     * it without blocking the thread, it continues as a job of its queue. So connection logic
+     * can be written as sequential code that runs on the connection's queue.
+     *
+     * @code{.cpp}
+     * Task<void> Session::Handshake() {
+     *     co_await After(std::chrono::milliseconds(50));
+     *     const Packet packet = co_await m_receive;  // Completion<Packet> completed by the IO thread
+     *     ...
+     * }
+     * Spawn(session, session->Handshake());
+     * @endcode
+     */
+    template <typename T = void>
+    class [[nodiscard]] Task {
+    public:
+        using promise_type = TaskPromise<T>;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Task() noexcept = default;
+        explicit Task(Handle handle) noexcept : m_handle(handle) {}
+        ~Task() {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+        }
+
+        Task(const Task&) = delete;
+        Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+        auto operator=(const Task&) -> Task& = delete;
+        auto operator=(Task&& other) noexcept -> Task& {
+            if (this != &other) {
+                if (m_handle) {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool { return !m_handle || m_handle.done(); }
+
+        template <std::derived_from<TaskPromiseBase> TPromise>
+        auto await_suspend(std::coroutine_handle<TPromise> awaiting) noexcept -> std::coroutine_handle<> {
+            const std::shared_ptr<JobQueue>& queue = awaiting.promise().GetQueue();
+            m_handle.promise().SetQueue(queue);
+            m_handle.promise().SetContinuation(awaiting, queue.get());
+            return m_handle;
+        }
+
+        auto await_resume() -> T {
+            return m_handle.promise().GetResult();
+        }
+
+        [[nodiscard]] auto IsDone() const noexcept -> bool { return m_handle && m_handle.done(); }
+
+        /**
+         * @brief Gives up ownership of the coroutine, e.g. to start it detached.
+         */
+        [[nodiscard]] auto Release() noexcept -> Handle { return std::exchange(m_handle, nullptr); }
+
+    private:
+        friend class WhenAllAwaiter<T>;
+
+        Handle m_handle;
+    };
+
+    template <typename T>
+    class TaskPromise : public TaskPromiseBase {
+    public:
+        auto get_return_object() noexcept -> Task<T> { return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this)); }
+
+        template <typename TValue>
+            requires std::convertible_to<TValue, T>
+        auto return_value(TValue&& value) -> void {
+            m_value.emplace(std::forward<TValue>(value));
+        }
+
+        auto GetResult() -> T {
+            RethrowIfFailed();
+            return std::move(*m_value);
+        }
+
+    private:
+        std::optional<T> m_value;
+    };
+
+    template <>
+    class TaskPromise<void> : public TaskPromiseBase {
+    public:
+        auto get_return_object() noexcept -> Task<void> { return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this)); }
+        auto return_void() const noexcept -> void {}
+
+        auto GetResult() const -> void {
+            RethrowIfFailed();
+        }
+    };
+
+    /**
+     * @brief Starts a task on `queue` and lets it run to completion, the frame frees itself.
+     */
+    inline auto Spawn(std::shared_ptr<JobQueue> queue, Task<void> task) -> void {
+        const Task<void>::Handle handle = task.Release();
+        JobQueue& target = *queue;
+        handle.promise().SetQueue(std::move(queue));
+        handle.promise().Detach();
+        ResumeAsJob(target, handle);
+    }
+
+    /**
+     * @brief Awaiter continuing the coroutine on its queue once `delay` passed, backed by the JobTimer.
+     */
+    class AfterAwaiter {
+    public:
+        explicit AfterAwaiter(std::chrono::milliseconds delay) noexcept : m_delay(delay) {}
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool { return m_delay.count() <= 0; }
+
+        template <std::derived_from<TaskPromiseBase> TPromise>
+        auto await_suspend(std::coroutine_handle<TPromise> handle) -> bool {
+            const std::shared_ptr<JobQueue>& queue = handle.promise().GetQueue();
+            DEBUG_ASSERT(queue != nullptr, "Task has no queue to resume on");
+            // Exempt from the queue's overflow policy like ResumeAsJob, a shed resume would leak the coroutine
+            Job* job = Job::Create([handle] { handle.resume(); });
+            job->SetSheddable(false);
+            // The timer table is full and dropped the job, continue now rather than never
+            return !Global::GJobTimer->Reserve(static_cast<std::uint64_t>(m_delay.count()), queue, job).IsNull();
+        }
+
+        auto await_resume() const noexcept -> void {}
+
+    private:
+        std::chrono::milliseconds m_delay;
+    };
+
+    [[nodiscard]] inline auto After(std::chrono::milliseconds delay) noexcept -> AfterAwaiter {
+        return AfterAwaiter(delay);
+    }
+
+    /**
+     * @brief Awaiter moving the coroutine to another queue, it continues as a job of that queue.
+     */
+    class ResumeOnAwaiter {
+    public:
+        explicit ResumeOnAwaiter(std::shared_ptr<JobQueue> queue) noexcept : m_queue(std::move(queue)) {}
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool { return false; }
+
+        template <std::derived_from<TaskPromiseBase> TPromise>
+        auto await_suspend(std::coroutine_handle<TPromise> handle) -> void {
+            JobQueue& target = *m_queue;
+            handle.promise().SetQueue(std::move(m_queue));
+            ResumeAsJob(target, handle);
+        }
+
+        auto await_resume() const noexcept -> void {}
+
+    private:
+        std::shared_ptr<JobQueue> m_queue;
+    };
+
+    [[nodiscard]] inline auto ResumeOn(std::shared_ptr<JobQueue> queue) noexcept -> ResumeOnAwaiter {
+        return ResumeOnAwaiter(std::move(queue));
+    }
+
+    /**
+     * @brief One-shot result delivered by another thread, e.g. a receive completion from the IO threads.
+     *
+     * The producer calls `Complete` once from any thread, one coroutine awaits the value and
+     * continues on its own queue. `Reset` rearms the completion after the value was taken,
+     * so a connection can keep one per outstanding receive.
+     */
+    template <typename T>
+    class Completion {
+    public:
+        Completion() = default;
+        ~Completion() = default;
+
+        Completion(const Completion&) = delete;
+        Completion(Completion&&) = delete;
+        auto operator=(const Completion&) -> Completion& = delete;
+        auto operator=(Completion&&) -> Completion& = delete;
+
+        auto Complete(T value) -> void {
+            m_value.emplace(std::move(value));
+            void* waiting = m_state.exchange(GetCompletedMarker(), std::memory_order_acq_rel);
+            DEBUG_ASSERT(waiting != GetCompletedMarker(), "Completion completed twice");
+            if (waiting != nullptr) {
+                ResumeAsJob(*m_queue, std::coroutine_handle<>::from_address(waiting));
+            }
+        }
+
+        auto Reset() noexcept -> void {
+            m_value.reset();
+            m_state.store(nullptr, std::memory_order_relaxed);
+        }
+
+        struct Awaiter {
+            Completion& completion;
+
+            [[nodiscard]] auto await_ready() const noexcept -> bool {
+                return completion.m_state.load(std::memory_order_acquire) == completion.GetCompletedMarker();
+            }
+
+            template <std::derived_from<TaskPromiseBase> TPromise>
+            auto await_suspend(std::coroutine_handle<TPromise> handle) noexcept -> bool {
+                completion.m_queue = handle.promise().GetQueue().get();
+                void* expected = nullptr;
+                // Fails if the value arrived meanwhile, then the coroutine continues right away
+                return completion.m_state.compare_exchange_strong(expected, handle.address(), std::memory_order_acq_rel,
+                        std::memory_order_acquire);
+            }
+
+            auto await_resume() -> T { return std::move(*completion.m_value); }
+        };
+
+        [[nodiscard]] auto operator co_await() noexcept -> Awaiter { return Awaiter{ *this }; }
+
+    private:
+        [[nodiscard]] auto GetCompletedMarker() const noexcept -> void* { return const_cast<Completion*>(this); }
+
+        std::optional<T> m_value;
+        JobQueue* m_queue = nullptr;
+        std::atomic<void*> m_state = nullptr;  ///< Empty, the waiting coroutine, or the completed marker.
+    };
+
+    /**
+     * @brief Awaiter starting a set of tasks on the awaiting coroutine's queue and continuing when all finished.
+     */
+    template <typename T>
+    class WhenAllAwaiter {
+    public:
+        explicit WhenAllAwaiter(std::vector<Task<T>>& tasks) noexcept : m_tasks(tasks) {}
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool { return m_tasks.empty(); }
+
+        template <std::derived_from<TaskPromiseBase> TPromise>
+        auto await_suspend(std::coroutine_handle<TPromise> awaiting) -> bool {
+            const std::shared_ptr<JobQueue>& queue = awaiting.promise().GetQueue();
+            // One extra count held while starting, so no task can resume the awaiting coroutine before the loop ends
+            m_remaining.store(m_tasks.size() + 1, std::memory_order_relaxed);
+            for (Task<T>& task : m_tasks) {
+                task.m_handle.promise().SetQueue(queue);
+                task.m_handle.promise().SetContinuation(awaiting, queue.get(), &m_remaining);
+                task.m_handle.resume();
+            }
+            return m_remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+        }
+
+        auto await_resume() const noexcept -> void {}
+
+    private:
+        std::vector<Task<T>>& m_tasks;
+        std::atomic<std::size_t> m_remaining = 0;
+    };
+
+    /**
+     * @brief Runs the tasks concurrently on the awaiting coroutine's queue and collects their results in order.
+     */
+    template <typename T>
+    auto WhenAll(std::vector<Task<T>> tasks) -> Task<std::vector<T>> {
+        co_await WhenAllAwaiter<T>(tasks);
+        std::vector<T> results;
+        results.reserve(tasks.size());
+        for (Task<T>& task : tasks) {
+            // Already finished, this only takes the result
+            results.push_back(co_await std::move(task));
+        }
+        co_return results;
+    }
+
+    inline auto WhenAll(std::vector<Task<void>> tasks) -> Task<void> {
+        co_await WhenAllAwaiter<void>(tasks);
+        for (Task<void>& task : tasks) {
+            co_await std::move(task);
+        }
+    }
+}
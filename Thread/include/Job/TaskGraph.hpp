@@ -0,0 +1,80 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <InplaceFunction.hpp>
+
+namespace CoreThread::Job {
+    /**
+     * @brief Graph of tasks with dependencies, run on the worker pool as often as needed, e.g. once per tick.
+     *
+     * A task starts once all tasks it depends on finished. `Run` hands every ready task to
+     * the pool as a standalone job and works through ready tasks itself while it waits, so the
+     * graph also completes when no worker is free. A finishing task makes its successors ready.
+     * The graph is built once and reused, only the dependency counters are reset per run.
+     *
+     * @code{.cpp}
+     * TaskGraph graph;
+     * const TaskGraph::TaskId receive = graph.Add([] { ProcessReceived(); });
+     * const TaskGraph::TaskId simulate = graph.Add([] { Simulate(); });
+     * const TaskGraph::TaskId send = graph.Add([] { BuildPackets(); });
+     * graph.Precede(receive, simulate);
+     * graph.Precede(simulate, send);
+     * graph.Run();
+     * @endcode
+     */
+    class TaskGraph {
+    public:
+        using TaskId = std::uint32_t;
+        using Callback = Synapse::STL::InplaceFunction<void(), 48>;
+
+        TaskGraph();
+        ~TaskGraph() = default;
+
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph(TaskGraph&&) = delete;
+        auto operator=(const TaskGraph&) -> TaskGraph& = delete;
+        auto operator=(TaskGraph&&) -> TaskGraph& = delete;
+
+        auto Add(Callback&& callback) -> TaskId;
+
+        /**
+         * @brief Makes `after` wait for `before`, the graph has to stay acyclic.
+         */
+        auto Precede(TaskId before, TaskId after) -> void;
+
+        /**
+         * @brief Runs every task once and returns when all finished, not while another run of this graph is in progress.
+         */
+        auto Run() -> void;
+
+        [[nodiscard]] auto GetTaskCount() const noexcept -> std::size_t;
+
+    private:
+        struct Task {
+            Callback callback;
+            std::vector<TaskId> successors;
+            std::uint32_t dependency_count = 0;
+            std::atomic<std::uint32_t> pending = 0;  ///< Dependencies not finished yet in this run.
+        };
+
+        // Outlives the graph while a helper job still holds it
+        struct State : std::enable_shared_from_this<State> {
+            std::vector<std::unique_ptr<Task>> tasks;
+            std::mutex ready_mutex;
+            std::vector<TaskId> ready;  ///< Guarded by the ready mutex.
+            std::atomic<std::uint32_t> remaining = 0;
+            std::atomic<std::uint32_t> signal = 0;  ///< Bumped when a task becomes ready or the run ends, the caller waits on it.
+
+            auto MakeReady(TaskId task) -> void;
+            auto TryRunOne() -> bool;
+            auto Finish(const Task& task) -> void;
+        };
+
+        [[nodiscard]] auto IsAcyclic() const -> bool;
+
+        std::shared_ptr<State> m_state;
+    };
+}
@@ -2,57 +2,80 @@
 #include <atomic>
 #include <chrono>
 #include <cstdint>
-#include <string>
+#include <Concurrent/AdaptiveSharedMutex.hpp>
+#include "LockId.hpp"
+#if SYNAPSE_LOCK_PROFILE
+#include <tracy/Tracy.hpp>
+#endif
 
 namespace CoreThread {
-    /*--------------------------------------------
-    [WWWWWWWW][WWWWWWWW][RRRRRRRR][RRRRRRRR]
-    W : WriteFlag (Exclusive Lock Owner thread_id)
-    R : ReadFlag (Shared Lock Count)
-    ---------------------------------------------*/
-
+    /**
+     * @brief Reader-writer lock, re-entrant for the writing thread.
+     *
+     * The thread holding the write lock may lock it again for writing or reading. A thread
+     * may also take the read lock again while it holds it, even when a writer waits. Waiting
+     * spins briefly and then sleeps, see `AdaptiveSharedMutex`; waiting writers hold new
+     * readers back.
+     *
+     * With `SYNAPSE_LOCK_PROFILE` the outermost acquisitions are recorded in `Global::GLockProfiler`,
+     * and in Tracy's lock views when Tracy is enabled.
+     */
     class Lock {
         const std::chrono::milliseconds ACQUIRE_TIMEOUT_TICK = std::chrono::milliseconds(10000);
-        const std::uint32_t MAX_SPIN_COUNT = 5000;
-        const std::uint32_t WRITE_THREAD_MASK = 0xFFFF'0000;
-        const std::uint32_t READ_COUNT_MASK = 0x0000'FFFF;
-        const std::uint32_t EMPTY_FLAG = 0x0000'0000;
+        static constexpr std::uint32_t NO_OWNER = 0;
 
     public:
-        auto WriteLock(const std::string &name) -> void;
-        auto WriteUnlock(const std::string &name) -> void;
-        auto ReadLock(const std::string &name) -> void;
-        auto ReadUnlock(const std::string &name) -> void;
+        auto WriteLock(const LockId &id) -> void;
+        auto WriteUnlock(const LockId &id) -> void;
+        auto ReadLock(const LockId &id) -> void;
+        auto ReadUnlock(const LockId &id) -> void;
 
     private:
-        std::atomic<std::uint32_t> m_lock_flag = EMPTY_FLAG;
-        std::uint16_t m_write_count = 0;
+        auto AcquireExclusive(Synapse::STL::Concurrent::AcquireStatistics *statistics) -> void;
+        auto AcquireShared(Synapse::STL::Concurrent::AcquireStatistics *statistics) -> void;
+#if SYNAPSE_LOCK_PROFILE
+        // Returns when the lock was acquired, or the default time point when the hold is not sampled
+        auto ProfileAcquire(const LockId &id, bool shared) -> std::chrono::steady_clock::time_point;
+        auto ProfileRelease(const LockId &id, bool shared, std::chrono::steady_clock::time_point acquired) -> void;
+#endif
+
+        Synapse::STL::Concurrent::AdaptiveSharedMutex m_mutex;
+        std::atomic<std::uint32_t> m_write_owner = NO_OWNER;  ///< Thread id of the writer, only that thread sees its own id here.
+        std::uint32_t m_write_count = 0;                      ///< Writing thread only.
+#if SYNAPSE_LOCK_PROFILE
+        std::chrono::steady_clock::time_point m_write_acquired;  ///< Writing thread only.
+#ifdef TRACY_ENABLE
+        static constexpr tracy::SourceLocationData TRACY_LOCATION{ nullptr, "CoreThread::Lock", __FILE__, __LINE__, 0 };
+        tracy::SharedLockableCtx m_tracy_context{ &TRACY_LOCATION };
+        std::atomic<bool> m_tracy_named = false;  ///< Named after the id of its first acquisition.
+#endif
+#endif
     };
 
     class ReadLockGuard {
     public:
-        ReadLockGuard(Lock& lock, const std::string& name) : m_lock(lock), m_name(name) { m_lock.ReadLock(name); }
-        ~ReadLockGuard() { m_lock.ReadUnlock(m_name); }
+        ReadLockGuard(Lock& lock, const LockId& id) : m_lock(lock), m_id(id) { m_lock.ReadLock(m_id); }
+        ~ReadLockGuard() { m_lock.ReadUnlock(m_id); }
 
     private:
         Lock& m_lock;
-        const std::string m_name;
+        const LockId m_id;
     };
 
     class WriteLockGuard {
     public:
-        WriteLockGuard(Lock& lock, const std::string& name) : m_lock(lock), m_name(name) { m_lock.WriteLock(name); }
-        ~WriteLockGuard() { m_lock.WriteUnlock(m_name); }
+        WriteLockGuard(Lock& lock, const LockId& id) : m_lock(lock), m_id(id) { m_lock.WriteLock(m_id); }
+        ~WriteLockGuard() { m_lock.WriteUnlock(m_id); }
 
     private:
         Lock& m_lock;
-        const std::string m_name;
+        const LockId m_id;
     };
 }
 
 #define USE_MANY_LOCKS(count) CoreThread::Lock _locks[count];
 #define USE_LOCK USE_MANY_LOCKS(1)
-#define READ_LOCK_IDX(idx) CoreThread::ReadLockGuard readLockGuard_##idx(_locks[idx], typeid(this).name());
+#define READ_LOCK_IDX(idx) CoreThread::ReadLockGuard readLockGuard_##idx(_locks[idx], LOCK_ID_OF(idx));
 #define READ_LOCK READ_LOCK_IDX(0)
-#define WRITE_LOCK_IDX(idx) CoreThread::WriteLockGuard writeLockGuard_##idx(_locks[idx], typeid(this).name());
+#define WRITE_LOCK_IDX(idx) CoreThread::WriteLockGuard writeLockGuard_##idx(_locks[idx], LOCK_ID_OF(idx));
 #define WRITE_LOCK WRITE_LOCK_IDX(0)
\ No newline at end of file
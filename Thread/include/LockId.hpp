@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+#include <type_traits>
+
+namespace CoreThread {
+    /**
+     * @brief Names a lock for the deadlock profiler without allocating: the class owning it and its index in `USE_MANY_LOCKS`.
+     *
+     * The owner name and its hash are compile-time constants, only the index is combined at runtime.
+     */
+    struct LockId {
+        std::uint64_t value = 0;  ///< Owner hash in the upper half, index in the lower; the profiler keys on this.
+        std::string_view owner;   ///< Static storage, only read to report a cycle.
+
+        [[nodiscard]] constexpr auto GetIndex() const -> std::uint32_t { return static_cast<std::uint32_t>(value); }
+    };
+
+    namespace Detail {
+        // The type appears in the signature of the function, e.g. "[with T = Foo]" or "GetTypeName<class Foo>(void)"
+        template <typename T>
+        consteval auto GetTypeName() -> std::string_view {
+            const std::string_view function{ std::source_location::current().function_name() };
+#if defined(_MSC_VER) && !defined(__clang__)
+            const std::size_t begin = function.find("GetTypeName<") + 12;
+            const std::size_t end = function.rfind(">(void)");
+#else
+            const std::size_t begin = function.find("T = ") + 4;
+            const std::size_t end = function.find_first_of(";]", begin);
+#endif
+            return function.substr(begin, end - begin);
+        }
+
+        consteval auto HashName(std::string_view name) -> std::uint32_t {
+            // 32 bit FNV-1a
+            std::uint32_t hash = 2166136261U;
+            for (const char c : name) {
+                hash = (hash ^ static_cast<std::uint8_t>(c)) * 16777619U;
+            }
+            return hash;
+        }
+
+        template <typename T>
+        inline constexpr std::string_view LOCK_OWNER_NAME = GetTypeName<T>();
+
+        template <typename T>
+        inline constexpr std::uint32_t LOCK_OWNER_HASH = HashName(LOCK_OWNER_NAME<T>);
+    }
+
+    template <typename TOwner>
+    [[nodiscard]] constexpr auto MakeLockId(std::uint32_t index) -> LockId {
+        return LockId{ (static_cast<std::uint64_t>(Detail::LOCK_OWNER_HASH<TOwner>) << 32U) | index, Detail::LOCK_OWNER_NAME<TOwner> };
+    }
+}
+
+// Inside a member function, the id of the lock at `idx` of the enclosing class
+#define LOCK_ID_OF(idx) CoreThread::MakeLockId<std::remove_cv_t<std::remove_pointer_t<decltype(this)>>>(static_cast<std::uint32_t>(idx))
\ No newline at end of file
@@ -0,0 +1,154 @@
+#pragma once
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <ankerl/unordered_dense.h>
+#include <Concurrent/AdaptiveSharedMutex.hpp>
+#include <Log2Histogram.hpp>
+#include "LockId.hpp"
+
+namespace CoreThread {
+    /**
+     * @brief Contention of one lock, merged over all threads by `LockProfiler::GetReport`. The histograms are in nanoseconds.
+     */
+    struct LockSiteStatistics {
+        LockId id;
+        std::uint64_t acquisitions = 0;
+        std::uint64_t contended_acquisitions = 0;  ///< The first attempt failed, uncontended ones add no wait.
+        std::uint64_t spin_rounds = 0;
+        std::uint64_t sleeps = 0;
+        std::uint64_t hold_samples = 0;
+        std::chrono::nanoseconds total_wait{};
+        std::chrono::nanoseconds max_wait{};
+        std::chrono::nanoseconds total_hold{};     ///< Over the sampled holds.
+        std::chrono::nanoseconds max_hold{};
+        Synapse::STL::Log2Histogram wait_histogram{};
+        Synapse::STL::Log2Histogram hold_histogram{};
+
+        auto Merge(const LockSiteStatistics& other) -> void;
+    };
+
+    /**
+     * @brief Wait and hold times of locks, per lock id, for finding the locks that hurt in production.
+     *
+     * Every thread records into its own buffer, the buffers are merged only for a report. Uncontended
+     * acquisitions are counted without reading the clock; their hold time is sampled once every
+     * `HOLD_SAMPLE_PERIOD` acquisitions of a thread. Contended acquisitions are always timed.
+     *
+     * `CoreThread::Lock` records here when built with `SYNAPSE_LOCK_PROFILE` (CMake `ENABLE_LOCK_PROFILING`),
+     * other primitives through `ProfiledPrimitive`.
+     */
+    class LockProfiler {
+    public:
+        static constexpr std::uint32_t HOLD_SAMPLE_PERIOD = 16;
+
+        LockProfiler();
+        ~LockProfiler() = default;
+
+        LockProfiler(const LockProfiler&) = delete;
+        LockProfiler(LockProfiler&&) = delete;
+        auto operator=(const LockProfiler&) -> LockProfiler& = delete;
+        auto operator=(LockProfiler&&) -> LockProfiler& = delete;
+        auto operator==(const LockProfiler& other) const -> bool = delete;
+
+        auto RecordAcquire(const LockId& id, std::chrono::nanoseconds wait, const Synapse::STL::Concurrent::AcquireStatistics& statistics) -> void;
+        auto RecordHold(const LockId& id, std::chrono::nanoseconds hold) -> void;
+        /// Whether the calling thread should time the hold of its next uncontended acquisition
+        [[nodiscard]] static auto SampleHold() -> bool;
+
+        /// Merged over all threads, the lock waited on the longest first
+        [[nodiscard]] auto GetReport() const -> std::vector<LockSiteStatistics>;
+        auto LogReport() const -> void;
+        auto Reset() -> void;
+
+    private:
+        struct ThreadBuffer {
+            std::mutex mutex;  ///< Only contended while a report is taken.
+            ankerl::unordered_dense::map<std::uint64_t, LockSiteStatistics> sites;
+        };
+
+        static auto GetSite(ThreadBuffer& buffer, const LockId& id) -> LockSiteStatistics&;
+        auto GetThreadBuffer() -> ThreadBuffer&;
+
+        const std::uint64_t m_generation;  ///< Tells the thread local buffer caches of different profilers apart.
+        mutable std::mutex m_buffers_lock;
+        std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;  ///< Kept after their thread exits, the report still needs them.
+    };
+
+    /**
+     * @brief Wraps a `MultiThreadPolicy` primitive, recording its `Enter` and `Leave` in `Global::GLockProfiler`.
+     *
+     * Contention is only known when the primitive has `TryEnter`, otherwise every wait is timed.
+     * Without `SYNAPSE_LOCK_PROFILE` it forwards and records nothing. With it `Enter` and `Leave` may
+     * throw `std::bad_alloc`, the first record of a lock on a thread allocates its entry.
+     *
+     * @tparam TSynchronizationPrimitive Type providing `Enter`/`Leave`.
+     */
+    template <class TSynchronizationPrimitive>
+    class ProfiledPrimitive {
+    public:
+        ProfiledPrimitive(TSynchronizationPrimitive& primitive, const LockId& id) noexcept : m_primitive(primitive), m_id(id) {}
+        auto operator==(const ProfiledPrimitive& other) const -> bool = delete;
+
+        auto Enter() noexcept(NOTHROW) -> void;
+        auto Leave() noexcept(NOTHROW) -> void;
+
+    private:
+#if SYNAPSE_LOCK_PROFILE
+        static constexpr bool NOTHROW = false;
+#else
+        static constexpr bool NOTHROW = noexcept(std::declval<TSynchronizationPrimitive&>().Enter()) &&
+                noexcept(std::declval<TSynchronizationPrimitive&>().Leave());
+#endif
+
+        TSynchronizationPrimitive& m_primitive;
+        const LockId m_id;
+        std::chrono::steady_clock::time_point m_acquired{};  ///< Holder only, default when the hold is not sampled.
+    };
+}
+
+namespace Global {
+#if SYNAPSE_LOCK_PROFILE
+    inline std::unique_ptr<CoreThread::LockProfiler> GLockProfiler = std::make_unique<CoreThread::LockProfiler>();
+#endif
+}
+
+namespace CoreThread {
+    template <class TSynchronizationPrimitive>
+    auto ProfiledPrimitive<TSynchronizationPrimitive>::Enter() noexcept(NOTHROW) -> void {
+#if SYNAPSE_LOCK_PROFILE
+        Synapse::STL::Concurrent::AcquireStatistics statistics;
+        if constexpr (requires { { m_primitive.TryEnter() } -> std::convertible_to<bool>; }) {
+            if (m_primitive.TryEnter()) {
+                m_acquired = LockProfiler::SampleHold() ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+                Global::GLockProfiler->RecordAcquire(m_id, std::chrono::nanoseconds{}, statistics);
+                return;
+            }
+            statistics.contended = true;
+        }
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        m_primitive.Enter();
+        m_acquired = std::chrono::steady_clock::now();
+        Global::GLockProfiler->RecordAcquire(m_id, m_acquired - begin, statistics);
+#else
+        m_primitive.Enter();
+#endif
+    }
+
+    template <class TSynchronizationPrimitive>
+    auto ProfiledPrimitive<TSynchronizationPrimitive>::Leave() noexcept(NOTHROW) -> void {
+#if SYNAPSE_LOCK_PROFILE
+        const std::chrono::steady_clock::time_point acquired = m_acquired;
+        m_primitive.Leave();
+        if (acquired != std::chrono::steady_clock::time_point{}) {
+            Global::GLockProfiler->RecordHold(m_id, std::chrono::steady_clock::now() - acquired);
+        }
+#else
+        m_primitive.Leave();
+#endif
+    }
+}
\ No newline at end of file
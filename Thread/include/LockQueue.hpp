@@ -1,11 +1,23 @@
 #pragma once
+#include <deque>
+#include <memory>
 #include <queue>
-#include "Lock.h"
+#include <vector>
+#include "Lock.hpp"
 
 namespace CoreThread {
-    template <typename T>
+    /**
+     * @brief Mutex protected FIFO queue.
+     *
+     * @tparam T          Item type.
+     * @tparam TAllocator Allocator of the underlying deque, e.g. `Synapse::Memory::Arena::STLArena` to keep the items in an arena.
+     */
+    template <typename T, typename TAllocator = std::allocator<T>>
     class LockQueue {
     public:
+        LockQueue() = default;
+        explicit LockQueue(const TAllocator &allocator) : m_items(allocator) {}
+
         void Push(T item) {
             WRITE_LOCK;
             m_items.push(item);
@@ -23,7 +35,7 @@ namespace CoreThread {
         }
 
         // These will write in items
-        void PopAll(CoreMemory::Vector<T>& items) {
+        void PopAll(std::vector<T>& items) {
             WRITE_LOCK;
             while (T item = Pop()) {
                 items.push_back(item);
@@ -32,11 +44,14 @@ namespace CoreThread {
 
         void Clear() {
             WRITE_LOCK;
-            m_items = CoreMemory::Queue<T>();
+            // Pop instead of assigning a fresh queue, the allocator need not be default constructible
+            while (!m_items.empty()) {
+                m_items.pop();
+            }
         }
 
     private:
         USE_LOCK;
-        CoreMemory::Queue<T> m_items;
+        std::queue<T, std::deque<T, TAllocator>> m_items;
     };
 }
\ No newline at end of file
@@ -1,43 +1,65 @@
 #pragma once
 
-#include <functional>
-#include <map>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <vector>
+#include <ankerl/unordered_dense.h>
+#include <Concurrent/IntrusiveMpscQueue.hpp>
+#include <InplaceFunction.hpp>
 
-#include "Thread.h"
+#include "Thread.hpp"
 
 namespace CoreThread {
-    class PeriodicTaskThread : public Thread<PeriodicTaskThread> {
-        struct PeriodicTask {
-            int time_period;
-            std::chrono::time_point<std::chrono::steady_clock> last_time;
-            std::function<void(std::uint32_t, std::chrono::time_point<std::chrono::steady_clock>)> m_func;
-            PeriodicTask() : time_period(), last_time() {};
-        };
+    /**
+     * @brief How the next run of a periodic task is scheduled.
+     */
+    enum class PeriodicTaskMode : std::uint8_t {
+        FixedRate,  ///< Due at whole periods from the registration, a late run does not shift the later ones. Runs missed entirely are skipped.
+        FixedDelay  ///< Due one period after the previous run was dispatched.
+    };
 
+    /**
+     * @brief Runs registered tasks periodically as jobs on the GlobalQueue.
+     *
+     * The thread keeps the tasks in a heap ordered by their next due time and sleeps until the
+     * first one is due, so periods are not limited by a polling interval. A due task is pushed
+     * as a job, a slow task delays neither the thread nor the other tasks. While the previous
+     * run of a task is still going, its next run is skipped.
+     *
+     * Registering and killing are not lock-free. Any thread may call them, they take a mutex
+     * around the set of registered ids, allocate a command and push it into a lock-free queue
+     * that the thread drains. The mutex lets a duplicate id be refused at once, and it keeps
+     * the commands of one id in call order. The thread never takes it, so scheduling is not
+     * held up by registration, only registering threads contend with each other. Commands
+     * take effect once the thread picks them up; a run already dispatched may still happen
+     * after a kill.
+     */
+    class PeriodicTaskThread : public Thread<PeriodicTaskThread> {
     public:
+        using Callback = Synapse::STL::InplaceFunction<void(std::uint32_t, std::chrono::time_point<std::chrono::steady_clock>), 32>;
+
         PeriodicTaskThread();
         ~PeriodicTaskThread();
 
         bool Initialise();
         void Release();
 
-        template <typename T>
-        bool RegisterPeriodicTask(const std::uint32_t id, const std::uint32_t time_period, T* fnClass, void (T::*fn)(std::uint32_t, std::chrono::time_point<std::chrono::steady_clock>)) {
-            std::scoped_lock lock{ m_sync };
-            std::map<std::uint32_t, PeriodicTask>::iterator it = m_elements.find(id);
-            if (it != m_elements.end()) {
-                return false;
-            }
-
-            PeriodicTaskThread::PeriodicTask element;
-            element.m_func = std::bind(fn, fnClass, std::placeholders::_1, std::placeholders::_2);
-            element.time_period = time_period;
-            element.last_time = m_current_time;
+        /**
+         * @brief Calls `callback(id, due_time)` every `time_period` milliseconds, first one period from now.
+         *
+         * @return False if a task is already registered under `id`, it is kept.
+         */
+        bool RegisterPeriodicTask(std::uint32_t id, std::uint32_t time_period, Callback&& callback, PeriodicTaskMode mode = PeriodicTaskMode::FixedRate);
 
-            m_elements[id] = element;
-
-            return true;
+        template <typename T>
+        bool RegisterPeriodicTask(const std::uint32_t id, const std::uint32_t time_period, T* fnClass,
+                void (T::*fn)(std::uint32_t, std::chrono::time_point<std::chrono::steady_clock>), PeriodicTaskMode mode = PeriodicTaskMode::FixedRate) {
+            return RegisterPeriodicTask(id, time_period, [fnClass, fn](std::uint32_t task_id, std::chrono::time_point<std::chrono::steady_clock> due_time) {
+                (fnClass->*fn)(task_id, due_time);
+            }, mode);
         }
 
         void KillPeriodicTask(const std::uint32_t id);
@@ -46,8 +68,40 @@ namespace CoreThread {
         void ImplementCloseThread();
 
     private:
-        std::mutex m_sync;
-        std::map<std::uint32_t, PeriodicTask> m_elements;
-        std::chrono::time_point<std::chrono::steady_clock> m_current_time;
+        struct TaskState {
+            std::uint32_t id = 0;
+            std::uint64_t generation = 0;  ///< Tells the heap entries of a killed and registered again task apart.
+            std::chrono::nanoseconds period{};
+            PeriodicTaskMode mode = PeriodicTaskMode::FixedRate;
+            Callback callback;
+            std::atomic<bool> running = false;
+        };
+
+        struct Command : Synapse::STL::Concurrent::IntrusiveMpscNode {
+            std::uint32_t id = 0;
+            std::shared_ptr<TaskState> task;  ///< Null to kill the task.
+        };
+
+        struct Deadline {
+            std::chrono::time_point<std::chrono::steady_clock> due;
+            std::uint32_t id;
+            std::uint64_t generation;
+        };
+
+        void PushCommand(Command* command);
+        void DrainCommands();
+        void DispatchDue(std::chrono::time_point<std::chrono::steady_clock> now);
+
+        std::mutex m_registered_mutex;
+        ankerl::unordered_dense::set<std::uint32_t> m_registered;  ///< Guarded by the registered mutex, commands are pushed under it to keep their order.
+
+        Synapse::STL::Concurrent::IntrusiveMpscQueue<Command> m_commands;
+        std::atomic<std::uint32_t> m_wake = 0;  ///< Changed by every command, the thread sleeps on it.
+        std::atomic<bool> m_stop = false;
+
+        // Thread only
+        ankerl::unordered_dense::map<std::uint32_t, std::shared_ptr<TaskState>> m_tasks;
+        std::vector<Deadline> m_deadlines;  ///< Min-heap on the due time.
+        std::uint64_t m_generation = 0;
     };
 }
\ No newline at end of file
@@ -1,15 +1,34 @@
 #pragma once
+#include <array>
 #include <chrono>
-#include <stack>
+#include <cstdint>
+#include <vector>
+#include <ankerl/unordered_dense.h>
 
 namespace CoreThread {
+    class Lock;
     namespace Job {
+        class Job;
         class JobQueue;
     }
     namespace ThreadLocal {
         extern thread_local std::uint32_t thread_id;
         extern thread_local std::chrono::time_point<std::chrono::steady_clock> end_tick_count;
-        extern thread_local std::stack<std::int32_t> LockStack;
+        /// Deepest nesting of locks the deadlock profiler follows
+        inline constexpr std::uint32_t MAX_LOCK_DEPTH = 64;
+        /// Graph indices of the locks the thread holds, for the deadlock profiler; the first `lock_stack_depth` are in use
+        extern thread_local std::array<std::int32_t, MAX_LOCK_DEPTH> lock_stack;
+        extern thread_local std::uint32_t lock_stack_depth;
         extern thread_local Job::JobQueue* CurrentJobQueue;
+        /// Jobs drained by `JobQueue::Execute`, reused so a drain does not allocate
+        extern thread_local std::vector<Job::Job*> job_batch;
+        /// Coalesce keys seen while `JobQueue::Execute` sheds a batch
+        extern thread_local ankerl::unordered_dense::set<std::uint64_t> coalesce_keys;
+        /// Deque of the thread in the GlobalQueue, `NO_WORKER` until `GlobalQueue::RegisterWorker`
+        extern thread_local std::uint32_t worker_index;
+        /// Locks the thread holds for reading, once per acquisition, so nested reads skip the writer preference
+        extern thread_local std::vector<const Lock*> held_read_locks;
+        /// When each of `held_read_locks` was acquired, only with `SYNAPSE_LOCK_PROFILE` and for sampled holds
+        extern thread_local std::vector<std::chrono::steady_clock::time_point> held_read_since;
     }
 }
\ No newline at end of file
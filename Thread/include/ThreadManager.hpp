@@ -1,16 +1,41 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace CoreThread {
+    enum class SchedulingPolicy : std::uint8_t {
+        Default,   ///< Time shared, `priority` is the nice value.
+        RealTime,  ///< SCHED_FIFO on Linux, `priority` from 1 to 99. Needs CAP_SYS_NICE, otherwise the thread stays time shared.
+    };
+
+    /**
+     * @brief How a launched thread is placed and scheduled, applied by the thread itself before the callback runs.
+     *
+     * Options the platform or the process rights do not allow are logged and skipped, the
+     * thread still runs.
+     */
+    struct ThreadLaunchOptions {
+        std::string name;                        ///< Shown in top and Tracy, Linux keeps the first 15 characters.
+        std::vector<std::uint32_t> cpus;         ///< Logical CPUs the thread may run on, all if empty. See `CpuTopology`.
+        std::optional<std::uint32_t> numa_node;  ///< Prefers memory from this node, and runs on its CPUs if `cpus` is empty.
+        SchedulingPolicy policy = SchedulingPolicy::Default;
+        std::int32_t priority = 0;
+        bool global_queue_worker = false;        ///< Registers the thread in the GlobalQueue, for threads that run `DoGlobalQueueWork`.
+    };
+
     class ThreadManager {
     public:
         ThreadManager();
         ~ThreadManager();
 
         auto Launch(const std::function<void()> &callback) -> void;
+        auto Launch(const std::function<void()> &callback, ThreadLaunchOptions options) -> void;
         auto Join() -> void;
 
         static auto InitialiseTLS() -> void;
@@ -19,6 +44,12 @@ namespace CoreThread {
         static auto DoGlobalQueueWork() -> void;
         static auto DistributeReservedJobs() -> void;
 
+        /**
+         * @brief Applies the options to the calling thread.
+         * @return `false` if any option could not be applied.
+         */
+        static auto ApplyLaunchOptions(const ThreadLaunchOptions &options) -> bool;
+
     private:
         std::mutex m_lock;
         std::vector<std::thread> m_threads;
@@ -0,0 +1,122 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace CoreThread {
+    enum class TickPhase : std::uint8_t {
+        NetworkReceive,
+        JobProcessing,   ///< The callback runs first, e.g. to push the tick's jobs, then the workers run jobs until the job deadline.
+        PacketAssembly,
+        Send,
+    };
+
+    inline constexpr std::size_t TICK_PHASE_COUNT = 4;
+
+    /**
+     * @brief Times of the tick being run, passed to the phase callbacks.
+     */
+    struct TickContext {
+        std::uint64_t tick = 0;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point deadline;      ///< Start of the next tick.
+        std::chrono::steady_clock::time_point job_deadline;  ///< Set before the job phase, the `end_tick_count` of the workers.
+    };
+
+    /**
+     * @brief What one tick took, passed to the tick observer after every tick.
+     */
+    struct TickStatistics {
+        std::uint64_t tick = 0;
+        std::array<std::chrono::nanoseconds, TICK_PHASE_COUNT> phase_durations{};
+        std::chrono::nanoseconds duration{};  ///< All phases.
+        std::chrono::nanoseconds overrun{};   ///< Past the deadline, zero if the tick finished in time.
+        std::uint64_t skipped_ticks = 0;      ///< Dropped before this one because the loop fell too far behind.
+    };
+
+    struct TickLoopOptions {
+        std::chrono::nanoseconds period = std::chrono::microseconds(15625);  ///< 64 ticks per second.
+        /// Kept free after the job phase, on top of the average time packet assembly and send took
+        std::chrono::nanoseconds send_reserve = std::chrono::microseconds(500);
+        /// Late ticks run back to back to catch up, beyond this many the loop drops them and restarts from now
+        std::uint32_t max_catch_up_ticks = 4;
+    };
+
+    /**
+     * @brief Fixed timestep server loop: network receive, job processing, packet assembly and send, every period.
+     *
+     * `Run` drives the phases on the calling thread. Ticks start on a fixed grid, a late tick
+     * shortens the wait for the next one instead of shifting the grid.
+     *
+     * The job phase ends at a deadline that leaves room for the phases after it. Their cost is
+     * estimated from the previous ticks, plus `send_reserve`. The deadline becomes the
+     * `ThreadLocal::end_tick_count` of the loop thread and of every thread in `RunWorker`, so
+     * `JobQueue::Execute` and `ThreadManager::DoGlobalQueueWork` yield in time for the send.
+     *
+     * Each tick's phase durations go to the tick observer. Overruns are counted and logged at most once a second.
+     */
+    class TickLoop {
+    public:
+        using PhaseCallback = std::function<void(const TickContext&)>;
+        using TickObserver = std::function<void(const TickStatistics&)>;
+
+        explicit TickLoop(TickLoopOptions options = {});
+        ~TickLoop() = default;
+
+        TickLoop(const TickLoop&) = delete;
+        TickLoop(TickLoop&&) = delete;
+        auto operator=(const TickLoop&) -> TickLoop& = delete;
+        auto operator=(TickLoop&&) -> TickLoop& = delete;
+
+        // Set before `Run`
+        auto SetPhase(TickPhase phase, PhaseCallback callback) -> void;
+        auto SetTickObserver(TickObserver observer) -> void;
+
+        /**
+         * @brief Runs ticks on the calling thread until `Stop`.
+         */
+        auto Run() -> void;
+
+        /**
+         * @brief Runs the job phase of every tick on the calling worker until `Stop`, e.g. as the callback of `ThreadManager::Launch`.
+         */
+        auto RunWorker() -> void;
+
+        /**
+         * @brief Ends `Run` and `RunWorker` after their current tick, any thread.
+         */
+        auto Stop() -> void;
+
+        /**
+         * @brief Runs one tick starting at `start` and returns its statistics, without waiting or notifying the observer.
+         */
+        auto RunTick(std::uint64_t tick, std::chrono::steady_clock::time_point start) -> TickStatistics;
+
+        [[nodiscard]] auto GetTickCount() const -> std::uint64_t;
+        [[nodiscard]] auto GetOverrunCount() const -> std::uint64_t;
+
+    private:
+        [[nodiscard]] auto IsStopped() const -> bool;
+        [[nodiscard]] auto GetJobDeadline(std::chrono::steady_clock::time_point deadline, std::chrono::steady_clock::time_point now) const -> std::chrono::steady_clock::time_point;
+        auto RunJobPhase(const TickContext& context) -> void;
+        auto ReportOverrun(const TickStatistics& statistics) -> void;
+
+        const TickLoopOptions m_options;
+        std::array<PhaseCallback, TICK_PHASE_COUNT> m_phases;
+        TickObserver m_observer;
+
+        // Loop thread only
+        std::chrono::nanoseconds m_send_estimate{};  ///< Moving average of packet assembly plus send.
+        std::chrono::steady_clock::time_point m_last_overrun_log;
+        std::uint64_t m_unlogged_overruns = 0;
+
+        std::atomic<std::uint32_t> m_stop = 0;       ///< Futex word, the loop sleeps on it between ticks.
+        std::atomic<std::uint32_t> m_job_epoch = 0;  ///< Bumped when a job phase starts, the workers sleep on it.
+        std::atomic<std::int64_t> m_job_deadline = 0;
+        std::atomic<std::uint64_t> m_tick_count = 0;
+        std::atomic<std::uint64_t> m_overrun_count = 0;
+    };
+}
\ No newline at end of file
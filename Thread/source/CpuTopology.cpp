@@ -0,0 +1,175 @@
+#include "CpuTopology.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace CoreThread {
+    namespace {
+        auto ReadLine(const std::filesystem::path& path) -> std::optional<std::string> {
+            std::ifstream file(path);
+            std::string line;
+            if (!file || !std::getline(file, line)) {
+                return std::nullopt;
+            }
+            return line;
+        }
+
+        auto ReadNumber(const std::filesystem::path& path) -> std::optional<std::uint32_t> {
+            const std::optional<std::string> line = ReadLine(path);
+            if (!line) {
+                return std::nullopt;
+            }
+            std::uint32_t value = 0;
+            const auto [end, error] = std::from_chars(line->data(), line->data() + line->size(), value);
+            if (error != std::errc{}) {
+                return std::nullopt;
+            }
+            return value;
+        }
+
+        // Far above any kernel's CPU limit, a larger id is a corrupt list rather than a CPU
+        constexpr std::uint32_t MAX_CPU_ID = 1U << 16U;
+
+        auto MakeFlat(std::uint32_t count) -> std::vector<LogicalCpu> {
+            std::vector<LogicalCpu> cpus;
+            for (std::uint32_t id = 0; id < std::max(count, 1U); id++) {
+                cpus.push_back(LogicalCpu{ id, id, 0, 0 });
+            }
+            return cpus;
+        }
+    }
+
+    auto CpuTopology::Discover() -> CpuTopology {
+#ifdef __linux__
+        return Discover("/sys");
+#else
+        CpuTopology topology;
+        topology.m_cpus = MakeFlat(std::thread::hardware_concurrency());
+        return topology;
+#endif
+    }
+
+    auto CpuTopology::Discover(const std::filesystem::path& sysfs_root) -> CpuTopology {
+        CpuTopology topology;
+        const std::filesystem::path cpu_root = sysfs_root / "devices/system/cpu";
+        const std::optional<std::string> online = ReadLine(cpu_root / "online");
+        if (!online) {
+            topology.m_cpus = MakeFlat(std::thread::hardware_concurrency());
+            return topology;
+        }
+
+        for (const std::uint32_t id : ParseCpuList(*online)) {
+            const std::filesystem::path topology_path = cpu_root / ("cpu" + std::to_string(id)) / "topology";
+            LogicalCpu cpu{ id, id, 0, 0 };
+            cpu.core_id = ReadNumber(topology_path / "core_id").value_or(id);
+            cpu.package_id = ReadNumber(topology_path / "physical_package_id").value_or(0);
+            topology.m_cpus.push_back(cpu);
+        }
+
+        // Machines without NUMA have no node directory, everything stays on node 0
+        std::error_code error;
+        for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(sysfs_root / "devices/system/node", error)) {
+            const std::string name = entry.path().filename().string();
+            std::uint32_t node = 0;
+            if (!name.starts_with("node") ||
+                    (std::from_chars(name.data() + 4, name.data() + name.size(), node).ec != std::errc{})) {
+                continue;
+            }
+            const std::optional<std::string> list = ReadLine(entry.path() / "cpulist");
+            if (!list) {
+                continue;
+            }
+            for (const std::uint32_t id : ParseCpuList(*list)) {
+                const auto found = std::ranges::find(topology.m_cpus, id, &LogicalCpu::id);
+                if (found != topology.m_cpus.end()) {
+                    found->numa_node = node;
+                }
+            }
+            topology.m_node_count = std::max(topology.m_node_count, node + 1);
+        }
+        return topology;
+    }
+
+    auto CpuTopology::GetNetworkDeviceCpus(std::string_view interface_name, const std::filesystem::path& sysfs_root) -> std::vector<std::uint32_t> {
+        const std::optional<std::string> list = ReadLine(sysfs_root / "class/net" / interface_name / "device/local_cpulist");
+        return list ? ParseCpuList(*list) : std::vector<std::uint32_t>{};
+    }
+
+    auto CpuTopology::ParseCpuList(std::string_view list) -> std::vector<std::uint32_t> {
+        std::vector<std::uint32_t> cpus;
+        while (!list.empty()) {
+            const std::size_t comma = list.find(',');
+            const std::string_view range = list.substr(0, comma);
+            list = (comma == std::string_view::npos) ? std::string_view{} : list.substr(comma + 1);
+
+            std::uint32_t first = 0;
+            const auto [first_end, first_error] = std::from_chars(range.data(), range.data() + range.size(), first);
+            if (first_error != std::errc{}) {
+                continue;
+            }
+            std::uint32_t last = first;
+            if ((first_end != range.data() + range.size()) && (*first_end == '-')) {
+                if (std::from_chars(first_end + 1, range.data() + range.size(), last).ec != std::errc{}) {
+                    continue;
+                }
+            }
+            if (last >= MAX_CPU_ID) {
+                continue;
+            }
+            for (std::uint32_t cpu = first; cpu <= last; cpu++) {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+    }
+
+    auto CpuTopology::GetPrimaryCpus() const -> std::vector<std::uint32_t> {
+        std::vector<std::uint32_t> cpus;
+        for (const LogicalCpu& cpu : m_cpus) {
+            // Sorted by id, so the first CPU seen of each core is its lowest numbered sibling
+            const bool seen = std::ranges::any_of(m_cpus, [&](const LogicalCpu& other) {
+                return (other.id < cpu.id) && (other.core_id == cpu.core_id) && (other.package_id == cpu.package_id);
+            });
+            if (!seen) {
+                cpus.push_back(cpu.id);
+            }
+        }
+        return cpus;
+    }
+
+    auto CpuTopology::GetNodeCpus(std::uint32_t node) const -> std::vector<std::uint32_t> {
+        std::vector<std::uint32_t> cpus;
+        for (const LogicalCpu& cpu : m_cpus) {
+            if (cpu.numa_node == node) {
+                cpus.push_back(cpu.id);
+            }
+        }
+        return cpus;
+    }
+
+    auto CpuTopology::GetSiblings(std::uint32_t cpu) const -> std::vector<std::uint32_t> {
+        const std::optional<LogicalCpu> found = FindCpu(cpu);
+        std::vector<std::uint32_t> cpus;
+        if (!found) {
+            return cpus;
+        }
+        for (const LogicalCpu& other : m_cpus) {
+            if ((other.core_id == found->core_id) && (other.package_id == found->package_id)) {
+                cpus.push_back(other.id);
+            }
+        }
+        return cpus;
+    }
+
+    auto CpuTopology::FindCpu(std::uint32_t cpu) const -> std::optional<LogicalCpu> {
+        const auto found = std::ranges::find(m_cpus, cpu, &LogicalCpu::id);
+        if (found == m_cpus.end()) {
+            return std::nullopt;
+        }
+        return *found;
+    }
+}
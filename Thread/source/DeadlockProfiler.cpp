@@ -1,115 +1,206 @@
 #include "DeadlockProfiler.hpp"
-#include <Log/Log.hpp>
+#include <algorithm>
+#include <atomic>
+#include <format>
+#include <Log.hpp>
 #include <libassert/assert.hpp>
 #include "ThreadLocals.hpp"
 
 namespace CoreThread {
-    void DeadLockProfiler::PushLock(const std::string& name) {
-        std::scoped_lock lock{m_lock};
-
-        // Find or issue an ID.
-        std::int32_t lock_id = 0;
+    namespace {
+        std::atomic<std::uint64_t> next_generation = 1;
 
-        auto find_iterator = m_name_to_id.find(name);
-        if (find_iterator == m_name_to_id.end()) {
-            lock_id = static_cast<std::int32_t>(m_name_to_id.size());
-            m_name_to_id[name] = lock_id;
-            m_id_to_name[lock_id] = name;
-        }
-        else {
-            lock_id = find_iterator->second;
+        auto MakeEdge(std::int32_t from, std::int32_t to) -> std::uint64_t {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(from)) << 32U) | static_cast<std::uint32_t>(to);
         }
+    }
+
+    struct DeadLockProfiler::ThreadCache {
+        std::uint64_t generation = 0;
+        ankerl::unordered_dense::map<std::uint64_t, std::int32_t> ids;
+        ankerl::unordered_dense::set<std::uint64_t> edges;
+    };
+
+    DeadLockProfiler::DeadLockProfiler() : m_generation(next_generation.fetch_add(1, std::memory_order_relaxed)) {}
+
+    void DeadLockProfiler::PushLock(const LockId& id) {
+        ThreadCache& cache = GetThreadCache();
+        const std::int32_t lock_id = GetIndex(cache, id);
 
         // If there was a lock to hold on to
-        if (ThreadLocal::LockStack.empty() == false) {
-            // If it is a case that has not been discovered previously, check again for deadlock.
-            const std::int32_t prev_id = ThreadLocal::LockStack.top();
-            if (lock_id != prev_id) {
-                std::set<std::int32_t>& history = m_lock_history[prev_id];
-                if (history.find(lock_id) == history.end()) {
-                    history.insert(lock_id);
-                    CheckCycle();
-                }
+        const std::uint32_t depth = ThreadLocal::lock_stack_depth;
+        if (depth > 0) {
+            // Only an edge this thread has not seen before can change the graph
+            const std::int32_t prev_id = ThreadLocal::lock_stack[depth - 1];
+            if ((lock_id != prev_id) && cache.edges.insert(MakeEdge(prev_id, lock_id)).second) {
+                std::scoped_lock lock{m_lock};
+                AddEdge(prev_id, lock_id);
             }
         }
 
-        ThreadLocal::LockStack.push(lock_id);
+        DEBUG_ASSERT(depth < ThreadLocal::MAX_LOCK_DEPTH, "Too many locks held at once for the deadlock profiler");
+        ThreadLocal::lock_stack[depth] = lock_id;
+        ThreadLocal::lock_stack_depth = depth + 1;
     }
 
-    void DeadLockProfiler::PopLock(const std::string& name) {
-        std::scoped_lock lock{m_lock};
-
-        DEBUG_ASSERT(!ThreadLocal::LockStack.empty(), "Trying to unlock lock multiple times");
-
-        std::int32_t lock_id = m_name_to_id[name];
+    void DeadLockProfiler::PopLock(const LockId& id) {
+        const std::uint32_t depth = ThreadLocal::lock_stack_depth;
+        DEBUG_ASSERT(depth > 0, "Trying to unlock lock multiple times");
 
-        DEBUG_ASSERT(ThreadLocal::LockStack.top() == lock_id, "Trying to unlock out of order");
+        [[maybe_unused]] const std::int32_t lock_id = GetIndex(GetThreadCache(), id);
+        DEBUG_ASSERT(ThreadLocal::lock_stack[depth - 1] == lock_id, "Trying to unlock out of order");
 
-        ThreadLocal::LockStack.pop();
+        ThreadLocal::lock_stack_depth = depth - 1;
     }
 
-    void DeadLockProfiler::CheckCycle() {
-        const std::int32_t lock_count = static_cast<std::int32_t>(m_name_to_id.size());
-        m_discovered_order = std::vector<std::int32_t>(lock_count, -1);
-        m_discovered_count = 0;
-        m_finished = std::vector<bool>(lock_count, false);
-        m_parent = std::vector<std::int32_t>(lock_count, -1);
+    auto DeadLockProfiler::GetCycleCount() -> std::uint32_t {
+        std::scoped_lock lock{m_lock};
+        return m_cycle_count;
+    }
 
-        for (std::int32_t lock_id = 0; lock_id < lock_count; lock_id++) {
-            Dfs(lock_id);
+    auto DeadLockProfiler::GetThreadCache() -> ThreadCache& {
+        thread_local ThreadCache cache;
+        if (cache.generation != m_generation) {
+            cache.generation = m_generation;
+            cache.ids.clear();
+            cache.edges.clear();
         }
-
-
-        // When the computation is complete, clean up.
-        m_discovered_order.clear();
-        m_finished.clear();
-        m_parent.clear();
+        return cache;
     }
 
-    void DeadLockProfiler::Dfs(std::int32_t here) {
-        if (m_discovered_order[here] != -1)
-            return;
+    auto DeadLockProfiler::GetIndex(ThreadCache& cache, const LockId& id) -> std::int32_t {
+        const auto cached = cache.ids.find(id.value);
+        if (cached != cache.ids.end()) {
+            return cached->second;
+        }
 
-        m_discovered_order[here] = m_discovered_count++;
+        std::scoped_lock lock{m_lock};
+        const auto [find_iterator, inserted] = m_id_to_index.try_emplace(id.value, static_cast<std::int32_t>(m_index_to_id.size()));
+        if (inserted) {
+            // A new lock has no edges, it can go anywhere in the order
+            m_index_to_id.push_back(id);
+            m_successors.emplace_back();
+            m_predecessors.emplace_back();
+            m_order.push_back(find_iterator->second);
+            m_visited.push_back(false);
+            m_parent.push_back(-1);
+        }
+        cache.ids.emplace(id.value, find_iterator->second);
+        return find_iterator->second;
+    }
 
-        // Iterate through all adjacent vertices.
-        auto find_iterator = m_lock_history.find(here);
-        if (find_iterator == m_lock_history.end()) {
-            m_finished[here] = true;
+    auto DeadLockProfiler::AddEdge(std::int32_t from, std::int32_t to) -> void {
+        if (!m_edges.insert(MakeEdge(from, to)).second) {
             return;
         }
 
-        std::set<std::int32_t>& next_set = find_iterator->second;
-        for (std::int32_t there : next_set) {
-            // If you haven't visited yet, go visit.
-            if (m_discovered_order[there] == -1) {
-                m_parent[there] = here;
-                Dfs(there);
-                continue;
+        // Already ordered: from before to. Otherwise only the locks ordered between to and from can be affected.
+        const std::int32_t lower_bound = m_order[to];
+        const std::int32_t upper_bound = m_order[from];
+        if (lower_bound < upper_bound) {
+            m_forward.clear();
+            m_backward.clear();
+            if (SearchForward(to, upper_bound, from)) {
+                ReportCycle(from, to);
+                ++m_cycle_count;
+                for (const std::int32_t index : m_forward) {
+                    m_visited[index] = false;
+                }
+                for (const std::int32_t index : m_pending) {
+                    m_visited[index] = false;
+                }
+                // Left out of the graph, its order could not be kept
+                m_edges.erase(MakeEdge(from, to));
+                DEBUG_ASSERT(false, "Deadlock detected");
+                return;
             }
+            SearchBackward(from, lower_bound);
+            Reorder();
+        }
 
-            // If here was discovered before there, then there is a descendant of here. (forward trunk)
-            if (m_discovered_order[here] < m_discovered_order[there]) {
-                continue;
-            }
+        m_successors[from].push_back(to);
+        m_predecessors[to].push_back(from);
+    }
 
-            // If it is not forward, and Dfs(there) has not yet ended, then there is an ancestor of here. (reverse main line)
-            if (m_finished[there] == false) {
-                CORE_CRITICAL("{} -> {}", m_id_to_name[here], m_id_to_name[there]);
-
-                std::int32_t now = here;
-                while (true) {
-                    CORE_CRITICAL("{} -> {}", m_id_to_name[m_parent[now]], m_id_to_name[now]);
-                    now = m_parent[now];
-                    if (now == there) {
-                        break;
-                    }
+    auto DeadLockProfiler::SearchForward(std::int32_t from, std::int32_t upper_bound, std::int32_t target) -> bool {
+        m_pending.assign(1, from);
+        m_visited[from] = true;
+        m_parent[from] = -1;
+        while (!m_pending.empty()) {
+            const std::int32_t here = m_pending.back();
+            m_pending.pop_back();
+            m_forward.push_back(here);
+            for (const std::int32_t there : m_successors[here]) {
+                if (there == target) {
+                    m_parent[target] = here;
+                    return true;
                 }
+                if (!m_visited[there] && (m_order[there] < upper_bound)) {
+                    m_visited[there] = true;
+                    m_parent[there] = here;
+                    m_pending.push_back(there);
+                }
+            }
+        }
+        return false;
+    }
 
-                DEBUG_ASSERT(false, "Deadlock detected");
+    auto DeadLockProfiler::SearchBackward(std::int32_t from, std::int32_t lower_bound) -> void {
+        m_pending.assign(1, from);
+        m_visited[from] = true;
+        while (!m_pending.empty()) {
+            const std::int32_t here = m_pending.back();
+            m_pending.pop_back();
+            m_backward.push_back(here);
+            for (const std::int32_t there : m_predecessors[here]) {
+                if (!m_visited[there] && (m_order[there] > lower_bound)) {
+                    m_visited[there] = true;
+                    m_pending.push_back(there);
+                }
             }
         }
+    }
+
+    auto DeadLockProfiler::Reorder() -> void {
+        // The locks reaching the tail go first, those reached from the head after, each keeping its relative order,
+        // on the positions the two sets held before
+        const auto by_order = [this](std::int32_t index) { return m_order[index]; };
+        std::ranges::sort(m_backward, std::ranges::less{}, by_order);
+        std::ranges::sort(m_forward, std::ranges::less{}, by_order);
+
+        m_pending.clear();
+        for (const std::int32_t index : m_backward) {
+            m_pending.push_back(m_order[index]);
+        }
+        for (const std::int32_t index : m_forward) {
+            m_pending.push_back(m_order[index]);
+        }
+        std::ranges::sort(m_pending);
+
+        std::size_t position = 0;
+        for (const std::int32_t index : m_backward) {
+            m_order[index] = m_pending[position++];
+            m_visited[index] = false;
+        }
+        for (const std::int32_t index : m_forward) {
+            m_order[index] = m_pending[position++];
+            m_visited[index] = false;
+        }
+    }
+
+    auto DeadLockProfiler::ReportCycle(std::int32_t from, std::int32_t to) const -> void {
+        CORE_CRITICAL("{} -> {}", GetName(from), GetName(to));
+
+        // The forward search went from `to` back to `from`
+        std::int32_t now = from;
+        while (now != to) {
+            CORE_CRITICAL("{} -> {}", GetName(m_parent[now]), GetName(now));
+            now = m_parent[now];
+        }
+    }
 
-        m_finished[here] = true;
+    auto DeadLockProfiler::GetName(std::int32_t index) const -> std::string {
+        const LockId& id = m_index_to_id[index];
+        return std::format("{}[{}]", id.owner, id.GetIndex());
     }
 }
\ No newline at end of file
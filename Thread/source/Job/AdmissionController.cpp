@@ -0,0 +1,71 @@
+#include "Job/AdmissionController.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace CoreThread::Job {
+    namespace {
+        constexpr std::uint32_t FULL_ADMISSION = 1000;
+        constexpr std::int64_t NO_DELAY = std::numeric_limits<std::int64_t>::max();
+
+        // Spreads the admitted calls of a thread evenly over every thousand, 611 is coprime to 1000
+        thread_local std::uint32_t admit_counter = 0;
+    }
+
+    AdmissionController::AdmissionController(AdmissionOptions options) : m_options(options),
+            m_interval_end((std::chrono::steady_clock::now() + options.interval).time_since_epoch().count()), m_interval_min(NO_DELAY) {
+    }
+
+    auto AdmissionController::RecordDelay(std::chrono::nanoseconds delay, std::chrono::steady_clock::time_point now) -> void {
+        const std::int64_t nanoseconds = delay.count();
+        std::int64_t min = m_interval_min.load(std::memory_order_relaxed);
+        while ((nanoseconds < min) && !m_interval_min.compare_exchange_weak(min, nanoseconds, std::memory_order_relaxed)) {
+        }
+
+        const std::int64_t now_count = now.time_since_epoch().count();
+        std::int64_t interval_end = m_interval_end.load(std::memory_order_relaxed);
+        if ((now_count >= interval_end) &&
+                m_interval_end.compare_exchange_strong(interval_end, now_count + m_options.interval.count(), std::memory_order_relaxed)) {
+            Adjust(m_interval_min.exchange(NO_DELAY, std::memory_order_relaxed));
+        }
+    }
+
+    auto AdmissionController::Admit() -> bool {
+        const std::uint32_t permille = m_admit_permille.load(std::memory_order_relaxed);
+        if (permille >= FULL_ADMISSION) {
+            return true;
+        }
+        admit_counter = (admit_counter + 611) % FULL_ADMISSION;
+        if (admit_counter < permille) {
+            return true;
+        }
+        m_rejected_count.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    auto AdmissionController::GetAdmitPermille() const -> std::uint32_t {
+        return m_admit_permille.load(std::memory_order_relaxed);
+    }
+
+    auto AdmissionController::IsOverloaded() const -> bool {
+        return GetAdmitPermille() < FULL_ADMISSION;
+    }
+
+    auto AdmissionController::GetRejectedCount() const -> std::uint64_t {
+        return m_rejected_count.load(std::memory_order_relaxed);
+    }
+
+    auto AdmissionController::Adjust(std::int64_t min_delay) -> void {
+        // An interval without measurements says nothing, e.g. the queues were idle
+        if (min_delay == NO_DELAY) {
+            return;
+        }
+        const std::uint32_t permille = m_admit_permille.load(std::memory_order_relaxed);
+        if (min_delay > m_options.target_delay.count()) {
+            m_admit_permille.store(std::max(permille - permille / 4, m_options.min_admit_permille), std::memory_order_relaxed);
+        }
+        else {
+            m_admit_permille.store(std::min(permille + m_options.admit_increase_permille, FULL_ADMISSION), std::memory_order_relaxed);
+        }
+    }
+}
\ No newline at end of file
@@ -1,19 +1,76 @@
-#include "Job/GlobalQueue.h"
-#include "Job/JobQueue.h"
+#include "Job/GlobalQueue.hpp"
+#include "Job/Job.hpp"
+#include "Job/JobQueue.hpp"
+#include "ThreadLocals.hpp"
 
-namespace CoreThread::Job {
+#include <bit>
+#include <libassert/assert.hpp>
 
-    GlobalQueue::GlobalQueue() {
+namespace CoreThread::Job {
+    GlobalQueue::GlobalQueue(const std::uint32_t worker_count, const std::chrono::nanoseconds affinity_steal_delay)
+            : m_scheduler(worker_count, affinity_steal_delay) {
     }
 
     GlobalQueue::~GlobalQueue() {
+        // Drop the references of the job queues and the jobs that never ran, also those still in an inbox
+        m_scheduler.Drain([](const std::uintptr_t item) {
+            if ((item & JOB_TAG) != 0) {
+                Job::Release(std::bit_cast<Job*>(item & ~JOB_TAG));
+            } else {
+                std::bit_cast<JobQueue*>(item)->m_scheduled_reference.reset();
+            }
+        });
+    }
+
+    auto GlobalQueue::RegisterWorker() -> void {
+        ThreadLocal::worker_index = m_scheduler.RegisterWorker();
+    }
+
+    auto GlobalQueue::Push(std::shared_ptr<JobQueue> job_queue) -> void {
+        JobQueue *raw{ job_queue.get() };
+        raw->m_scheduled_reference = std::move(job_queue);
+        m_scheduler.PushTo(std::bit_cast<std::uintptr_t>(raw), raw->GetPreferredWorker(), ThreadLocal::worker_index);
+    }
+
+    auto GlobalQueue::Push(Job* job) -> void {
+        DEBUG_ASSERT((std::bit_cast<std::uintptr_t>(job) & JOB_TAG) == 0);
+        m_scheduler.Push(std::bit_cast<std::uintptr_t>(job) | JOB_TAG, ThreadLocal::worker_index);
+    }
+
+    auto GlobalQueue::TryExecute() -> bool {
+        const std::optional<std::uintptr_t> item{ m_scheduler.Pop(ThreadLocal::worker_index) };
+        if (!item) {
+            return false;
+        }
+        if ((*item & JOB_TAG) != 0) {
+            Job* job = std::bit_cast<Job*>(*item & ~JOB_TAG);
+            job->Execute();
+            Job::Release(job);
+            return true;
+        }
+        // Hold the reference while executing, Execute may schedule the queue again
+        const std::shared_ptr<JobQueue> job_queue = std::move(std::bit_cast<JobQueue*>(*item)->m_scheduled_reference);
+        // Not when run inline by a pushing thread, only a worker drains the inbox the queue goes back to
+        if (ThreadLocal::worker_index != JobQueue::NO_WORKER) {
+            job_queue->m_last_worker.store(ThreadLocal::worker_index, std::memory_order_relaxed);
+        }
+        job_queue->Execute();
+        return true;
+    }
+
+    auto GlobalQueue::Park(const std::chrono::steady_clock::time_point deadline) -> void {
+        m_scheduler.Park(deadline, ThreadLocal::worker_index);
+    }
+
+    auto GlobalQueue::Stop() -> void {
+        m_scheduler.Stop();
     }
 
-    void GlobalQueue::Push(std::shared_ptr<JobQueue> jobQueue) {
-        m_job_queues.Push(jobQueue);
+    auto GlobalQueue::GetWorkerCount() const noexcept -> std::uint32_t {
+        return m_scheduler.GetWorkerCount();
     }
 
-    std::shared_ptr<JobQueue> GlobalQueue::Pop() {
-        return m_job_queues.Pop();
+    auto GlobalQueue::SetAffinityStealDelay(const std::chrono::nanoseconds delay) noexcept -> void {
+        m_scheduler.SetStealDelay(delay);
     }
-}
\ No newline at end of file
+}
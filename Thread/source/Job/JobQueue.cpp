@@ -1,15 +1,38 @@
+#include <algorithm>
 #include <chrono>
+#include <vector>
+#include <Concurrent/ConcurrentCommon.hpp>
+#include <libassert/assert.hpp>
 
-#include "Job/JobQueue.h"
-#include "ThreadLocals.h"
-#include "Job/GlobalQueue.h"
-#include "Job/Job.h"
+#include "Job/JobQueue.hpp"
+#include "ThreadLocals.hpp"
+#include "Job/AdmissionController.hpp"
+#include "Job/GlobalQueue.hpp"
+#include "Job/Job.hpp"
 
 namespace CoreThread::Job {
 
-    void JobQueue::Push(std::shared_ptr<Job> job, bool pushOnly) {
+    JobQueue::JobQueue(JobQueueLimits limits) : m_limits(limits) {
+        DEBUG_ASSERT(limits.capacity > 0, "A job queue needs room for at least one job");
+    }
+
+    JobQueue::~JobQueue() {
+        while (Job* job = m_jobs.Pop()) {
+            Job::Release(job);
+        }
+    }
+
+    bool JobQueue::Push(Job* job, bool pushOnly) {
+        if ((m_limits.policy == OverflowPolicy::Reject) && job->IsSheddable() &&
+                (m_job_count.load(std::memory_order_relaxed) >= m_limits.capacity)) {
+            Job::Release(job);
+            m_rejected_count.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        job->SetEnqueueTime(std::chrono::steady_clock::now());
         const std::int32_t prevCount = m_job_count.fetch_add(1);
-        m_jobs.Push(job); // WRITE_LOCK
+        m_jobs.Push(job);
 
         // The thread that entered the first job is responsible for execution.
         if (prevCount == 0) {
@@ -22,22 +45,46 @@ namespace CoreThread::Job {
                 Global::GGlobalQueue->Push(shared_from_this());
             }
         }
+        return true;
     }
 
-    // 1) What if you get too busy with work?
     void JobQueue::Execute() {
         ThreadLocal::CurrentJobQueue = this;
+        std::vector<Job*>& jobs = ThreadLocal::job_batch;
 
         while (true) {
-            CoreMemory::Vector<std::shared_ptr<Job>> jobs;
-            m_jobs.PopAll(jobs);
+            // Take only the jobs counted so far, so a steady stream of pushes cannot keep the drain going
+            const std::int32_t pending = m_job_count.load(std::memory_order_acquire) - m_dropped_count;
+            while (static_cast<std::int32_t>(jobs.size()) < pending) {
+                Job* job = m_jobs.Pop();
+                if (job == nullptr) {
+                    if (!jobs.empty()) {
+                        break;
+                    }
+                    // Counted but not linked yet, the producer is between its two stores
+                    Synapse::STL::Concurrent::SpinLoopPause();
+                    continue;
+                }
+                jobs.push_back(job);
+            }
+
+            RecordDelay(jobs);
+            if (m_limits.policy != OverflowPolicy::Reject) {
+                ShedOverflow(jobs);
+            }
 
             const std::int32_t jobCount = static_cast<std::int32_t>(jobs.size());
-            for (std::int32_t i = 0; i < jobCount; i++)
+            for (std::int32_t i = 0; i < jobCount; i++) {
                 jobs[i]->Execute();
+                Job::Release(jobs[i]);
+            }
+            jobs.clear();
+
+            const std::int32_t doneCount = jobCount + m_dropped_count;
+            m_dropped_count = 0;
 
             // Quit if there are 0 tasks remaining
-            if (m_job_count.fetch_sub(jobCount) == jobCount) {
+            if (m_job_count.fetch_sub(doneCount) == doneCount) {
                 ThreadLocal::CurrentJobQueue = nullptr;
                 return;
             }
@@ -51,4 +98,87 @@ namespace CoreThread::Job {
             }
         }
     }
+
+    void JobQueue::RecordDelay(const std::vector<Job*>& jobs) {
+        const std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now();
+        Synapse::STL::Log2Histogram delays;
+        for (const Job* job : jobs) {
+            delays.Record(static_cast<std::uint64_t>(std::max((now - job->GetEnqueueTime()).count(), std::chrono::nanoseconds::rep{ 0 })));
+        }
+        // One atomic add per bucket hit rather than per job
+        for (std::size_t bucket = 0; bucket < Synapse::STL::Log2Histogram::BUCKET_COUNT; bucket++) {
+            if (delays.counts[bucket] != 0) {
+                m_queue_delay[bucket].fetch_add(delays.counts[bucket], std::memory_order_relaxed);
+            }
+        }
+        // The queue is FIFO, the first job waited the longest
+        Global::GAdmissionController->RecordDelay(now - jobs.front()->GetEnqueueTime(), now);
+    }
+
+    void JobQueue::ShedOverflow(std::vector<Job*>& jobs) {
+        std::int32_t shed = 0;
+        if (m_limits.policy == OverflowPolicy::Coalesce) {
+            ankerl::unordered_dense::set<std::uint64_t>& keys = ThreadLocal::coalesce_keys;
+            keys.clear();
+            // Newest first, an older job with a key already seen is superseded
+            for (auto job = jobs.rbegin(); job != jobs.rend(); ++job) {
+                const std::uint64_t key = (*job)->GetCoalesceKey();
+                if ((key != 0) && (*job)->IsSheddable() && !keys.insert(key).second) {
+                    Job::Release(*job);
+                    *job = nullptr;
+                    shed++;
+                }
+            }
+        }
+
+        std::int32_t excess = static_cast<std::int32_t>(jobs.size()) - shed - m_limits.capacity;
+        for (std::size_t i = 0; (i < jobs.size()) && (excess > 0); i++) {
+            if ((jobs[i] != nullptr) && jobs[i]->IsSheddable()) {
+                Job::Release(jobs[i]);
+                jobs[i] = nullptr;
+                shed++;
+                excess--;
+            }
+        }
+
+        if (shed != 0) {
+            std::erase(jobs, nullptr);
+            m_dropped_count += shed;
+            m_shed_count.fetch_add(static_cast<std::uint64_t>(shed), std::memory_order_relaxed);
+        }
+    }
+
+    Synapse::STL::Log2Histogram JobQueue::GetQueueDelay() const {
+        Synapse::STL::Log2Histogram delays;
+        for (std::size_t bucket = 0; bucket < Synapse::STL::Log2Histogram::BUCKET_COUNT; bucket++) {
+            delays.counts[bucket] = m_queue_delay[bucket].load(std::memory_order_relaxed);
+        }
+        return delays;
+    }
+
+    std::uint64_t JobQueue::GetRejectedCount() const {
+        return m_rejected_count.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t JobQueue::GetShedCount() const {
+        return m_shed_count.load(std::memory_order_relaxed);
+    }
+
+    void JobQueue::SetHomeWorker(std::uint32_t worker) {
+        m_home_worker.store(worker, std::memory_order_relaxed);
+    }
+
+    std::uint32_t JobQueue::GetPreferredWorker() const {
+        const std::uint32_t home = m_home_worker.load(std::memory_order_relaxed);
+        return (home != NO_WORKER) ? home : m_last_worker.load(std::memory_order_relaxed);
+    }
+
+    void JobQueue::ClearJobs() {
+        DEBUG_ASSERT(ThreadLocal::CurrentJobQueue == this, "Jobs can only be cleared by the thread executing the queue");
+        // Execute subtracts the dropped jobs from the count, so the queue is not handed to a second thread meanwhile
+        while (Job* job = m_jobs.Pop()) {
+            Job::Release(job);
+            ++m_dropped_count;
+        }
+    }
 }
@@ -1,56 +1,180 @@
-#include "Job/JobTimer.h"
-#include "Job/JobQueue.h"
+#include "Job/JobTimer.hpp"
+#include "Job/JobQueue.hpp"
+
+#include <thread>
+#include <utility>
+#include <libassert/assert.hpp>
 
 namespace CoreThread::Job {
-    void JobTimer::Reserve(std::uint64_t tick_after, std::weak_ptr<JobQueue> owner, std::shared_ptr<Job> job) {
-        const std::chrono::time_point<std::chrono::steady_clock> execute_tick = std::chrono::steady_clock::now() + std::chrono::milliseconds(tick_after);
-        JobData* jobData = CoreMemory::ObjectPool<JobData>::Pop(owner, job);
+    JobTimer::JobTimer() : m_wheel(ToTick(std::chrono::steady_clock::now())) {
+    }
+
+    JobTimer::~JobTimer() {
+        Clear();
+    }
+
+    auto JobTimer::Reserve(std::uint64_t tick_after, std::weak_ptr<JobQueue> owner, Job* job) -> TimerHandle {
+        TimerEntry* entry = AcquireEntry();
+        if (entry == nullptr) {
+            DEBUG_ASSERT(false, "JobTimer is full");
+            Job::Release(job);
+            return TimerHandle{};
+        }
 
-        WRITE_LOCK;
+        entry->due_tick = ToTick(std::chrono::steady_clock::now()) + tick_after;
+        entry->owner = std::move(owner);
+        entry->job = job;
+        const auto generation = static_cast<std::uint32_t>(entry->state.load(std::memory_order_relaxed) >> 2);
+        entry->state.store(MakeState(generation, STATE_PENDING), std::memory_order_release);
+        m_reserved.Push(entry);
+        return TimerHandle{ entry->index, generation };
+    }
 
-        m_items.push(TimerItem{ execute_tick, jobData });
+    auto JobTimer::Cancel(TimerHandle handle) -> bool {
+        if (handle.IsNull() || ((handle.index >> CHUNK_BITS) >= MAX_CHUNKS) ||
+                (m_chunks[handle.index >> CHUNK_BITS].load(std::memory_order_acquire) == nullptr)) {
+            return false;
+        }
+        std::uint64_t expected = MakeState(handle.generation, STATE_PENDING);
+        return GetEntry(handle.index).state.compare_exchange_strong(expected, MakeState(handle.generation, STATE_CANCELLED),
+                std::memory_order_acq_rel, std::memory_order_relaxed);
     }
 
-    void JobTimer::Distribute(std::chrono::time_point<std::chrono::steady_clock> now) {
+    auto JobTimer::Distribute(std::chrono::time_point<std::chrono::steady_clock> now) -> void {
         // Only 1 thread passes at a time
         if (m_distributing.exchange(true) == true) {
             return;
         }
 
-        CoreMemory::Vector<TimerItem> items;
+        DrainReserved();
+        m_wheel.Advance(ToTick(now), [this](const std::uint32_t index) { Collect(GetEntry(index), true); });
 
-        {
-            WRITE_LOCK;
+        for (DueJob& due : m_due_jobs) {
+            if (std::shared_ptr<JobQueue> owner = due.owner.lock())
+                owner->Push(due.job);
+            else
+                Job::Release(due.job);
+        }
+        m_due_jobs.clear();
 
-            while (m_items.empty() == false) {
-                const TimerItem& timerItem = m_items.top();
-                if (now < timerItem.m_execute_tick) {
-                    break;
-                }
+        // Release when finished.
+        m_distributing.store(false);
+    }
+
+    auto JobTimer::Clear() -> void {
+        while (m_distributing.exchange(true) == true) {
+            std::this_thread::yield();
+        }
+
+        DrainReserved();
+        m_wheel.Clear([this](const std::uint32_t index) { Collect(GetEntry(index), false); });
+
+        m_distributing.store(false);
+    }
+
+    auto JobTimer::ToTick(std::chrono::time_point<std::chrono::steady_clock> time) noexcept -> std::uint64_t {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count());
+    }
+
+    auto JobTimer::MakeState(std::uint32_t generation, std::uint64_t status) noexcept -> std::uint64_t {
+        return (static_cast<std::uint64_t>(generation) << 2) | status;
+    }
+
+    auto JobTimer::GetEntry(std::uint32_t index) const noexcept -> TimerEntry& {
+        return m_chunks[index >> CHUNK_BITS].load(std::memory_order_acquire)[index & (CHUNK_SIZE - 1)];
+    }
 
-                items.push_back(timerItem);
-                m_items.pop();
+    auto JobTimer::AcquireEntry() -> TimerEntry* {
+        std::uint64_t head = m_free_head.load(std::memory_order_acquire);
+        while (true) {
+            const auto index = static_cast<std::uint32_t>(head);
+            if (index == NO_ENTRY) {
+                if (!Grow()) {
+                    return nullptr;
+                }
+                head = m_free_head.load(std::memory_order_acquire);
+                continue;
+            }
+            TimerEntry& entry = GetEntry(index);
+            // A stale next is caught by the tag, the entries themselves are never freed
+            const std::uint64_t next = entry.next_free.load(std::memory_order_relaxed);
+            const std::uint64_t tag = (head >> 32) + 1;
+            if (m_free_head.compare_exchange_weak(head, (tag << 32) | next, std::memory_order_acquire, std::memory_order_acquire)) {
+                return &entry;
             }
         }
+    }
+
+    auto JobTimer::ReleaseEntry(TimerEntry& entry) noexcept -> void {
+        entry.owner.reset();
+        entry.job = nullptr;
+        const auto generation = static_cast<std::uint32_t>(entry.state.load(std::memory_order_relaxed) >> 2);
+        // Skip 0 on wrap around, it marks the null handle; stale handles no longer match
+        entry.state.store(MakeState((generation == 0x3FFFFFFF) ? 1 : (generation + 1), STATE_FREE), std::memory_order_release);
+        PushFree(entry.index, entry.index);
+    }
 
-        for (TimerItem& item : items) {
-            if (std::shared_ptr<JobQueue> owner = item.m_job_data->m_owner.lock())
-                owner->Push(item.m_job_data->m_job);
+    auto JobTimer::PushFree(std::uint32_t first, std::uint32_t last) noexcept -> void {
+        std::uint64_t head = m_free_head.load(std::memory_order_relaxed);
+        do {
+            GetEntry(last).next_free.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+        } while (!m_free_head.compare_exchange_weak(head, ((head >> 32) + 1) << 32 | first, std::memory_order_release, std::memory_order_relaxed));
+    }
 
-            CoreMemory::ObjectPool<JobData>::Push(item.m_job_data);
+    auto JobTimer::Grow() -> bool {
+        std::scoped_lock lock(m_grow_mutex);
+        if (static_cast<std::uint32_t>(m_free_head.load(std::memory_order_acquire)) != NO_ENTRY) {
+            // Another thread grew the table meanwhile
+            return true;
+        }
+        if (m_chunk_count == MAX_CHUNKS) {
+            return false;
         }
 
-        // Release when finished.
-        m_distributing.store(false);
+        std::unique_ptr<TimerEntry[]> chunk = std::make_unique<TimerEntry[]>(CHUNK_SIZE);
+        const std::uint32_t first = m_chunk_count << CHUNK_BITS;
+        for (std::uint32_t i = 0; i < CHUNK_SIZE; i++) {
+            chunk[i].index = first + i;
+            chunk[i].state.store(MakeState(1, STATE_FREE), std::memory_order_relaxed);
+            chunk[i].next_free.store(first + i + 1, std::memory_order_relaxed);
+        }
+        m_chunks[m_chunk_count].store(chunk.get(), std::memory_order_release);
+        m_chunk_storage.push_back(std::move(chunk));
+        m_chunk_count++;
+        PushFree(first, first + CHUNK_SIZE - 1);
+        return true;
     }
 
-    void JobTimer::Clear() {
-        WRITE_LOCK
+    auto JobTimer::Collect(TimerEntry& entry, bool due) -> void {
+        const std::uint64_t state = entry.state.load(std::memory_order_acquire);
+        const auto generation = static_cast<std::uint32_t>(state >> 2);
+        if (due) {
+            // Claim the entry, a racing Cancel either wins before this or fails after it
+            std::uint64_t expected = MakeState(generation, STATE_PENDING);
+            if (entry.state.compare_exchange_strong(expected, MakeState(generation, STATE_FREE), std::memory_order_acq_rel,
+                    std::memory_order_acquire)) {
+                m_due_jobs.push_back(DueJob{ std::move(entry.owner), entry.job });
+                ReleaseEntry(entry);
+                return;
+            }
+        }
+        else {
+            // Cancel as if the caller had, the entry is released below either way
+            std::uint64_t expected = MakeState(generation, STATE_PENDING);
+            (void)entry.state.compare_exchange_strong(expected, MakeState(generation, STATE_CANCELLED), std::memory_order_acq_rel,
+                    std::memory_order_acquire);
+        }
+        Job::Release(entry.job);
+        ReleaseEntry(entry);
+    }
 
-        while (m_items.empty() == false) {
-            const TimerItem& timerItem = m_items.top();
-            CoreMemory::ObjectPool<JobData>::Push(timerItem.m_job_data);
-            m_items.pop();
+    auto JobTimer::DrainReserved() -> void {
+        while (TimerEntry* entry = m_reserved.Pop()) {
+            if ((entry->state.load(std::memory_order_acquire) & STATE_MASK) == STATE_CANCELLED) {
+                Collect(*entry, false);
+                continue;
+            }
+            m_wheel.Insert(entry->due_tick, entry->index);
         }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1 @@
+#include "Job/ParallelFor.hpp"
\ No newline at end of file
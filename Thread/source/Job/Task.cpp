@@ -0,0 +1 @@
+#include "Job/Task.hpp"
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "Job/TaskGraph.hpp"
+#include "Job/GlobalQueue.hpp"
+#include "Job/Job.hpp"
+
+#include <utility>
+#include <libassert/assert.hpp>
+
+namespace CoreThread::Job {
+    TaskGraph::TaskGraph() : m_state(std::make_shared<State>()) {
+    }
+
+    auto TaskGraph::Add(Callback&& callback) -> TaskId {
+        std::unique_ptr<Task> task = std::make_unique<Task>();
+        task->callback = std::move(callback);
+        m_state->tasks.push_back(std::move(task));
+        return static_cast<TaskId>(m_state->tasks.size() - 1);
+    }
+
+    auto TaskGraph::Precede(TaskId before, TaskId after) -> void {
+        DEBUG_ASSERT((before < m_state->tasks.size()) && (after < m_state->tasks.size()), "Invalid task id", before, after);
+        DEBUG_ASSERT(before != after, "A task cannot wait for itself", before);
+        m_state->tasks[before]->successors.push_back(after);
+        m_state->tasks[after]->dependency_count++;
+    }
+
+    auto TaskGraph::Run() -> void {
+        DEBUG_ASSERT(IsAcyclic(), "TaskGraph has a dependency cycle");
+        State& state = *m_state;
+        if (state.tasks.empty()) {
+            return;
+        }
+
+        state.remaining.store(static_cast<std::uint32_t>(state.tasks.size()), std::memory_order_relaxed);
+        for (const std::unique_ptr<Task>& task : state.tasks) {
+            task->pending.store(task->dependency_count, std::memory_order_relaxed);
+        }
+        for (TaskId id = 0; id < state.tasks.size(); id++) {
+            if (state.tasks[id]->dependency_count == 0) {
+                state.MakeReady(id);
+            }
+        }
+
+        // Help instead of only waiting, the tasks may not find a free worker
+        while (state.remaining.load(std::memory_order_acquire) != 0) {
+            const std::uint32_t signal = state.signal.load(std::memory_order_acquire);
+            if (state.TryRunOne()) {
+                continue;
+            }
+            if (state.remaining.load(std::memory_order_acquire) == 0) {
+                break;
+            }
+            state.signal.wait(signal, std::memory_order_acquire);
+        }
+    }
+
+    auto TaskGraph::GetTaskCount() const noexcept -> std::size_t {
+        return m_state->tasks.size();
+    }
+
+    auto TaskGraph::IsAcyclic() const -> bool {
+        // Kahn's algorithm, every task gets visited only if no cycle blocks it
+        const std::vector<std::unique_ptr<Task>>& tasks = m_state->tasks;
+        std::vector<std::uint32_t> pending(tasks.size());
+        std::vector<TaskId> ready;
+        for (TaskId id = 0; id < tasks.size(); id++) {
+            pending[id] = tasks[id]->dependency_count;
+            if (pending[id] == 0) {
+                ready.push_back(id);
+            }
+        }
+        std::size_t visited = 0;
+        while (!ready.empty()) {
+            const TaskId id = ready.back();
+            ready.pop_back();
+            visited++;
+            for (const TaskId successor : tasks[id]->successors) {
+                if (--pending[successor] == 0) {
+                    ready.push_back(successor);
+                }
+            }
+        }
+        return visited == tasks.size();
+    }
+
+    auto TaskGraph::State::MakeReady(TaskId task) -> void {
+        {
+            std::scoped_lock lock(ready_mutex);
+            ready.push_back(task);
+        }
+        Global::GGlobalQueue->Push(Job::Create([state = shared_from_this()] { (void)state->TryRunOne(); }));
+        signal.fetch_add(1, std::memory_order_release);
+        signal.notify_one();
+    }
+
+    auto TaskGraph::State::TryRunOne() -> bool {
+        TaskId id;
+        {
+            std::scoped_lock lock(ready_mutex);
+            if (ready.empty()) {
+                return false;
+            }
+            id = ready.back();
+            ready.pop_back();
+        }
+        Task& task = *tasks[id];
+        task.callback();
+        Finish(task);
+        return true;
+    }
+
+    auto TaskGraph::State::Finish(const Task& task) -> void {
+        for (const TaskId successor : task.successors) {
+            if (tasks[successor]->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                MakeReady(successor);
+            }
+        }
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            signal.fetch_add(1, std::memory_order_release);
+            signal.notify_one();
+        }
+    }
+}
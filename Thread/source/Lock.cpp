@@ -1,86 +1,181 @@
-#include "Lock.h"
-#include "DeadLockProfiler.h"
-#include "ThreadLocals.h"
+#include "Lock.hpp"
+#include "DeadlockProfiler.hpp"
+#include "LockProfiler.hpp"
+#include "ThreadLocals.hpp"
 
-#include <Log.h>
+#include <algorithm>
+#include <format>
+#include <string>
+#include <Log.hpp>
 #include <libassert/assert.hpp>
 
 namespace CoreThread {
-    void Lock::WriteLock(const std::string& name) {
+    void Lock::WriteLock([[maybe_unused]] const LockId& id) {
 #if _DEBUG
-        Global::GDeadLockProfiler->PushLock(name);
+        Global::GDeadLockProfiler->PushLock(id);
 #endif
 
+        DEBUG_ASSERT(ThreadLocal::thread_id != NO_OWNER, "Thread ids start at 1, the thread has to call ThreadManager::InitialiseTLS");
+
         // If owned by the same thread, success is guaranteed.
-        const std::uint32_t lock_thread_id = (m_lock_flag.load() & WRITE_THREAD_MASK) >> 16;
-        if (ThreadLocal::thread_id == lock_thread_id) {
+        if (m_write_owner.load(std::memory_order_relaxed) == ThreadLocal::thread_id) {
             ++m_write_count;
             return;
         }
 
-        // When no one owns or shares something, it competes for ownership.
-        const std::chrono::time_point<std::chrono::steady_clock> begin_tick = std::chrono::steady_clock::now();
-        const std::uint32_t desired = ((ThreadLocal::thread_id << 16) & WRITE_THREAD_MASK);
-        while (true) {
-            for (std::uint32_t spin_count = 0; spin_count < MAX_SPIN_COUNT; ++spin_count) {
-                std::uint32_t expected = EMPTY_FLAG;
-                if (m_lock_flag.compare_exchange_strong(expected, desired)) {
-                    ++m_write_count;
-                    return;
-                }
-            }
-
-            DEBUG_ASSERT(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin_tick) < ACQUIRE_TIMEOUT_TICK, "Lock timed out. Thread has not been able to acquire lock in 10s!");
-
-            std::this_thread::yield();
-        }
+#if SYNAPSE_LOCK_PROFILE
+        m_write_acquired = ProfileAcquire(id, false);
+#else
+        AcquireExclusive(nullptr);
+#endif
+        m_write_owner.store(ThreadLocal::thread_id, std::memory_order_relaxed);
+        ++m_write_count;
     }
 
-    void Lock::WriteUnlock(const std::string& name) {
+    void Lock::WriteUnlock([[maybe_unused]] const LockId& id) {
 #if _DEBUG
-        Global::GDeadLockProfiler->PopLock(name);
+        Global::GDeadLockProfiler->PopLock(id);
 #endif
 
-        DEBUG_ASSERT((m_lock_flag.load() & READ_COUNT_MASK) == 0, "WriteUnlock is not possible until ReadLock is unlocked.");
+        DEBUG_ASSERT(m_write_owner.load(std::memory_order_relaxed) == ThreadLocal::thread_id, "WriteUnlock from a thread that does not own the lock.");
 
-        const std::int32_t lock_count = --m_write_count;
+        const std::uint32_t lock_count = --m_write_count;
         if (lock_count == 0) {
-            m_lock_flag.store(EMPTY_FLAG);
+            m_write_owner.store(NO_OWNER, std::memory_order_relaxed);
+#if SYNAPSE_LOCK_PROFILE
+            const std::chrono::steady_clock::time_point acquired = m_write_acquired;
+            m_mutex.Unlock();
+            ProfileRelease(id, false, acquired);
+#else
+            m_mutex.Unlock();
+#endif
         }
     }
 
-    void Lock::ReadLock(const std::string& name) {
+    void Lock::ReadLock([[maybe_unused]] const LockId& id) {
 #if _DEBUG
-        Global::GDeadLockProfiler->PushLock(name);
+        Global::GDeadLockProfiler->PushLock(id);
 #endif
 
-        // If owned by the same thread, success is guaranteed.
-        const std::uint32_t lock_thread_id = (m_lock_flag.load() & WRITE_THREAD_MASK) >> 16;
-        if (ThreadLocal::thread_id == lock_thread_id) {
-            m_lock_flag.fetch_add(1);
+        // If owned by the same thread, or already read by it, success is guaranteed.
+        std::vector<const Lock*>& read_locks = ThreadLocal::held_read_locks;
+        if ((m_write_owner.load(std::memory_order_relaxed) == ThreadLocal::thread_id) || (std::ranges::find(read_locks, this) != read_locks.end())) {
+            m_mutex.LockSharedRecursive();
+            read_locks.push_back(this);
+#if SYNAPSE_LOCK_PROFILE
+            ThreadLocal::held_read_since.emplace_back();
+#endif
             return;
         }
 
-        // When no one owns something, it competes to raise the share count.
-        const std::chrono::time_point<std::chrono::steady_clock> begin_tick = std::chrono::steady_clock::now();
-        while (true) {
-            for (std::uint32_t spin_count = 0; spin_count < MAX_SPIN_COUNT; ++spin_count) {
-                std::uint32_t expected = (m_lock_flag.load() & READ_COUNT_MASK);
-                if (m_lock_flag.compare_exchange_strong(expected, expected + 1))
-                    return;
-            }
+#if SYNAPSE_LOCK_PROFILE
+        ThreadLocal::held_read_since.push_back(ProfileAcquire(id, true));
+#else
+        AcquireShared(nullptr);
+#endif
+        read_locks.push_back(this);
+    }
 
-            // LOCK_TIMEOUT
-            DEBUG_ASSERT(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin_tick) < ACQUIRE_TIMEOUT_TICK, "Lock timed out. Thread has not been able to acquire lock in 10s!");
+    void Lock::ReadUnlock([[maybe_unused]] const LockId& id) {
+#if _DEBUG
+        Global::GDeadLockProfiler->PopLock(id);
+#endif
+
+        std::vector<const Lock*>& read_locks = ThreadLocal::held_read_locks;
+        const auto held = std::ranges::find(read_locks.rbegin(), read_locks.rend(), this);
+        DEBUG_ASSERT(held != read_locks.rend(), "Trying to unlock the same lock multiple times");
+#if SYNAPSE_LOCK_PROFILE
+        const auto since = ThreadLocal::held_read_since.begin() + std::distance(read_locks.begin(), std::next(held).base());
+        const std::chrono::steady_clock::time_point acquired = *since;
+        ThreadLocal::held_read_since.erase(since);
+#endif
+        read_locks.erase(std::next(held).base());
+        m_mutex.UnlockShared();
+#if SYNAPSE_LOCK_PROFILE
+        // Only the release matching the acquisition that took the mutex, nested reads were not recorded
+        if ((m_write_owner.load(std::memory_order_relaxed) != ThreadLocal::thread_id) && (std::ranges::find(read_locks, this) == read_locks.end())) {
+            ProfileRelease(id, true, acquired);
+        }
+#endif
+    }
 
-            std::this_thread::yield();
+    void Lock::AcquireExclusive(Synapse::STL::Concurrent::AcquireStatistics* statistics) {
+#if _DEBUG
+        if (!m_mutex.TryLockUntil(std::chrono::steady_clock::now() + ACQUIRE_TIMEOUT_TICK, statistics)) {
+            DEBUG_ASSERT(false, "Lock timed out. Thread has not been able to acquire lock in 10s!");
+            m_mutex.Lock(statistics);
         }
+#else
+        m_mutex.Lock(statistics);
+#endif
     }
 
-    void Lock::ReadUnlock(const std::string& name) {
+    void Lock::AcquireShared(Synapse::STL::Concurrent::AcquireStatistics* statistics) {
 #if _DEBUG
-        Global::GDeadLockProfiler->PopLock(name);
+        if (!m_mutex.TryLockSharedUntil(std::chrono::steady_clock::now() + ACQUIRE_TIMEOUT_TICK, statistics)) {
+            DEBUG_ASSERT(false, "Lock timed out. Thread has not been able to acquire lock in 10s!");
+            m_mutex.LockShared(statistics);
+        }
+#else
+        m_mutex.LockShared(statistics);
 #endif
-        DEBUG_ASSERT((m_lock_flag.fetch_sub(1) & READ_COUNT_MASK) != 0, "Trying to unlock the same lock multiple times");
     }
+
+#if SYNAPSE_LOCK_PROFILE
+    std::chrono::steady_clock::time_point Lock::ProfileAcquire(const LockId& id, bool shared) {
+#ifdef TRACY_ENABLE
+        if (!m_tracy_named.load(std::memory_order_relaxed) && !m_tracy_named.exchange(true, std::memory_order_relaxed)) {
+            const std::string name = std::format("{}[{}]", id.owner, id.GetIndex());
+            m_tracy_context.CustomName(name.data(), name.size());
+        }
+        const bool tracy_after = shared ? m_tracy_context.BeforeLockShared() : m_tracy_context.BeforeLock();
+#endif
+        // Uncontended acquisitions do not read the clock unless their hold is sampled
+        Synapse::STL::Concurrent::AcquireStatistics statistics;
+        std::chrono::steady_clock::time_point acquired{};
+        if (shared ? m_mutex.TryLockShared() : m_mutex.TryLock()) {
+            if (LockProfiler::SampleHold()) {
+                acquired = std::chrono::steady_clock::now();
+            }
+            Global::GLockProfiler->RecordAcquire(id, std::chrono::nanoseconds{}, statistics);
+        }
+        else {
+            statistics.contended = true;
+            const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+            if (shared) {
+                AcquireShared(&statistics);
+            }
+            else {
+                AcquireExclusive(&statistics);
+            }
+            acquired = std::chrono::steady_clock::now();
+            Global::GLockProfiler->RecordAcquire(id, acquired - begin, statistics);
+        }
+#ifdef TRACY_ENABLE
+        if (tracy_after) {
+            if (shared) {
+                m_tracy_context.AfterLockShared();
+            }
+            else {
+                m_tracy_context.AfterLock();
+            }
+        }
+#endif
+        return acquired;
+    }
+
+    void Lock::ProfileRelease(const LockId& id, [[maybe_unused]] bool shared, std::chrono::steady_clock::time_point acquired) {
+#ifdef TRACY_ENABLE
+        if (shared) {
+            m_tracy_context.AfterUnlockShared();
+        }
+        else {
+            m_tracy_context.AfterUnlock();
+        }
+#endif
+        if (acquired != std::chrono::steady_clock::time_point{}) {
+            Global::GLockProfiler->RecordHold(id, std::chrono::steady_clock::now() - acquired);
+        }
+    }
+#endif
 }
\ No newline at end of file
@@ -0,0 +1 @@
+#include "LockId.hpp"
\ No newline at end of file
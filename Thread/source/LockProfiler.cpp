@@ -0,0 +1,125 @@
+#include "LockProfiler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <Log.hpp>
+
+namespace CoreThread {
+    namespace {
+        std::atomic<std::uint64_t> next_generation = 1;
+
+        struct ThreadBufferCache {
+            std::uint64_t generation = 0;
+            void* buffer = nullptr;
+        };
+        thread_local ThreadBufferCache buffer_cache;
+        thread_local std::uint32_t hold_sample_counter = 0;
+
+        auto Record(Synapse::STL::Log2Histogram& histogram, std::chrono::nanoseconds& total,
+                std::chrono::nanoseconds& max, std::chrono::nanoseconds duration) -> void {
+            histogram.Record(static_cast<std::uint64_t>(duration.count()));
+            total += duration;
+            max = std::max(max, duration);
+        }
+    }
+
+    auto LockSiteStatistics::Merge(const LockSiteStatistics& other) -> void {
+        acquisitions += other.acquisitions;
+        contended_acquisitions += other.contended_acquisitions;
+        spin_rounds += other.spin_rounds;
+        sleeps += other.sleeps;
+        hold_samples += other.hold_samples;
+        total_wait += other.total_wait;
+        max_wait = std::max(max_wait, other.max_wait);
+        total_hold += other.total_hold;
+        max_hold = std::max(max_hold, other.max_hold);
+        wait_histogram.Merge(other.wait_histogram);
+        hold_histogram.Merge(other.hold_histogram);
+    }
+
+    LockProfiler::LockProfiler() : m_generation(next_generation.fetch_add(1, std::memory_order_relaxed)) {}
+
+    auto LockProfiler::RecordAcquire(const LockId& id, std::chrono::nanoseconds wait, const Synapse::STL::Concurrent::AcquireStatistics& statistics) -> void {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        std::scoped_lock lock{ buffer.mutex };
+        LockSiteStatistics& site = GetSite(buffer, id);
+        ++site.acquisitions;
+        if (statistics.contended) {
+            ++site.contended_acquisitions;
+            site.spin_rounds += statistics.spin_rounds;
+            site.sleeps += statistics.sleeps;
+        }
+        if (wait.count() > 0) {
+            Record(site.wait_histogram, site.total_wait, site.max_wait, wait);
+        }
+    }
+
+    auto LockProfiler::RecordHold(const LockId& id, std::chrono::nanoseconds hold) -> void {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        std::scoped_lock lock{ buffer.mutex };
+        LockSiteStatistics& site = GetSite(buffer, id);
+        ++site.hold_samples;
+        Record(site.hold_histogram, site.total_hold, site.max_hold, hold);
+    }
+
+    auto LockProfiler::SampleHold() -> bool {
+        return (++hold_sample_counter % HOLD_SAMPLE_PERIOD) == 0;
+    }
+
+    auto LockProfiler::GetReport() const -> std::vector<LockSiteStatistics> {
+        ankerl::unordered_dense::map<std::uint64_t, LockSiteStatistics> merged;
+        {
+            std::scoped_lock buffers_lock{ m_buffers_lock };
+            for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers) {
+                std::scoped_lock lock{ buffer->mutex };
+                for (const auto& [value, site] : buffer->sites) {
+                    const auto [found, inserted] = merged.try_emplace(value, LockSiteStatistics{ .id = site.id });
+                    found->second.Merge(site);
+                }
+            }
+        }
+
+        std::vector<LockSiteStatistics> report;
+        report.reserve(merged.size());
+        for (auto& [value, site] : merged) {
+            report.push_back(site);
+        }
+        std::ranges::sort(report, std::ranges::greater{}, &LockSiteStatistics::total_wait);
+        return report;
+    }
+
+    auto LockProfiler::LogReport() const -> void {
+        for (const LockSiteStatistics& site : GetReport()) {
+            const double contended_percent = (site.acquisitions == 0) ? 0.0 :
+                    100.0 * static_cast<double>(site.contended_acquisitions) / static_cast<double>(site.acquisitions);
+            CORE_INFO("Lock {}[{}]: {} acquisitions, {:.1f}% contended, wait total {}us p50 {}ns p99 {}ns max {}ns, "
+                    "hold p50 {}ns p99 {}ns max {}ns, {} spin rounds, {} sleeps",
+                    site.id.owner, site.id.GetIndex(), site.acquisitions, contended_percent,
+                    std::chrono::duration_cast<std::chrono::microseconds>(site.total_wait).count(),
+                    site.wait_histogram.GetQuantile(0.5), site.wait_histogram.GetQuantile(0.99),
+                    site.max_wait.count(), site.hold_histogram.GetQuantile(0.5),
+                    site.hold_histogram.GetQuantile(0.99), site.max_hold.count(), site.spin_rounds, site.sleeps);
+        }
+    }
+
+    auto LockProfiler::Reset() -> void {
+        std::scoped_lock buffers_lock{ m_buffers_lock };
+        for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers) {
+            std::scoped_lock lock{ buffer->mutex };
+            buffer->sites.clear();
+        }
+    }
+
+    auto LockProfiler::GetSite(ThreadBuffer& buffer, const LockId& id) -> LockSiteStatistics& {
+        const auto [found, inserted] = buffer.sites.try_emplace(id.value, LockSiteStatistics{ .id = id });
+        return found->second;
+    }
+
+    auto LockProfiler::GetThreadBuffer() -> ThreadBuffer& {
+        if (buffer_cache.generation != m_generation) {
+            std::scoped_lock lock{ m_buffers_lock };
+            m_buffers.push_back(std::make_unique<ThreadBuffer>());
+            buffer_cache = ThreadBufferCache{ m_generation, m_buffers.back().get() };
+        }
+        return *static_cast<ThreadBuffer*>(buffer_cache.buffer);
+    }
+}
\ No newline at end of file
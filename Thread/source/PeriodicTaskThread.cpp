@@ -1,17 +1,25 @@
-#include "PeriodicTaskThread.h"
+#include "PeriodicTaskThread.hpp"
+#include "Job/GlobalQueue.hpp"
+#include "Job/Job.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <Concurrent/Futex.hpp>
 
 namespace CoreThread {
-    PeriodicTaskThread::PeriodicTaskThread() : m_current_time() {
+    PeriodicTaskThread::PeriodicTaskThread() {
     }
 
     PeriodicTaskThread::~PeriodicTaskThread() {
-        {
-            std::scoped_lock sync_lock{ m_sync };
-            m_elements.clear();
+        // Before the members go, the base class destructor would close too late
+        CloseThread();
+        while (Command* command = m_commands.Pop()) {
+            delete command;
         }
     }
 
     bool PeriodicTaskThread::Initialise() {
+        m_stop.store(false, std::memory_order_relaxed);
         return (StartThread());
     }
 
@@ -19,32 +27,112 @@ namespace CoreThread {
         CloseThread();
     }
 
+    bool PeriodicTaskThread::RegisterPeriodicTask(std::uint32_t id, std::uint32_t time_period, Callback&& callback, PeriodicTaskMode mode) {
+        std::scoped_lock lock{ m_registered_mutex };
+        if (!m_registered.insert(id).second) {
+            return false;
+        }
+
+        Command* command = new Command();
+        command->id = id;
+        command->task = std::make_shared<TaskState>();
+        command->task->id = id;
+        command->task->period = std::max<std::chrono::nanoseconds>(std::chrono::milliseconds{ time_period }, std::chrono::nanoseconds{ 1 });
+        command->task->mode = mode;
+        command->task->callback = std::move(callback);
+        PushCommand(command);
+        return true;
+    }
+
     void PeriodicTaskThread::KillPeriodicTask(const std::uint32_t id) {
-        std::scoped_lock sync_lock{ m_sync };
-        std::map<std::uint32_t, PeriodicTask>::iterator it = m_elements.find(id);
-        if (it != m_elements.end()) {
-            m_elements.erase(it);
+        std::scoped_lock lock{ m_registered_mutex };
+        if (m_registered.erase(id) == 0) {
+            return;
         }
+
+        Command* command = new Command();
+        command->id = id;
+        PushCommand(command);
+    }
+
+    void PeriodicTaskThread::PushCommand(Command* command) {
+        m_commands.Push(command);
+        m_wake.fetch_add(1, std::memory_order_release);
+        Synapse::STL::Concurrent::FutexWakeAll(m_wake);
     }
 
     void PeriodicTaskThread::RunThreadProcess() {
-        while (m_thread_running) {
-            std::chrono::time_point<std::chrono::steady_clock> current_time = std::chrono::steady_clock::now();
-
-            {
-                std::scoped_lock sync_lock{ m_sync };
-                for (std::pair<const std::uint32_t, PeriodicTask>& elem : m_elements) {
-                    if (current_time > elem.second.last_time + std::chrono::milliseconds(elem.second.time_period)) {
-                        elem.second.last_time = current_time;
-                        elem.second.m_func(elem.first, current_time);
-                    }
+        while (!m_stop.load(std::memory_order_acquire)) {
+            // Read before draining, a command pushed after the drain changes it and the wait returns at once
+            const std::uint32_t wake = m_wake.load(std::memory_order_acquire);
+            DrainCommands();
+            DispatchDue(std::chrono::steady_clock::now());
+
+            std::optional<std::chrono::nanoseconds> timeout;
+            if (!m_deadlines.empty()) {
+                timeout = m_deadlines.front().due - std::chrono::steady_clock::now();
+                if (timeout->count() <= 0) {
+                    continue;
                 }
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            Synapse::STL::Concurrent::FutexWait(m_wake, wake, timeout);
+        }
+    }
+
+    void PeriodicTaskThread::DrainCommands() {
+        while (Command* command = m_commands.Pop()) {
+            const std::unique_ptr<Command> owned{ command };
+            if (command->task == nullptr) {
+                // Its heap entry is dropped when it comes up
+                m_tasks.erase(command->id);
+                continue;
+            }
+
+            std::shared_ptr<TaskState>& task = command->task;
+            task->generation = ++m_generation;
+            m_deadlines.push_back(Deadline{ std::chrono::steady_clock::now() + task->period, task->id, task->generation });
+            std::ranges::push_heap(m_deadlines, std::ranges::greater{}, &Deadline::due);
+            m_tasks[command->id] = std::move(task);
+        }
+    }
+
+    void PeriodicTaskThread::DispatchDue(std::chrono::time_point<std::chrono::steady_clock> now) {
+        while (!m_deadlines.empty() && (m_deadlines.front().due <= now)) {
+            std::ranges::pop_heap(m_deadlines, std::ranges::greater{}, &Deadline::due);
+            Deadline deadline = m_deadlines.back();
+            m_deadlines.pop_back();
+
+            const auto found = m_tasks.find(deadline.id);
+            if ((found == m_tasks.end()) || (found->second->generation != deadline.generation)) {
+                continue;
+            }
+
+            const std::shared_ptr<TaskState>& task = found->second;
+            if (!task->running.exchange(true, std::memory_order_acquire)) {
+                Global::GGlobalQueue->Push(Job::Job::Create([task, due = deadline.due] {
+                    task->callback(task->id, due);
+                    task->running.store(false, std::memory_order_release);
+                }));
+            }
+
+            if (task->mode == PeriodicTaskMode::FixedRate) {
+                // Stay on the grid of the registration, skipping the runs that are already over
+                const std::int64_t behind = (now - deadline.due) / task->period;
+                deadline.due += task->period * (behind + 1);
+            }
+            else {
+                deadline.due = now + task->period;
+            }
+            m_deadlines.push_back(deadline);
+            std::ranges::push_heap(m_deadlines, std::ranges::greater{}, &Deadline::due);
         }
     }
 
     void PeriodicTaskThread::ImplementCloseThread() {
+        m_stop.store(true, std::memory_order_release);
+        m_wake.fetch_add(1, std::memory_order_release);
+        Synapse::STL::Concurrent::FutexWakeAll(m_wake);
+
         if (m_thread_running) {
             StopRunning();
         }
@@ -1,8 +1,15 @@
 #include "ThreadLocals.hpp"
+#include <Concurrent/WorkStealingScheduler.hpp>
 
 namespace CoreThread::ThreadLocal {
     thread_local std::uint32_t thread_id = 0;
     thread_local std::chrono::time_point<std::chrono::steady_clock> end_tick_count;
-    thread_local std::stack<std::int32_t> LockStack;
+    thread_local std::array<std::int32_t, MAX_LOCK_DEPTH> lock_stack;
+    thread_local std::uint32_t lock_stack_depth = 0;
     thread_local Job::JobQueue* CurrentJobQueue = nullptr;
+    thread_local std::vector<Job::Job*> job_batch;
+    thread_local ankerl::unordered_dense::set<std::uint64_t> coalesce_keys;
+    thread_local std::uint32_t worker_index = Synapse::STL::Concurrent::WorkStealingScheduler<std::uintptr_t>::NO_WORKER;
+    thread_local std::vector<const Lock*> held_read_locks;
+    thread_local std::vector<std::chrono::steady_clock::time_point> held_read_since;
 }
@@ -1,9 +1,27 @@
 #include "ThreadManager.hpp"
+#include "CpuTopology.hpp"
 #include "ThreadLocals.hpp"
 #include "Job/GlobalQueue.hpp"
 #include "Job/JobQueue.hpp"
 #include "Job/JobTimer.hpp"
 
+#include <array>
+#include <climits>
+#include <Log.hpp>
+#include <tracy/Tracy.hpp>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+
 
 namespace CoreThread {
     ThreadManager::ThreadManager() {
@@ -25,6 +43,20 @@ namespace CoreThread {
         });
     }
 
+    auto ThreadManager::Launch(const std::function<void(void)> &callback, ThreadLaunchOptions options) -> void {
+        std::scoped_lock s_lock{ m_lock };
+
+        (void)m_threads.emplace_back([=, options = std::move(options)]() {
+            InitialiseTLS();
+            (void)ApplyLaunchOptions(options);
+            if (options.global_queue_worker) {
+                Global::GGlobalQueue->RegisterWorker();
+            }
+            callback();
+            DestroyTLS();
+        });
+    }
+
     auto ThreadManager::Join() -> void {
         for (std::thread& t : m_threads) {
             if (t.joinable()) {
@@ -49,12 +81,10 @@ namespace CoreThread {
                 break;
             }
 
-            std::shared_ptr<Job::JobQueue> job_queue = Global::GGlobalQueue->Pop();
-            if (job_queue == nullptr) {
-                break;
+            if (!Global::GGlobalQueue->TryExecute()) {
+                // Sleep instead of spinning, a push wakes us up
+                Global::GGlobalQueue->Park(ThreadLocal::end_tick_count);
             }
-
-            job_queue->Execute();
         }
     }
 
@@ -63,4 +93,87 @@ namespace CoreThread {
 
         Global::GJobTimer->Distribute(now);
     }
+
+    auto ThreadManager::ApplyLaunchOptions(const ThreadLaunchOptions &options) -> bool {
+        bool applied = true;
+        if (!options.name.empty()) {
+            // Sets the OS thread name too, truncated where the platform limits it
+            tracy::SetThreadName(options.name.c_str());
+        }
+
+        std::vector<std::uint32_t> cpus = options.cpus;
+        if (cpus.empty() && options.numa_node) {
+            cpus = CpuTopology::Discover().GetNodeCpus(*options.numa_node);
+        }
+
+#ifdef __linux__
+        if (!cpus.empty()) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (const std::uint32_t cpu : cpus) {
+                if (cpu < CPU_SETSIZE) {
+                    CPU_SET(cpu, &set);
+                }
+            }
+            if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+                CORE_WARN("Thread {}: could not set the CPU affinity", ThreadLocal::thread_id);
+                applied = false;
+            }
+        }
+
+        if (options.numa_node) {
+            std::array<unsigned long, 16> node_mask{};
+            constexpr std::size_t BITS = sizeof(unsigned long) * CHAR_BIT;
+            if (*options.numa_node < node_mask.size() * BITS) {
+                node_mask[*options.numa_node / BITS] |= 1UL << (*options.numa_node % BITS);
+            }
+            // Preferred rather than bound, allocations fall back to other nodes when this one is full
+            if (::syscall(SYS_set_mempolicy, MPOL_PREFERRED, node_mask.data(), node_mask.size() * BITS) != 0) {
+                CORE_WARN("Thread {}: could not prefer memory of NUMA node {}", ThreadLocal::thread_id, *options.numa_node);
+                applied = false;
+            }
+        }
+
+        if (options.policy == SchedulingPolicy::RealTime) {
+            sched_param parameter{};
+            parameter.sched_priority = options.priority;
+            if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameter) != 0) {
+                CORE_WARN("Thread {}: SCHED_FIFO not permitted, staying time shared", ThreadLocal::thread_id);
+                applied = false;
+            }
+        }
+        else if (options.priority != 0) {
+            if (setpriority(PRIO_PROCESS, static_cast<id_t>(::syscall(SYS_gettid)), options.priority) != 0) {
+                CORE_WARN("Thread {}: could not set nice value {}", ThreadLocal::thread_id, options.priority);
+                applied = false;
+            }
+        }
+#elif defined(_WIN32)
+        if (!cpus.empty()) {
+            DWORD_PTR mask = 0;
+            for (const std::uint32_t cpu : cpus) {
+                if (cpu < sizeof(DWORD_PTR) * CHAR_BIT) {
+                    mask |= DWORD_PTR{ 1 } << cpu;
+                }
+            }
+            if (SetThreadAffinityMask(GetCurrentThread(), mask) == 0) {
+                CORE_WARN("Thread {}: could not set the CPU affinity", ThreadLocal::thread_id);
+                applied = false;
+            }
+        }
+        if (options.policy == SchedulingPolicy::RealTime) {
+            if (SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) == 0) {
+                CORE_WARN("Thread {}: could not raise the priority", ThreadLocal::thread_id);
+                applied = false;
+            }
+        }
+        // Memory follows the first touch on Windows, running on the node's CPUs is enough
+#else
+        if (!cpus.empty() || options.numa_node || (options.policy != SchedulingPolicy::Default) || (options.priority != 0)) {
+            CORE_WARN("Thread {}: placement and scheduling options are not supported on this platform", ThreadLocal::thread_id);
+            applied = false;
+        }
+#endif
+        return applied;
+    }
 }
\ No newline at end of file
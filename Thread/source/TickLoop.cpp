@@ -0,0 +1,166 @@
+#include "TickLoop.hpp"
+#include "ThreadLocals.hpp"
+#include "ThreadManager.hpp"
+
+#include <algorithm>
+#include <Concurrent/Futex.hpp>
+#include <Log.hpp>
+
+namespace CoreThread {
+    namespace {
+        constexpr auto Index(TickPhase phase) -> std::size_t {
+            return static_cast<std::size_t>(phase);
+        }
+
+        auto ToMicroseconds(std::chrono::nanoseconds duration) -> std::int64_t {
+            return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        }
+    }
+
+    TickLoop::TickLoop(TickLoopOptions options) : m_options(options) {
+    }
+
+    auto TickLoop::SetPhase(TickPhase phase, PhaseCallback callback) -> void {
+        m_phases[Index(phase)] = std::move(callback);
+    }
+
+    auto TickLoop::SetTickObserver(TickObserver observer) -> void {
+        m_observer = std::move(observer);
+    }
+
+    auto TickLoop::Run() -> void {
+        std::uint64_t tick = m_tick_count.load(std::memory_order_relaxed);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::uint64_t skipped = 0;
+        while (!IsStopped()) {
+            TickStatistics statistics = RunTick(tick, start);
+            statistics.skipped_ticks = skipped;
+            if (statistics.overrun.count() > 0) {
+                ReportOverrun(statistics);
+            }
+            if (m_observer) {
+                m_observer(statistics);
+            }
+
+            // The next tick starts on the grid, right away if this one was late
+            tick++;
+            start += m_options.period;
+            skipped = 0;
+            const std::chrono::nanoseconds behind = std::chrono::steady_clock::now() - start;
+            if (behind > m_options.period * m_options.max_catch_up_ticks) {
+                skipped = static_cast<std::uint64_t>(behind / m_options.period);
+                start += m_options.period * skipped;
+                tick += skipped;
+            }
+
+            while (!IsStopped()) {
+                const std::chrono::nanoseconds remaining = start - std::chrono::steady_clock::now();
+                if (remaining.count() <= 0) {
+                    break;
+                }
+                Synapse::STL::Concurrent::FutexWait(m_stop, 0, remaining);
+            }
+        }
+    }
+
+    auto TickLoop::RunWorker() -> void {
+        std::uint32_t seen = m_job_epoch.load(std::memory_order_acquire);
+        while (!IsStopped()) {
+            const std::uint32_t epoch = m_job_epoch.load(std::memory_order_acquire);
+            if (epoch == seen) {
+                Synapse::STL::Concurrent::FutexWait(m_job_epoch, epoch);
+                continue;
+            }
+            seen = epoch;
+            ThreadLocal::end_tick_count = std::chrono::steady_clock::time_point{ std::chrono::nanoseconds{ m_job_deadline.load(std::memory_order_relaxed) } };
+            ThreadManager::DoGlobalQueueWork();
+        }
+    }
+
+    auto TickLoop::Stop() -> void {
+        m_stop.store(1, std::memory_order_release);
+        Synapse::STL::Concurrent::FutexWakeAll(m_stop);
+        m_job_epoch.fetch_add(1, std::memory_order_release);
+        Synapse::STL::Concurrent::FutexWakeAll(m_job_epoch);
+    }
+
+    auto TickLoop::RunTick(std::uint64_t tick, std::chrono::steady_clock::time_point start) -> TickStatistics {
+        TickContext context{ tick, start, start + m_options.period, {} };
+        TickStatistics statistics{};
+        statistics.tick = tick;
+
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point phase_start = begin;
+        for (std::size_t phase = 0; phase < TICK_PHASE_COUNT; phase++) {
+            if (phase == Index(TickPhase::JobProcessing)) {
+                context.job_deadline = GetJobDeadline(context.deadline, phase_start);
+                RunJobPhase(context);
+            }
+            else if (m_phases[phase]) {
+                m_phases[phase](context);
+            }
+            const std::chrono::steady_clock::time_point phase_end = std::chrono::steady_clock::now();
+            statistics.phase_durations[phase] = phase_end - phase_start;
+            phase_start = phase_end;
+        }
+        statistics.duration = phase_start - begin;
+        statistics.overrun = std::max(std::chrono::nanoseconds{}, std::chrono::nanoseconds{ phase_start - context.deadline });
+
+        // Moving average over about eight ticks, the job budget of the next tick leaves room for it
+        const std::chrono::nanoseconds send = statistics.phase_durations[Index(TickPhase::PacketAssembly)] + statistics.phase_durations[Index(TickPhase::Send)];
+        m_send_estimate += (send - m_send_estimate) / 8;
+
+        m_tick_count.fetch_add(1, std::memory_order_relaxed);
+        if (statistics.overrun.count() > 0) {
+            m_overrun_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        return statistics;
+    }
+
+    auto TickLoop::GetTickCount() const -> std::uint64_t {
+        return m_tick_count.load(std::memory_order_relaxed);
+    }
+
+    auto TickLoop::GetOverrunCount() const -> std::uint64_t {
+        return m_overrun_count.load(std::memory_order_relaxed);
+    }
+
+    auto TickLoop::IsStopped() const -> bool {
+        return m_stop.load(std::memory_order_acquire) != 0;
+    }
+
+    auto TickLoop::GetJobDeadline(std::chrono::steady_clock::time_point deadline, std::chrono::steady_clock::time_point now) const -> std::chrono::steady_clock::time_point {
+        return std::max(now, deadline - m_send_estimate - m_options.send_reserve);
+    }
+
+    auto TickLoop::RunJobPhase(const TickContext& context) -> void {
+        if (m_phases[Index(TickPhase::JobProcessing)]) {
+            m_phases[Index(TickPhase::JobProcessing)](context);
+        }
+
+        // Deadline before epoch, a worker seeing the new epoch reads this tick's deadline
+        m_job_deadline.store(context.job_deadline.time_since_epoch().count(), std::memory_order_relaxed);
+        m_job_epoch.fetch_add(1, std::memory_order_release);
+        Synapse::STL::Concurrent::FutexWakeAll(m_job_epoch);
+
+        ThreadLocal::end_tick_count = context.job_deadline;
+        ThreadManager::DistributeReservedJobs();
+        ThreadManager::DoGlobalQueueWork();
+    }
+
+    auto TickLoop::ReportOverrun(const TickStatistics& statistics) -> void {
+        m_unlogged_overruns++;
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (now - m_last_overrun_log < std::chrono::seconds(1)) {
+            return;
+        }
+
+        const auto& phases = statistics.phase_durations;
+        CORE_WARN("Tick {} overran by {}us ({} overruns since the last report): receive {}us, jobs {}us, assembly {}us, send {}us",
+                statistics.tick, ToMicroseconds(statistics.overrun), m_unlogged_overruns,
+                ToMicroseconds(phases[Index(TickPhase::NetworkReceive)]), ToMicroseconds(phases[Index(TickPhase::JobProcessing)]),
+                ToMicroseconds(phases[Index(TickPhase::PacketAssembly)]), ToMicroseconds(phases[Index(TickPhase::Send)]));
+        m_last_overrun_log = now;
+        m_unlogged_overruns = 0;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+#include <Arena/AllocationPolicy.hpp>
+#include <Arena/AllocationTrace.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace Synapse::Tools {
+    /**
+     * @brief How frees of the recorded sequence are applied to the allocator under test.
+     */
+    enum class ReplayFreeMode : std::uint8_t {
+        Free,       ///< Every free is forwarded to the allocator.
+        Ignore,     ///< Frees are dropped, e.g. for linear allocators that are only reset.
+        LifoOnly    ///< Only frees of the most recent live block are forwarded, the rest are skipped.
+    };
+
+    /**
+     * @brief Outcome of replaying one allocation sequence against one allocator.
+     */
+    struct ReplayResult {
+        std::string allocator;
+        std::uint64_t operations{ 0U };
+        std::uint64_t failed_allocations{ 0U };  ///< Out of memory, or the request did not fit the allocator.
+        std::uint64_t skipped_frees{ 0U };       ///< Frees the allocator cannot honour, see `ReplayFreeMode`.
+        std::uint64_t peak_live_bytes{ 0U };     ///< Highest sum of live requested bytes the allocator held.
+        std::uint64_t peak_footprint{ 0U };      ///< Highest block end address touched, relative to the area start.
+        double fragmentation{ 0.0 };             ///< 1 - peak_live_bytes / peak_footprint.
+        double seconds{ 0.0 };
+        double operations_per_second{ 0.0 };
+    };
+
+    /**
+     * @brief Replays a prepared allocation sequence against an allocator and measures it.
+     *
+     * The footprint is the high-water mark of the address space the allocator had to touch,
+     * which is what ends up resident. The timing covers the whole loop, including the cheap
+     * footprint bookkeeping, so results are comparable between allocators rather than absolute.
+     *
+     * @param allocator      Allocator under test, freshly constructed over `area_start`.
+     * @param area_start     First byte of the area backing the allocator.
+     * @param replay         Sequence built by `AllocationTrace::BuildReplay`.
+     * @param name           Label used in the report.
+     * @param max_size       Largest request the allocator can serve; larger ones count as failures.
+     * @param max_alignment  Largest alignment the allocator can serve; larger ones count as failures.
+     */
+    template <ReplayFreeMode TFreeMode, Memory::Arena::AllocationPolicy TAllocator>
+    [[nodiscard]] auto Replay(TAllocator &allocator, const std::byte *area_start, const Memory::Arena::AllocationReplay &replay,
+            std::string name, const std::size_t max_size = std::numeric_limits<std::size_t>::max(),
+            const std::size_t max_alignment = std::numeric_limits<std::size_t>::max()) -> ReplayResult {
+        using Memory::Arena::AllocationEventType;
+        using Memory::Arena::ReplayOperation;
+
+        ReplayResult result{ .allocator = std::move(name) };
+        std::vector<std::byte *> slots(replay.slot_count, nullptr);
+        std::vector<std::uint64_t> slot_sizes(replay.slot_count, 0U);
+        std::vector<std::uint32_t> lifo_order{};
+        std::uint64_t live_bytes{ 0U };
+
+        const auto begin{ std::chrono::steady_clock::now() };
+        for (const ReplayOperation &operation : replay.operations) {
+            ++result.operations;
+            if (operation.type == AllocationEventType::Allocate) {
+                const std::size_t alignment{ std::max<std::size_t>(operation.alignment, 1U) };
+                if ((operation.size == 0U) || (operation.size > max_size) || (alignment > max_alignment)) {
+                    ++result.failed_allocations;
+                    continue;
+                }
+                std::byte *ptr{ allocator.Allocate(static_cast<std::size_t>(operation.size), alignment) };
+                if (ptr == nullptr) {
+                    ++result.failed_allocations;
+                    continue;
+                }
+                slots[operation.slot] = ptr;
+                slot_sizes[operation.slot] = operation.size;
+                live_bytes += operation.size;
+                result.peak_live_bytes = std::max(result.peak_live_bytes, live_bytes);
+                result.peak_footprint = std::max(result.peak_footprint,
+                        static_cast<std::uint64_t>((ptr + operation.size) - area_start));
+                if constexpr (TFreeMode == ReplayFreeMode::LifoOnly) {
+                    lifo_order.push_back(operation.slot);
+                }
+                continue;
+            }
+
+            std::byte *ptr{ slots[operation.slot] };
+            if (ptr == nullptr) {
+                // The matching allocation failed
+                continue;
+            }
+            if constexpr (TFreeMode == ReplayFreeMode::Ignore) {
+                ++result.skipped_frees;
+            } else if constexpr (TFreeMode == ReplayFreeMode::LifoOnly) {
+                if (lifo_order.empty() || (lifo_order.back() != operation.slot)) {
+                    ++result.skipped_frees;
+                } else {
+                    lifo_order.pop_back();
+                    allocator.Deallocate(ptr);
+                    live_bytes -= slot_sizes[operation.slot];
+                }
+            } else {
+                allocator.Deallocate(ptr);
+                live_bytes -= slot_sizes[operation.slot];
+            }
+            slots[operation.slot] = nullptr;
+        }
+        const auto end{ std::chrono::steady_clock::now() };
+
+        result.seconds = std::chrono::duration<double>(end - begin).count();
+        result.operations_per_second = (result.seconds > 0.0) ? static_cast<double>(result.operations) / result.seconds : 0.0;
+        result.fragmentation = (result.peak_footprint > 0U)
+                ? 1.0 - (static_cast<double>(result.peak_live_bytes) / static_cast<double>(result.peak_footprint))
+                : 0.0;
+        return result;
+    }
+}
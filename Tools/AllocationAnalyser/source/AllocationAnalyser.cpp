@@ -0,0 +1,155 @@
+#include <TraceReplayer.hpp>
+#include <Allocator/FreeListAllocator.hpp>
+#include <Allocator/LinearAllocator.hpp>
+#include <Allocator/PoolAllocator.hpp>
+#include <Allocator/StackAllocator.hpp>
+#include <Area/HeapArea.hpp>
+#include <Arena/AllocationTrace.hpp>
+#include <Log.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <print>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace Synapse;
+
+namespace {
+    struct Options {
+        std::string_view trace_path{};
+        std::size_t area_size{ 0U };
+        bool csv{ false };
+    };
+
+    auto PrintUsage() -> void {
+        std::println("Usage: AllocationAnalyser <trace.alat> [--area-size <bytes>] [--csv]");
+        std::println("  --area-size  Size of the area each allocator replays into, defaults to 4x the peak live bytes");
+        std::println("  --csv        Print machine-readable output");
+    }
+
+    auto ParseOptions(const int argc, char **argv) -> std::optional<Options> {
+        Options options{};
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument{ argv[i] };
+            if ((argument == "--area-size") && ((i + 1) < argc)) {
+                const std::string_view value{ argv[++i] };
+                if (std::from_chars(value.data(), value.data() + value.size(), options.area_size).ec != std::errc{}) {
+                    return std::nullopt;
+                }
+            } else if (argument == "--csv") {
+                options.csv = true;
+            } else if (options.trace_path.empty()) {
+                options.trace_path = argument;
+            } else {
+                return std::nullopt;
+            }
+        }
+        if (options.trace_path.empty()) {
+            return std::nullopt;
+        }
+        return options;
+    }
+
+    /**
+     * @brief Constructs a fresh allocator over its own area and replays the sequence into it.
+     */
+    template <class TAllocator, Tools::ReplayFreeMode TFreeMode>
+    auto RunReplay(const Memory::Arena::AllocationReplay &replay, const std::size_t area_size, std::string name,
+            const std::size_t max_size = std::numeric_limits<std::size_t>::max(),
+            const std::size_t max_alignment = std::numeric_limits<std::size_t>::max()) -> Tools::ReplayResult {
+        const Memory::Area::HeapArea area{ area_size };
+        TAllocator allocator{ area.GetStart(), area.GetEnd() };
+        return Tools::Replay<TFreeMode>(allocator, area.GetStart(), replay, std::move(name), max_size, max_alignment);
+    }
+
+    auto PrintCallSites(const Memory::Arena::AllocationTrace &trace) -> void {
+        struct CallSiteUsage {
+            std::uint32_t call_site;
+            std::uint64_t allocations;
+            std::uint64_t bytes;
+        };
+        std::unordered_map<std::uint32_t, CallSiteUsage> usage{};
+        for (const Memory::Arena::AllocationEvent &event : trace.GetEvents()) {
+            if (event.type == Memory::Arena::AllocationEventType::Allocate) {
+                CallSiteUsage &entry{ usage.try_emplace(event.call_site, CallSiteUsage{ event.call_site, 0U, 0U }).first->second };
+                ++entry.allocations;
+                entry.bytes += event.size;
+            }
+        }
+
+        std::vector<CallSiteUsage> sorted{};
+        sorted.reserve(usage.size());
+        for (const auto &[call_site, entry] : usage) {
+            sorted.push_back(entry);
+        }
+        std::ranges::sort(sorted, std::ranges::greater{}, &CallSiteUsage::bytes);
+
+        std::println("\nTop call sites by allocated bytes");
+        std::println("{:>10} {:>14} {:>16}", "call site", "allocations", "bytes");
+        for (std::size_t i = 0U; i < std::min<std::size_t>(sorted.size(), 10U); ++i) {
+            std::println("{:>10x} {:>14} {:>16}", sorted[i].call_site, sorted[i].allocations, sorted[i].bytes);
+        }
+    }
+}
+
+auto main(int argc, char **argv) -> int {
+    const std::optional<Options> options{ ParseOptions(argc, argv) };
+    if (!options) {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    Log::Log::Initialise(false);
+
+    const std::optional<Memory::Arena::AllocationTrace> trace{ Memory::Arena::AllocationTrace::Load(options->trace_path) };
+    if (!trace) {
+        return EXIT_FAILURE;
+    }
+
+    const Memory::Arena::AllocationReplay replay{ trace->BuildReplay() };
+    const std::size_t area_size{ options->area_size != 0U
+            ? options->area_size
+            : std::max<std::size_t>(static_cast<std::size_t>(replay.peak_live_bytes * 4U), 1024U * 1024U) };
+
+    using Tools::ReplayFreeMode;
+    std::vector<Tools::ReplayResult> results{};
+    results.push_back(RunReplay<Memory::Allocator::FreeListAllocator<0, true>, ReplayFreeMode::Free>(
+            replay, area_size, "FreeList best fit"));
+    results.push_back(RunReplay<Memory::Allocator::FreeListAllocator<0, false>, ReplayFreeMode::Free>(
+            replay, area_size, "FreeList first fit"));
+    results.push_back(RunReplay<Memory::Allocator::StackAllocator<0>, ReplayFreeMode::LifoOnly>(
+            replay, area_size, "Stack"));
+    results.push_back(RunReplay<Memory::Allocator::LinearAllocator<0>, ReplayFreeMode::Ignore>(
+            replay, area_size, "Linear"));
+    results.push_back(RunReplay<Memory::Allocator::PoolAllocator<64, 0, 16>, ReplayFreeMode::Free>(
+            replay, area_size, "Pool 64B", 64U, 16U));
+    results.push_back(RunReplay<Memory::Allocator::PoolAllocator<256, 0, 16>, ReplayFreeMode::Free>(
+            replay, area_size, "Pool 256B", 256U, 16U));
+
+    if (options->csv) {
+        std::println("allocator,operations,failed_allocations,skipped_frees,peak_live_bytes,peak_footprint,fragmentation,seconds,operations_per_second");
+        for (const Tools::ReplayResult &result : results) {
+            std::println("{},{},{},{},{},{},{:.6f},{:.6f},{:.0f}", result.allocator, result.operations,
+                    result.failed_allocations, result.skipped_frees, result.peak_live_bytes, result.peak_footprint,
+                    result.fragmentation, result.seconds, result.operations_per_second);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    std::println("{} events, {} replay operations, {} unmatched frees, peak live {} bytes, area {} bytes",
+            trace->GetEvents().size(), replay.operations.size(), replay.unmatched_frees, replay.peak_live_bytes, area_size);
+    std::println("{:<20} {:>12} {:>10} {:>10} {:>14} {:>14} {:>8} {:>14}", "allocator", "operations", "failed",
+            "skipped", "peak live", "peak footprint", "frag", "ops/sec");
+    for (const Tools::ReplayResult &result : results) {
+        std::println("{:<20} {:>12} {:>10} {:>10} {:>14} {:>14} {:>8.3f} {:>14.0f}", result.allocator, result.operations,
+                result.failed_allocations, result.skipped_frees, result.peak_live_bytes, result.peak_footprint,
+                result.fragmentation, result.operations_per_second);
+    }
+    PrintCallSites(*trace);
+    return EXIT_SUCCESS;
+}